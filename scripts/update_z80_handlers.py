@@ -0,0 +1,228 @@
+#!/usr/bin/env python
+# -*- coding: utf-8  -*-
+
+# Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+# Released under the terms of the MIT License. See LICENSE for details.
+
+"""
+This script generates 'src/z80_handlers.inc.c' from 'src/z80_ops.inc.c' and
+'src/z80_tables.inc.c'. It should be run automatically by make when either is
+modified, but can also be run manually.
+
+Every instruction handler in z80_ops.inc.c that reads its opcode (usually to
+decode a register, register pair, or condition with extract_*()) is treated
+as a template. For each opcode that dispatches to it, we emit a copy of the
+handler with the opcode fixed and the operands resolved to direct register
+references, so no decoding happens at runtime.
+"""
+
+from __future__ import print_function
+
+import io
+import re
+import time
+
+OPS = "src/z80_ops.inc.c"
+TABLES = "src/z80_tables.inc.c"
+DEST = "src/z80_handlers.inc.c"
+
+ENCODING = "utf8"
+TAB = " " * 4
+
+re_date = re.compile(r"^([ \t]*@AUTOGEN_DATE[ \t]*)(.*?)$", re.M)
+re_handler = re.compile(
+    r"(/\* @AUTOGEN_HANDLER_BLOCK_START \*/\n*)(.*?)"
+    r"(\n*/\* @AUTOGEN_HANDLER_BLOCK_END \*/)", re.S)
+re_alias = re.compile(
+    r"(/\* @AUTOGEN_ALIAS_BLOCK_START \*/\n*)(.*?)"
+    r"(\n*/\* @AUTOGEN_ALIAS_BLOCK_END \*/)", re.S)
+
+re_func = re.compile(
+    r"/\*\n {4}(.*?)\n.*?\*/\n"
+    r"static (?:inline )?uint8_t (z80_inst_\w+)\(Z80 \*z80, uint8_t opcode\)\n"
+    r"\{\n(.*?)\n\}\n", re.S)
+re_entry = re.compile(r"Z80_(OP|PREFIX)\((\w+), (0x[0-9A-F]{2}), (\w+)\)")
+re_opcode = re.compile(r"\bopcode\b")
+re_passthru = re.compile(r"\(void\) opcode;|z80_inst_\w+\(z80, opcode\)|"
+                         r"= opcode;")
+re_extract = re.compile(r"(\*?)extract_(reg|pair|pair_pp|pair_qq|cond)"
+                        r"\(z80, ([^()]*)\)")
+
+PREFIXES = {
+    "main": ["0x{0:02X}"],
+    "extended": ["0xED{0:02X}"],
+    "bits": ["0xCB{0:02X}"],
+    "index": ["0xDD{0:02X}", "0xFD{0:02X}"],
+    "index_bits": ["0xDDCB{0:02X}", "0xFDCB{0:02X}"]
+}
+
+REGS = {0x00: "b", 0x08: "c", 0x10: "d", 0x18: "e", 0x20: "h", 0x28: "l",
+        0x38: "a"}
+PAIRS = {0x00: "bc", 0x10: "de", 0x20: "hl", 0x30: "sp"}
+PAIRS_PP = {0x00: "bc", 0x10: "de", 0x20: None, 0x30: "sp"}
+PAIRS_QQ = {0x00: "bc", 0x10: "de", 0x20: "hl", 0x30: False}
+PAIR_KINDS = {"pair": PAIRS, "pair_pp": PAIRS_PP, "pair_qq": PAIRS_QQ}
+CONDS = {
+    0x00: "!get_flag(z80, FLAG_ZERO)",
+    0x08: "get_flag(z80, FLAG_ZERO)",
+    0x10: "!get_flag(z80, FLAG_CARRY)",
+    0x18: "get_flag(z80, FLAG_CARRY)",
+    0x20: "!get_flag(z80, FLAG_PARITY)",
+    0x28: "get_flag(z80, FLAG_PARITY)",
+    0x30: "!get_flag(z80, FLAG_SIGN)",
+    0x38: "get_flag(z80, FLAG_SIGN)"
+}
+
+class Z80HandlerError(Exception):
+    """
+    Base class for all errors while trying to generate the handlers file.
+    """
+
+
+def _eval_operand(expr):
+    """
+    Evaluate a constant opcode expression (like "0x41 << 3") from C source.
+    """
+    if not re.match(r"^[0-9A-Fa-fx<>+\- ]+$", expr):
+        raise Z80HandlerError("Can't evaluate operand: {0}".format(expr))
+    return eval(expr) & 0xFF
+
+def _resolve_extract(match):
+    """
+    Replace an extract_*() call on a constant opcode with its result.
+
+    Calls that would be invalid for the opcode are left alone; they only
+    appear in branches that the compiler can remove. So are calls for AF,
+    since extract_pair_qq() must store any pending flags in F first.
+    """
+    deref, kind, expr = match.groups()
+    value = _eval_operand(expr)
+
+    if kind == "cond":
+        return CONDS[value & 0x38]
+    if kind == "reg":
+        name = REGS.get(value & 0x38)
+    else:
+        name = PAIR_KINDS[kind][value & 0x30]
+        if name is None:
+            return deref + "z80->regs.ixy"
+    if not name:
+        return match.group(0)
+    return ("" if deref else "&") + "z80->regs." + name
+
+class Handler(object):
+    """
+    Represent a single instruction handler from z80_ops.inc.c.
+    """
+
+    def __init__(self, name, summary, body):
+        self.name = name
+        self.summary = summary.split(" (0x")[0].rstrip(": ")
+        self.body = body
+
+    @property
+    def is_template(self):
+        """
+        Return whether the handler decodes anything from its opcode.
+
+        Handlers that only pass their opcode along or store it don't benefit
+        from being specialized.
+        """
+        return any(re_opcode.search(re_passthru.sub("", line))
+                   for line in self.body.splitlines())
+
+    def specialized_name(self, code):
+        """
+        Return the name of this handler specialized for the given opcode.
+        """
+        return "{0}__{1}".format(self.name, code)
+
+    def render(self, code, tables):
+        """
+        Return C code for this handler specialized for the given opcode.
+        """
+        value = int(code, 16)
+        opcodes = [fmt.format(value) for table in tables
+                   for fmt in PREFIXES[table]]
+
+        body = [TAB + "(void) opcode;"]
+        for line in self.body.splitlines():
+            if line.strip() == "(void) opcode;":
+                continue
+            line = re_opcode.sub(code, line)
+            line = re_extract.sub(_resolve_extract, line)
+            body.append(line)
+
+        return ("/*\n{tab}{summary} ({opcodes}):\n"
+                "{tab}Specialized from {name}().\n*/\n"
+                "static uint8_t {func}(Z80 *z80, uint8_t opcode)\n"
+                "{{\n{body}\n}}").format(
+                    tab=TAB, summary=self.summary, opcodes=", ".join(opcodes),
+                    name=self.name, func=self.specialized_name(code),
+                    body="\n".join(body))
+
+
+def _load_handlers(text):
+    """
+    Return a dict of Handler objects parsed from the instruction source.
+    """
+    return {name: Handler(name, summary, body)
+            for summary, name, body in re_func.findall(text)}
+
+def _load_entries(text):
+    """
+    Return a list of (table, opcode, handler name) from the dispatch tables.
+    """
+    return [(table, code, name) for kind, table, code, name
+            in re_entry.findall(text) if kind == "OP"]
+
+def _process(template, handlers, entries):
+    """
+    Return C code generated from a source template and instruction data.
+    """
+    specialized = {}
+    aliases = {}
+    for table, code, name in entries:
+        if name not in handlers:
+            msg = "Handler {0} in table {1} is not defined"
+            raise Z80HandlerError(msg.format(name, table))
+        handler = handlers[name]
+        alias = handler.specialized_name(code)
+        if handler.is_template:
+            specialized.setdefault((name, code), []).append(table)
+        else:
+            aliases[alias] = name
+
+    handler_block = "\n\n".join(
+        handlers[name].render(code, tables)
+        for (name, code), tables in sorted(specialized.items()))
+    alias_block = "\n".join(
+        "#define {0} {1}".format(alias, name)
+        for alias, name in sorted(aliases.items()))
+    date = time.asctime(time.gmtime())
+
+    result = re_date.sub(r"\1{0} UTC".format(date), template)
+    result = re_handler.sub(
+        lambda m: m.group(1) + handler_block + m.group(3), result)
+    result = re_alias.sub(
+        lambda m: m.group(1) + alias_block + m.group(3), result)
+    return result
+
+def main():
+    """
+    Main script entry point.
+    """
+    with io.open(OPS, "r", encoding=ENCODING) as fp:
+        handlers = _load_handlers(fp.read())
+    with io.open(TABLES, "r", encoding=ENCODING) as fp:
+        entries = _load_entries(fp.read())
+    with io.open(DEST, "r", encoding=ENCODING) as fp:
+        template = fp.read()
+
+    result = _process(template, handlers, entries)
+
+    with io.open(DEST, "w", encoding=ENCODING) as fp:
+        fp.write(result)
+
+if __name__ == "__main__":
+    main()
@@ -34,6 +34,10 @@ static void print_help(const char *arg1)
 "    -s, --save <path> save cartridge RAM (\"battery save\") to the given file\n"
 "                      (defaults to <rom_path>.sav)\n"
 "    -n, --no-save     disable saving cartridge RAM entirely\n"
+"    -S, --state <path>\n"
+"                      save the game's state to the given file with F5, and\n"
+"                      load it with F9 (defaults to <rom_path>.state)\n"
+"    -R, --resume      start from the saved state instead of booting\n"
 "    <rom_path>        path to the rom file to execute; if not given, will look\n"
 "                      in the roms/ directory and prompt the user\n"
 "\n"
@@ -46,6 +50,30 @@ static void print_help(const char *arg1)
 "                      (applies to windowed mode only; defaults to 4)\n"
 "    -q, --square      force a square pixel aspect ratio instead of the more\n"
 "                      faithful 8:7 PAR\n"
+"    -p, --prescale <n>\n"
+"                      scale the screen by an integer factor in software\n"
+"                      (correcting its aspect ratio too) before the GPU\n"
+"                      stretches it to the window, for sharper pixels\n"
+"    -e, --scale2x     smooth diagonal edges with the Scale2x filter; needs\n"
+"                      an even prescale (defaults to 2)\n"
+"    -l, --lcd         blend each frame with the last, like the Game Gear's\n"
+"                      slow LCD; smooths out flickering sprites\n"
+"    -j, --jit         run hot ROM blocks as call-threaded native code\n"
+"                      (x86-64 only; falls back to the interpreter elsewhere)\n"
+"    -J, --jit-verify  like --jit, but also run translated code through the\n"
+"                      interpreter and stop if the results differ (slow)\n"
+"    -t, --threaded    draw the screen on a separate thread\n"
+"    -k, --frameskip <n>\n"
+"                      draw only one of every n + 1 frames; if n is 'auto',\n"
+"                      skip frames only when the host can't keep up\n"
+"    -w, --fast-forward\n"
+"                      start out running as fast as possible (toggle with Tab)\n"
+"    -y, --spin        busy-wait through the last moments before each frame,\n"
+"                      for steadier pacing at the cost of CPU time\n"
+"    -H, --headless    run without a window or input, as fast as possible\n"
+"    -F, --frames <n>  stop emulating after the given number of frames\n"
+"    -B, --benchmark   like --headless, but also report how fast the\n"
+"                      emulator ran when it stops\n"
 "    -a, --assemble <in> [<out>]\n"
 "                      convert z80 assembly source code into a binary file that\n"
 "                      can be run by crater\n"
@@ -246,6 +274,18 @@ static int parse_opt_arg(Config *config, Arguments *args, const char *arg)
     else if (arg_check(arg, "n", "no-save")) {
         config->no_saving = true;
     }
+    else if (arg_check(arg, "S", "state")) {
+        const char *next = consume_next(args);
+        if (!next) {
+            ERROR("the state option requires an argument")
+            return CONFIG_EXIT_FAILURE;
+        }
+        free(config->state_path);
+        config->state_path = cr_strdup(next);
+    }
+    else if (arg_check(arg, "R", "resume")) {
+        config->resume = true;
+    }
     else if (arg_check(arg, "g", "debug")) {
         config->debug++;
     }
@@ -274,6 +314,80 @@ static int parse_opt_arg(Config *config, Arguments *args, const char *arg)
     else if (arg_check(arg, "q", "square")) {
         config->square_par = true;
     }
+    else if (arg_check(arg, "p", "prescale")) {
+        const char *next = consume_next(args);
+        if (!next) {
+            ERROR("the prescale option requires an argument")
+            return CONFIG_EXIT_FAILURE;
+        }
+        char *end;
+        long prescale = strtol(next, &end, 10);
+        if (prescale <= 0 || prescale > PRESCALE_MAX || *end != '\0') {
+            ERROR("prescale factor of %s is not an integer or is out of range",
+                  next)
+            return CONFIG_EXIT_FAILURE;
+        }
+        config->prescale = prescale;
+    }
+    else if (arg_check(arg, "e", "scale2x")) {
+        config->scale2x = true;
+    }
+    else if (arg_check(arg, "l", "lcd")) {
+        config->lcd = true;
+    }
+    else if (arg_check(arg, "j", "jit")) {
+        config->jit = true;
+    }
+    else if (arg_check(arg, "J", "jit-verify")) {
+        config->jit = config->jit_verify = true;
+    }
+    else if (arg_check(arg, "t", "threaded")) {
+        config->threaded = true;
+    }
+    else if (arg_check(arg, "k", "frameskip")) {
+        const char *next = consume_next(args);
+        if (!next) {
+            ERROR("the frameskip option requires an argument")
+            return CONFIG_EXIT_FAILURE;
+        }
+        if (!strcmp(next, "auto")) {
+            config->frameskip = FRAMESKIP_AUTO;
+        } else {
+            char *end;
+            long frameskip = strtol(next, &end, 10);
+            if (frameskip < 0 || frameskip > FRAMESKIP_MAX || *end != '\0') {
+                ERROR("frameskip of %s is not 'auto' or is out of range", next)
+                return CONFIG_EXIT_FAILURE;
+            }
+            config->frameskip = frameskip;
+        }
+    }
+    else if (arg_check(arg, "w", "fast-forward")) {
+        config->fast_forward = true;
+    }
+    else if (arg_check(arg, "y", "spin")) {
+        config->spin = true;
+    }
+    else if (arg_check(arg, "H", "headless")) {
+        config->headless = true;
+    }
+    else if (arg_check(arg, "F", "frames")) {
+        const char *next = consume_next(args);
+        if (!next) {
+            ERROR("the frames option requires an argument")
+            return CONFIG_EXIT_FAILURE;
+        }
+        char *end;
+        long frames = strtol(next, &end, 10);
+        if (frames <= 0 || *end != '\0') {
+            ERROR("frame count of %s is not a positive integer", next)
+            return CONFIG_EXIT_FAILURE;
+        }
+        config->frames = frames;
+    }
+    else if (arg_check(arg, "B", "benchmark")) {
+        config->headless = config->benchmark = true;
+    }
     else if (arg_check(arg, "a", "assemble")) {
         if (args->paths_read >= 1) {
             config->src_path = config->rom_path;
@@ -372,10 +486,23 @@ static bool sanity_check(Config *config)
     } else if (config->assemble && config->disassemble) {
         ERROR("cannot assemble and disassemble at the same time")
         return false;
+    } else if (config->scale2x && config->prescale % 2) {
+        ERROR("the Scale2x filter needs an even prescale factor")
+        return false;
     } else if (assembler && (config->fullscreen || config->scale ||
-                             config->square_par)) {
+                             config->square_par || config->prescale ||
+                             config->scale2x || config->lcd || config->jit ||
+                             config->threaded || config->frameskip ||
+                             config->fast_forward || config->spin ||
+                             config->headless || config->frames ||
+                             config->state_path || config->resume)) {
         ERROR("cannot specify emulator options in assembler mode")
         return false;
+    } else if (config->headless && (config->fullscreen || config->scale ||
+                                    config->square_par || config->prescale ||
+                                    config->scale2x || config->lcd)) {
+        ERROR("cannot specify display options in headless mode")
+        return false;
     } else if (assembler && !config->src_path) {
         ERROR("assembler mode requires an input file")
         return false;
@@ -395,6 +522,9 @@ static bool set_defaults(Config *config)
     if (!config->scale) {
         config->scale = 4;
     }
+    if (config->scale2x && !config->prescale) {
+        config->prescale = 2;
+    }
     if (assembler && !config->dst_path) {
         guess_assembler_output_file(config);
     }
@@ -409,6 +539,13 @@ static bool set_defaults(Config *config)
         strcpy(config->sav_path, config->rom_path);
         strcat(config->sav_path, ext);
     }
+    if (!assembler && !config->state_path) {
+        const char *ext = ".state";
+        config->state_path = cr_malloc(sizeof(char) *
+            (strlen(config->rom_path) + strlen(ext) + 1));
+        strcpy(config->state_path, config->rom_path);
+        strcat(config->state_path, ext);
+    }
     return true;
 }
 
@@ -432,8 +569,22 @@ int config_create(Config** config_ptr, int argc, char* argv[])
     config->no_saving = false;
     config->scale = 0;
     config->square_par = false;
+    config->prescale = 0;
+    config->scale2x = false;
+    config->lcd = false;
+    config->jit = false;
+    config->jit_verify = false;
+    config->threaded = false;
+    config->frameskip = 0;
+    config->fast_forward = false;
+    config->spin = false;
+    config->headless = false;
+    config->benchmark = false;
+    config->frames = 0;
     config->rom_path = NULL;
     config->sav_path = NULL;
+    config->state_path = NULL;
+    config->resume = false;
     config->bios_path = NULL;
     config->src_path = NULL;
     config->dst_path = NULL;
@@ -458,6 +609,7 @@ void config_destroy(Config *config)
 {
     free(config->rom_path);
     free(config->sav_path);
+    free(config->state_path);
     free(config->bios_path);
     free(config->src_path);
     free(config->dst_path);
@@ -478,8 +630,22 @@ void config_dump_args(const Config* config)
     DEBUG("- no_saving:   %s", config->no_saving   ? "true" : "false")
     DEBUG("- scale:       %d", config->scale)
     DEBUG("- square_par:  %s", config->square_par  ? "true" : "false")
+    DEBUG("- prescale:    %d", config->prescale)
+    DEBUG("- scale2x:     %s", config->scale2x     ? "true" : "false")
+    DEBUG("- lcd:         %s", config->lcd         ? "true" : "false")
+    DEBUG("- jit:         %s", config->jit         ? "true" : "false")
+    DEBUG("- jit_verify:  %s", config->jit_verify  ? "true" : "false")
+    DEBUG("- threaded:    %s", config->threaded    ? "true" : "false")
+    DEBUG("- frameskip:   %d", config->frameskip)
+    DEBUG("- fast_forward: %s", config->fast_forward ? "true" : "false")
+    DEBUG("- spin:        %s", config->spin        ? "true" : "false")
+    DEBUG("- headless:    %s", config->headless    ? "true" : "false")
+    DEBUG("- benchmark:   %s", config->benchmark   ? "true" : "false")
+    DEBUG("- frames:      %lu", config->frames)
     DEBUG("- rom_path:    %s", config->rom_path  ? config->rom_path  : "(null)")
     DEBUG("- sav_path:    %s", config->sav_path  ? config->sav_path  : "(null)")
+    DEBUG("- state_path:  %s", config->state_path ? config->state_path : "(null)")
+    DEBUG("- resume:      %s", config->resume      ? "true" : "false")
     DEBUG("- bios_path:   %s", config->bios_path ? config->bios_path : "(null)")
     DEBUG("- src_path:    %s", config->src_path  ? config->src_path  : "(null)")
     DEBUG("- dst_path:    %s", config->dst_path  ? config->dst_path  : "(null)")
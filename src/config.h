@@ -18,6 +18,13 @@
 */
 #define SCALE_MAX 128
 
+/* The software scaler's limit; the GPU can stretch its output further */
+#define PRESCALE_MAX 8
+
+/* Skipping more than a second of frames at a time isn't useful */
+#define FRAMESKIP_MAX 60
+#define FRAMESKIP_AUTO -1
+
 /* Structs */
 
 typedef struct {
@@ -28,8 +35,22 @@ typedef struct {
     bool no_saving;
     unsigned scale;
     bool square_par;
+    unsigned prescale;
+    bool scale2x;
+    bool lcd;
+    bool jit;
+    bool jit_verify;
+    bool threaded;
+    int frameskip;
+    bool fast_forward;
+    bool spin;
+    bool headless;
+    bool benchmark;
+    unsigned long frames;
     char *rom_path;
     char *sav_path;
+    char *state_path;
+    bool resume;
     char *bios_path;
     char *src_path;
     char *dst_path;
@@ -1,7 +1,10 @@
 /* Copyright (C) 2014-2019 Ben Kurtovic <ben.kurtovic@gmail.com>
    Released under the terms of the MIT License. See LICENSE for details. */
 
+#include <inttypes.h>
+#include <pthread.h>
 #include <signal.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <unistd.h>
 #include <SDL.h>
@@ -11,6 +14,7 @@
 #include "gamegear.h"
 #include "logging.h"
 #include "save.h"
+#include "scaler.h"
 #include "util.h"
 
 typedef struct {
@@ -18,13 +22,81 @@ typedef struct {
     int num, capacity;
 } Controllers;
 
+/* Must be a power of two */
+#define INPUT_QUEUE_SIZE 64
+
+typedef struct {
+    GGButton button;
+    bool state;
+} InputEvent;
+
+typedef struct {
+    InputEvent items[INPUT_QUEUE_SIZE];
+    atomic_uint head, tail;
+} InputQueue;
+
+/* Set in the middle buffer's index when it holds a frame not yet shown */
+#define FRAME_FRESH 0x4
+
+/* Output pixels per scaler thread; smaller outputs aren't worth handing off */
+#define PIXELS_PER_SCALER_THREAD (256 * 1024)
+
+/* Host audio sample rate, in Hz, and samples per audio callback */
+#define AUDIO_RATE 48000
+#define AUDIO_DEVICE_SAMPLES 512
+
+/* In sample pairs, about 170 ms at 48 kHz; must be a power of two */
+#define AUDIO_RING_SIZE 8192
+
+/* How much audio we try to keep queued, in milliseconds */
+#define AUDIO_LATENCY_MS 40
+
+/* The most we stretch audio by when falling behind, as a fraction */
+#define AUDIO_MAX_SKEW 0.005
+
+/* Longest wait for the audio device to play something, in milliseconds */
+#define AUDIO_WAIT_MS 100
+
+typedef struct {
+    int16_t items[2 * AUDIO_RING_SIZE];
+    atomic_uint head, tail;
+} AudioRing;
+
+/* Codes of the events the emulation thread sends the presenter */
+#define EVENT_FRAME   0
+#define EVENT_STOPPED 1
+
+/* Save state requests from the main thread to the emulation thread */
+#define STATE_NONE 0
+#define STATE_SAVE 1
+#define STATE_LOAD 2
+
 typedef struct {
     GameGear *gg;
     SDL_Window *window;
     SDL_Renderer *renderer;
-    SDL_Texture *texture;
+    SDL_Texture *textures[3];
+    void *buffers[3];
+    int pitches[3];
+    unsigned back, front;
+    atomic_uint middle;
+    bool front_shown;
+    uint32_t frame_event;
+    InputQueue input;
+    atomic_bool quit, fast_forward;
+    atomic_uint state_request;
+    const char *state_path;
     uint32_t *pixels;
+    Scaler scaler;
+    bool scaling, blend_pending;
+    SDL_AudioDeviceID audio_device;
+    AudioRing audio;
+    SDL_sem *audio_drained;
+    unsigned audio_rate, audio_target;
+    atomic_uint underruns;
+    unsigned long audio_behind;
     Controllers controllers;
+    unsigned long frames_left;
 } Emulator;
 
 static Emulator emu;
@@ -85,6 +157,48 @@ static void setup_input()
     emu.controllers.capacity = n;
 }
 
+/*
+    Lock one of the textures, so the GameGear can draw straight into it.
+*/
+static void lock_texture(unsigned i)
+{
+    if (SDL_LockTexture(emu.textures[i], NULL, &emu.buffers[i],
+                        &emu.pitches[i]) < 0)
+        FATAL("SDL failed to lock texture: %s", SDL_GetError());
+}
+
+/*
+    Set up the software scaler, if any post-processing was asked for.
+
+    The VDP then draws into a buffer of our own instead of a texture, and the
+    scaler fills the textures from it. When prescaling, the scaler corrects
+    the aspect ratio too, so the GPU only has to stretch square pixels.
+*/
+static void setup_scaler(Config *config)
+{
+    emu.scaling = config->prescale || config->lcd;
+    if (!emu.scaling)
+        return;
+
+    unsigned scale = config->prescale ? config->prescale : 1;
+    scaler_init(&emu.scaler, scale,
+                config->scale2x ? SCALER_SCALE2X : SCALER_NEAREST,
+                config->prescale && !config->square_par, config->lcd);
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned threads = emu.scaler.width * emu.scaler.height /
+                       PIXELS_PER_SCALER_THREAD + 1;
+    if (cpus > 0 && threads > (unsigned long) cpus)
+        threads = cpus;
+    if (!scaler_set_threads(&emu.scaler, threads))
+        WARN("couldn't start all scaler threads; using %u",
+             emu.scaler.threads)
+
+    emu.pixels = cr_malloc(
+        sizeof(uint32_t) * GG_SCREEN_WIDTH * GG_SCREEN_HEIGHT);
+    emu.blend_pending = false;
+}
+
 /*
     Set up SDL for drawing the game.
 */
@@ -122,24 +236,139 @@ static void setup_graphics(Config *config)
     SDL_GetRendererInfo(emu.renderer, &info);
     DEBUG("Using %s renderer", info.name);
 
-    emu.texture = SDL_CreateTexture(emu.renderer, SDL_PIXELFORMAT_ARGB8888,
-        SDL_TEXTUREACCESS_STREAMING, GG_SCREEN_WIDTH, GG_SCREEN_HEIGHT);
+    setup_scaler(config);
+    int tex_width  = emu.scaling ? emu.scaler.width  : GG_SCREEN_WIDTH;
+    int tex_height = emu.scaling ? emu.scaler.height : GG_SCREEN_HEIGHT;
 
-    if (!emu.texture)
-        FATAL("SDL failed to create a texture: %s", SDL_GetError());
+    for (unsigned i = 0; i < 3; i++) {
+        emu.textures[i] = SDL_CreateTexture(emu.renderer,
+            SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+            tex_width, tex_height);
 
-    emu.pixels = cr_malloc(
-        sizeof(uint32_t) * GG_SCREEN_WIDTH * GG_SCREEN_HEIGHT);
+        if (!emu.textures[i])
+            FATAL("SDL failed to create a texture: %s", SDL_GetError());
+        SDL_SetTextureBlendMode(emu.textures[i], SDL_BLENDMODE_BLEND);
+        lock_texture(i);
+    }
 
-    SDL_RenderSetLogicalSize(emu.renderer,
-        config->square_par ? GG_SCREEN_WIDTH  : GG_LOGICAL_WIDTH,
-        config->square_par ? GG_SCREEN_HEIGHT : GG_LOGICAL_HEIGHT);
-    SDL_SetTextureBlendMode(emu.texture, SDL_BLENDMODE_BLEND);
+    if (emu.scaling && (emu.scaler.aspect || config->square_par))
+        SDL_RenderSetLogicalSize(emu.renderer, tex_width, tex_height);
+    else
+        SDL_RenderSetLogicalSize(emu.renderer,
+            config->square_par ? GG_SCREEN_WIDTH  : GG_LOGICAL_WIDTH,
+            config->square_par ? GG_SCREEN_HEIGHT : GG_LOGICAL_HEIGHT);
     SDL_ShowCursor(SDL_DISABLE);
 
     SDL_SetRenderDrawColor(emu.renderer, 0x00, 0x00, 0x00, 0xFF);
     SDL_RenderClear(emu.renderer);
     SDL_RenderPresent(emu.renderer);
+
+    emu.back = 0;
+    atomic_init(&emu.middle, 1);
+    emu.front = 2;
+    emu.front_shown = false;
+    if (emu.scaling)
+        gamegear_attach_display(emu.gg, emu.pixels, 0);
+    else
+        gamegear_attach_display(emu.gg, emu.buffers[0], emu.pitches[0]);
+
+    emu.frame_event = SDL_RegisterEvents(1);
+    if (emu.frame_event == (uint32_t) -1)
+        FATAL("SDL failed to register an event: %s", SDL_GetError());
+}
+
+/*
+    Return how many sample pairs are queued for the audio device.
+*/
+static unsigned audio_fill()
+{
+    AudioRing *ring = &emu.audio;
+    return atomic_load_explicit(&ring->head, memory_order_acquire) -
+           atomic_load_explicit(&ring->tail, memory_order_acquire);
+}
+
+/*
+    SDL audio callback: fill the device's buffer from the ring, and wake the
+    emulation thread if it's waiting for room. Called on SDL's audio thread.
+
+    If the ring runs dry, the rest of the buffer is filled with silence.
+*/
+static void audio_callback(void *data, uint8_t *stream, int len)
+{
+    AudioRing *ring = &emu.audio;
+    int16_t *out = (int16_t*) stream;
+    unsigned wanted = len / (2 * sizeof(int16_t));
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    unsigned count = head - tail < wanted ? head - tail : wanted;
+
+    (void) data;
+    for (unsigned i = 0; i < count; i++) {
+        unsigned index = (tail + i) % AUDIO_RING_SIZE;
+        out[2 * i]     = ring->items[2 * index];
+        out[2 * i + 1] = ring->items[2 * index + 1];
+    }
+    if (count < wanted) {
+        memset(out + 2 * count, 0, (wanted - count) * 2 * sizeof(int16_t));
+        if (head)
+            atomic_fetch_add_explicit(&emu.underruns, 1, memory_order_relaxed);
+    }
+    atomic_store_explicit(&ring->tail, tail + count, memory_order_release);
+    SDL_SemPost(emu.audio_drained);
+}
+
+/*
+    Set up SDL for playing the game's audio.
+
+    Once the device is open, it sets the pace of emulation instead of the
+    GameGear's own throttle: each frame waits until the device has played
+    enough of what's queued, and how little is queued tells the GameGear how
+    far behind it is (see queue_audio()). If it can't be opened, the game
+    runs silently.
+*/
+static void setup_audio()
+{
+    SDL_AudioSpec want, have;
+
+    emu.audio_device = 0;
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
+        WARN("SDL failed to initialize audio: %s", SDL_GetError())
+        return;
+    }
+
+    memset(&want, 0, sizeof(want));
+    want.freq = AUDIO_RATE;
+    want.format = AUDIO_S16SYS;
+    want.channels = 2;
+    want.samples = AUDIO_DEVICE_SAMPLES;
+    want.callback = audio_callback;
+    emu.audio_device = SDL_OpenAudioDevice(NULL, 0, &want, &have,
+        SDL_AUDIO_ALLOW_FREQUENCY_CHANGE|SDL_AUDIO_ALLOW_SAMPLES_CHANGE);
+    if (!emu.audio_device) {
+        WARN("SDL failed to open an audio device: %s", SDL_GetError())
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        return;
+    }
+
+    emu.audio_drained = SDL_CreateSemaphore(0);
+    if (!emu.audio_drained)
+        FATAL("SDL failed to create a semaphore: %s", SDL_GetError());
+
+    emu.audio_rate = have.freq;
+    emu.audio_target = have.freq * AUDIO_LATENCY_MS / 1000;
+    if (emu.audio_target < 2u * have.samples)
+        emu.audio_target = 2u * have.samples;
+    if (emu.audio_target > AUDIO_RING_SIZE / 2)
+        emu.audio_target = AUDIO_RING_SIZE / 2;
+    DEBUG("Opened audio device: %d Hz, %u samples per buffer", have.freq,
+          have.samples)
+
+    atomic_init(&emu.audio.head, 0);
+    atomic_init(&emu.audio.tail, 0);
+    atomic_init(&emu.underruns, 0);
+    emu.audio_behind = 0;
+    gamegear_set_audio_rate(emu.gg, have.freq);
+    gamegear_set_throttle(emu.gg, false);
 }
 
 /*
@@ -152,33 +381,197 @@ static void setup_sdl(Config *config)
 
     setup_input();
     setup_graphics(config);
+    setup_audio();
 }
 
 /*
-    Actually send the pixel data to the screen.
+    Tell the presenter (the main thread) about something that happened on the
+    emulation thread.
 */
-static void draw_frame()
+static void send_event(int code)
 {
-    void *pixels;
-    int pitch;
-    if (SDL_LockTexture(emu.texture, NULL, &pixels, &pitch) < 0)
-        FATAL("SDL failed to lock texture: %s", SDL_GetError());
-    if (pitch != sizeof(uint32_t) * GG_SCREEN_WIDTH)
-        FATAL("SDL returned an unexpected texture pitch: %d, expected %zu",
-            pitch, sizeof(uint32_t) * GG_SCREEN_WIDTH);
-    memcpy(pixels, emu.pixels, sizeof(uint32_t) * GG_SCREEN_WIDTH * GG_SCREEN_HEIGHT);
-    SDL_UnlockTexture(emu.texture);
+    SDL_Event event;
+    memset(&event, 0, sizeof(event));
+    event.type = emu.frame_event;
+    event.user.code = code;
+    if (SDL_PushEvent(&event) < 0)
+        ERROR("SDL failed to push an event: %s", SDL_GetError());
+}
+
+/*
+    Hand a finished frame to the presenter. Called on the emulation thread.
+
+    Frames pass through three locked textures without being copied: the
+    GameGear draws into the back one, the presenter shows the front one, and
+    the middle one holds the newest finished frame. Publishing swaps the back
+    and middle textures, so the emulator never waits on the presenter; a frame
+    it hasn't gotten to yet is simply replaced.
+
+    With the software scaler, the GameGear draws into its own buffer instead,
+    and the scaler fills the back texture from that.
+*/
+static void publish_frame(GameGear *gg)
+{
+    if (emu.scaling)
+        scaler_run(&emu.scaler, emu.pixels, emu.buffers[emu.back],
+                   emu.pitches[emu.back]);
+
+    unsigned old = atomic_exchange(&emu.middle, emu.back | FRAME_FRESH);
+    emu.back = old & ~FRAME_FRESH;
+    if (!emu.scaling)
+        gamegear_attach_display(gg, emu.buffers[emu.back],
+                                emu.pitches[emu.back]);
+    send_event(EVENT_FRAME);
+}
 
+/*
+    Draw the last frame shown to the window again, or just clear it if there
+    hasn't been one yet. Called on the main thread.
+*/
+static void redraw_frame()
+{
     SDL_SetRenderDrawColor(emu.renderer, 0x00, 0x00, 0x00, 0xFF);
     SDL_RenderClear(emu.renderer);
-    SDL_RenderCopy(emu.renderer, emu.texture, NULL, NULL);
+    if (emu.front_shown)
+        SDL_RenderCopy(emu.renderer, emu.textures[emu.front], NULL, NULL);
     SDL_RenderPresent(emu.renderer);
 }
 
+/*
+    Show the newest finished frame, if it hasn't been shown yet. Called on the
+    main thread.
+
+    The front texture stays unlocked after it's drawn, so it can be drawn
+    again when the window needs repainting. It's relocked before it can
+    become the middle one again, so the emulator always gets a locked texture
+    when it swaps.
+*/
+static void show_frame()
+{
+    if (!(atomic_load(&emu.middle) & FRAME_FRESH))
+        return;
+
+    if (emu.front_shown)
+        lock_texture(emu.front);
+    emu.front = atomic_exchange(&emu.middle, emu.front) & ~FRAME_FRESH;
+    SDL_UnlockTexture(emu.textures[emu.front]);
+    emu.front_shown = true;
+    redraw_frame();
+}
+
+/*
+    Queue a button press or release for the emulation thread. Called on the
+    main thread.
+*/
+static void push_input(GGButton button, bool state)
+{
+    InputQueue *queue = &emu.input;
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+    if (head - atomic_load_explicit(&queue->tail, memory_order_acquire) ==
+            INPUT_QUEUE_SIZE) {
+        WARN("input queue is full; dropping a button press")
+        return;
+    }
+    queue->items[head % INPUT_QUEUE_SIZE] = (InputEvent) {button, state};
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+}
+
+/*
+    Pass all queued button presses to the GameGear. Called on the emulation
+    thread.
+*/
+static void read_input(GameGear *gg)
+{
+    InputQueue *queue = &emu.input;
+    unsigned tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    while (tail != head) {
+        InputEvent event = queue->items[tail++ % INPUT_QUEUE_SIZE];
+        gamegear_input(gg, event.button, event.state);
+    }
+    atomic_store_explicit(&queue->tail, tail, memory_order_release);
+}
+
+/*
+    Nudge the audio rate by how far the ring has fallen below its target.
+
+    When the host can't quite keep up, this stretches the audio slightly
+    instead of letting the device run dry and crackle; it's too small a
+    change in pitch to hear. Above the target, nothing changes, since the
+    emulation thread waits for the device instead.
+*/
+static void adjust_audio_rate(GameGear *gg, unsigned fill)
+{
+    double shortfall = 0;
+
+    if (fill < emu.audio_target)
+        shortfall = (double) (emu.audio_target - fill) / emu.audio_target;
+    gamegear_adjust_audio_rate(gg, 1 + AUDIO_MAX_SKEW * shortfall);
+}
+
+/*
+    Tell the GameGear how far it has fallen behind the audio device, for
+    automatic frameskip: how long the device would take to play the shortfall
+    below the ring's target.
+*/
+static void report_audio_lag(GameGear *gg, unsigned fill)
+{
+    uint64_t lag_ns = 0;
+
+    if (fill < emu.audio_target)
+        lag_ns = (uint64_t) (emu.audio_target - fill) * 1000000000 /
+            emu.audio_rate;
+    if (lag_ns >= 1e9 / GG_FPS)
+        emu.audio_behind++;
+    gamegear_set_lag(gg, lag_ns);
+}
+
+/*
+    Push the last frame's audio into the ring, then wait until the device has
+    played it down to the target fill. Called on the emulation thread.
+
+    This paces emulation by the audio device's clock, so sound never drifts
+    from the game. When fast-forwarding, nothing waits, and audio that doesn't
+    fit in the ring is dropped.
+*/
+static void queue_audio(GameGear *gg)
+{
+    AudioRing *ring = &emu.audio;
+    size_t count;
+    const int16_t *samples = gamegear_get_audio(gg, &count);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned room = AUDIO_RING_SIZE - audio_fill();
+
+    if (count > room)
+        count = room;
+    for (size_t i = 0; i < count; i++) {
+        unsigned index = (head + i) % AUDIO_RING_SIZE;
+        ring->items[2 * index]     = samples[2 * i];
+        ring->items[2 * index + 1] = samples[2 * i + 1];
+    }
+    atomic_store_explicit(&ring->head, head + count, memory_order_release);
+
+    if (atomic_load(&emu.fast_forward)) {
+        gamegear_adjust_audio_rate(gg, 1);
+        return;
+    }
+    unsigned fill = audio_fill();
+    adjust_audio_rate(gg, fill);
+    report_audio_lag(gg, fill);
+    while (audio_fill() > emu.audio_target && !atomic_load(&emu.quit)) {
+        // If the device stops playing (say, it was unplugged), don't hang:
+        if (SDL_SemWaitTimeout(emu.audio_drained, AUDIO_WAIT_MS) ==
+                SDL_MUTEX_TIMEDOUT)
+            break;
+    }
+}
+
 /*
     Handle a keyboard press; translate it into a Game Gear button press.
 */
-static void handle_keypress(GameGear *gg, SDL_Keycode key, bool state)
+static void handle_keypress(SDL_Keycode key, bool state)
 {
     GGButton button;
     switch (key) {
@@ -206,17 +599,31 @@ static void handle_keypress(GameGear *gg, SDL_Keycode key, bool state)
         case SDLK_RETURN2:
         case SDLK_ESCAPE:
             button = BUTTON_START;     break;
+        case SDLK_TAB:
+            if (state) {
+                bool on = !atomic_load(&emu.fast_forward);
+                atomic_store(&emu.fast_forward, on);
+            }
+            return;
+        case SDLK_F5:
+            if (state)
+                atomic_store(&emu.state_request, STATE_SAVE);
+            return;
+        case SDLK_F9:
+            if (state)
+                atomic_store(&emu.state_request, STATE_LOAD);
+            return;
         default:
             return;
     }
-    gamegear_input(gg, button, state);
+    push_input(button, state);
 }
 
 /*
     Handle controller input.
 */
 static void handle_controller_input(
-    GameGear *gg, SDL_GameControllerButton input, bool state)
+    SDL_GameControllerButton input, bool state)
 {
     GGButton button;
     switch (input) {
@@ -237,7 +644,7 @@ static void handle_controller_input(
         default:
             return;
     }
-    gamegear_input(gg, button, state);
+    push_input(button, state);
 }
 
 /*
@@ -309,45 +716,236 @@ static void handle_controller_removed(int id)
 }
 
 /*
-    Handle SDL events, mainly quit events and button presses.
+    Handle a window event. Unchanged frames aren't presented again, so when
+    the window is exposed or resized, repaint it with the last frame shown.
+*/
+static void handle_window_event(uint8_t type)
+{
+    switch (type) {
+        case SDL_WINDOWEVENT_EXPOSED:
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+            redraw_frame();
+            break;
+    }
+}
+
+/*
+    Handle an SDL event, mainly quit events and button presses.
+*/
+static void handle_event(const SDL_Event *event)
+{
+    switch (event->type) {
+        case SDL_QUIT:
+            atomic_store(&emu.quit, true);
+            break;
+        case SDL_WINDOWEVENT:
+            handle_window_event(event->window.event);
+            break;
+        case SDL_KEYDOWN:
+            handle_keypress(event->key.keysym.sym, true);
+            break;
+        case SDL_KEYUP:
+            handle_keypress(event->key.keysym.sym, false);
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+            handle_controller_input(event->cbutton.button, true);
+            break;
+        case SDL_CONTROLLERBUTTONUP:
+            handle_controller_input(event->cbutton.button, false);
+            break;
+        case SDL_CONTROLLERDEVICEADDED:
+            handle_controller_added(event->cdevice.which);
+            break;
+        case SDL_CONTROLLERDEVICEREMOVED:
+            handle_controller_removed(event->cdevice.which);
+            break;
+    }
+}
+
+/*
+    Main loop of the presenter: show frames and handle input as they come in,
+    until the emulation thread stops.
+
+    Presenting may block on vsync, but only this thread waits for it.
 */
-static void handle_events(GameGear *gg)
+static void present()
 {
     SDL_Event event;
-    while (SDL_PollEvent(&event)) {
-        switch (event.type) {
-            case SDL_QUIT:
-                gamegear_power_off(gg);
-                return;
-            case SDL_KEYDOWN:
-                handle_keypress(gg, event.key.keysym.sym, true);
-                break;
-            case SDL_KEYUP:
-                handle_keypress(gg, event.key.keysym.sym, false);
-                break;
-            case SDL_CONTROLLERBUTTONDOWN:
-                handle_controller_input(gg, event.cbutton.button, true);
-                break;
-            case SDL_CONTROLLERBUTTONUP:
-                handle_controller_input(gg, event.cbutton.button, false);
-                break;
-            case SDL_CONTROLLERDEVICEADDED:
-                handle_controller_added(event.cdevice.which);
-                break;
-            case SDL_CONTROLLERDEVICEREMOVED:
-                handle_controller_removed(event.cdevice.which);
-                break;
-        }
+    while (SDL_WaitEvent(&event)) {
+        if (event.type != emu.frame_event)
+            handle_event(&event);
+        else if (event.user.code == EVENT_STOPPED)
+            return;
+        else
+            show_frame();
     }
+    ERROR("SDL failed to wait for an event: %s", SDL_GetError());
+    atomic_store(&emu.quit, true);
+}
+
+/*
+    Count a completed frame against the frame limit, if one was given, and
+    power off the GameGear once it is reached.
+*/
+static void count_frame(GameGear *gg)
+{
+    if (emu.frames_left && !--emu.frames_left)
+        gamegear_power_off(gg);
 }
 
 /*
-    GameGear callback: Draw the current frame and handle SDL event logic.
+    Save or load the game's state, if F5 or F9 was pressed. Called on the
+    emulation thread, between frames.
+*/
+static void handle_state_request(GameGear *gg)
+{
+    switch (atomic_exchange(&emu.state_request, STATE_NONE)) {
+        case STATE_SAVE:
+            if (gamegear_save_state_file(gg, emu.state_path))
+                DEBUG("Saved state to '%s'", emu.state_path)
+            break;
+        case STATE_LOAD:
+            if (gamegear_load_state_file(gg, emu.state_path))
+                DEBUG("Loaded state from '%s'", emu.state_path)
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+    GameGear callback: Publish the current frame and apply queued input.
+
+    Skipped and unchanged frames aren't published, since there's nothing new
+    to show; this saves uploading and presenting them on static screens. When
+    blending frames, the one after a change is still new (it no longer has
+    the old frame mixed in), so that one is published too.
 */
 static void frame_callback(GameGear *gg)
 {
-    draw_frame();
-    handle_events(gg);
+    bool changed = gamegear_frame_changed(gg);
+
+    if (changed || emu.blend_pending)
+        publish_frame(gg);
+    emu.blend_pending = changed && emu.scaling && emu.scaler.blend;
+    if (emu.audio_device)
+        queue_audio(gg);
+    read_input(gg);
+    handle_state_request(gg);
+    gamegear_set_fast_forward(gg, atomic_load(&emu.fast_forward));
+    if (atomic_load(&emu.quit))
+        gamegear_power_off(gg);
+    count_frame(gg);
+}
+
+/*
+    Main function of the emulation thread.
+*/
+static void* emulation_main(void *arg)
+{
+    gamegear_simulate(arg);
+    send_event(EVENT_STOPPED);
+    return NULL;
+}
+
+/*
+    Run the GameGear on its own thread while this one presents its frames.
+
+    SDL's video and event functions must be called from the main thread, so
+    that's where the presenter runs. Audio plays from SDL's own thread.
+*/
+static void simulate_threaded()
+{
+    pthread_t thread;
+
+    if (pthread_create(&thread, NULL, emulation_main, emu.gg))
+        FATAL("couldn't start the emulation thread")
+    if (emu.audio_device)
+        SDL_PauseAudioDevice(emu.audio_device, 0);
+    present();
+    pthread_join(thread, NULL);
+}
+
+/*
+    GameGear callback for headless mode: nothing to draw or poll.
+*/
+static void headless_callback(GameGear *gg)
+{
+    count_frame(gg);
+}
+
+/*
+    Set up headless mode, which uses no SDL at all.
+
+    The VDP still draws into an off-screen buffer and audio is still resampled
+    for the host, so both are included in benchmarks, but frames are run
+    back-to-back instead of at 60 per second.
+*/
+static void setup_headless(Config *config)
+{
+    emu.pixels = cr_malloc(
+        sizeof(uint32_t) * GG_SCREEN_WIDTH * GG_SCREEN_HEIGHT);
+
+    gamegear_attach_display(emu.gg, emu.pixels, 0);
+    gamegear_set_audio_rate(emu.gg, AUDIO_RATE);
+    gamegear_set_throttle(emu.gg, false);
+    gamegear_set_profiling(emu.gg, config->benchmark);
+}
+
+/*
+    Print the results of a benchmark: how fast frames were emulated, and how
+    the host's time was split between the CPU, the VDP, audio, and
+    everything else.
+*/
+static void print_benchmark(const GameGear *gg)
+{
+    const GGStats *stats = gamegear_get_stats(gg);
+    if (!stats->frames) {
+        WARN("no frames were emulated; nothing to report")
+        return;
+    }
+
+    double frames = stats->frames, total = stats->frame_ns;
+    double fps = frames / (total / 1e9);
+    double other = total - stats->cpu_ns - stats->vdp_ns - stats->psg_ns;
+
+    printf("crater: benchmark: %" PRIu64 " frames in %.3f seconds\n",
+           stats->frames, total / 1e9);
+    printf("    speed:  %10.1f fps (%.2fx real time)\n", fps, fps / GG_FPS);
+    printf("    frame:  %10.0f ns\n", total / frames);
+    printf("    cpu:    %10.0f ns (%.1f%%)\n",
+           stats->cpu_ns / frames, 100 * stats->cpu_ns / total);
+    printf("    vdp:    %10.0f ns (%.1f%%)\n",
+           stats->vdp_ns / frames, 100 * stats->vdp_ns / total);
+    printf("    audio:  %10.0f ns (%.1f%%)\n",
+           stats->psg_ns / frames, 100 * stats->psg_ns / total);
+    printf("    other:  %10.0f ns (%.1f%%)\n",
+           other / frames, 100 * other / total);
+    if (stats->skipped)
+        printf("    skipped: %" PRIu64 " frames (%.1f%%)\n",
+               stats->skipped, 100 * stats->skipped / frames);
+    if (stats->unchanged)
+        printf("    unchanged: %" PRIu64 " frames (%.1f%%)\n",
+               stats->unchanged, 100 * stats->unchanged / frames);
+}
+
+/*
+    @DEBUG_LEVEL
+    Print how steadily the GameGear's throttle paced frames to real time, if
+    it did. (Frames paced by the audio device are reported when it's closed.)
+*/
+static void print_pacing(const GameGear *gg)
+{
+    const PacerStats *stats = gamegear_get_pacing(gg);
+    if (!stats->waits)
+        return;
+
+    DEBUG("Pacing: waited for %" PRIu64 " frames, woke up %.1f us late on "
+          "average (%.1f us at worst)", stats->waits,
+          stats->jitter_total_ns / 1e3 / stats->waits,
+          stats->jitter_max_ns / 1e3)
+    DEBUG("Pacing: %" PRIu64 " frames started late, %" PRIu64 " of them too "
+          "late to catch up", stats->late, stats->stalls)
 }
 
 /*
@@ -355,8 +953,27 @@ static void frame_callback(GameGear *gg)
 */
 static void cleanup_sdl()
 {
-    free(emu.pixels);
-    SDL_DestroyTexture(emu.texture);
+    gamegear_attach_display(emu.gg, NULL, 0);
+    if (emu.audio_device) {
+        SDL_CloseAudioDevice(emu.audio_device);
+        SDL_DestroySemaphore(emu.audio_drained);
+        DEBUG("Audio device ran dry %u times", atomic_load(&emu.underruns))
+        DEBUG("Pacing: paced by the audio device, fell a frame or more "
+              "behind it on %lu frames", emu.audio_behind)
+        emu.audio_device = 0;
+    }
+    for (unsigned i = 0; i < 3; i++) {
+        if (i != emu.front || !emu.front_shown)
+            SDL_UnlockTexture(emu.textures[i]);
+        SDL_DestroyTexture(emu.textures[i]);
+    }
+    emu.front_shown = false;
+    if (emu.scaling) {
+        scaler_free(&emu.scaler);
+        free(emu.pixels);
+        emu.pixels = NULL;
+        emu.scaling = false;
+    }
     SDL_DestroyRenderer(emu.renderer);
     SDL_DestroyWindow(emu.window);
     for (int i = 0; i < emu.controllers.num; i++)
@@ -367,7 +984,7 @@ static void cleanup_sdl()
 
     emu.window = NULL;
     emu.renderer = NULL;
-    emu.texture = NULL;
+    emu.textures[0] = emu.textures[1] = emu.textures[2] = NULL;
     emu.controllers.items = NULL;
     emu.controllers.num = emu.controllers.capacity = 0;
 }
@@ -392,27 +1009,58 @@ void emulate(ROM *rom, Config *config)
     }
 
     emu.gg = gamegear_create();
+    if (config->jit && !gamegear_set_jit(emu.gg,
+            config->jit_verify ? Z80_JIT_VERIFY : Z80_JIT_ON))
+        WARN("JIT is not available on this system; using the interpreter")
+    if (config->threaded && !gamegear_set_render_thread(emu.gg, true))
+        WARN("couldn't start the render thread; drawing on the main thread")
     signal(SIGINT, handle_sigint);
-    setup_sdl(config);
+    if (config->headless)
+        setup_headless(config);
+    else
+        setup_sdl(config);
 
-    gamegear_attach_callback(emu.gg, frame_callback);
-    gamegear_attach_display(emu.gg, emu.pixels);
+    emu.frames_left = config->frames;
+    gamegear_attach_callback(emu.gg,
+        config->headless ? headless_callback : frame_callback);
     gamegear_load_rom(emu.gg, rom);
     if (bios)
         gamegear_load_bios(emu.gg, bios);
     if (!config->no_saving)
         gamegear_load_save(emu.gg, &save);
+    if (config->resume)
+        gamegear_load_state_file(emu.gg, config->state_path);
 
-    gamegear_simulate(emu.gg);
+    atomic_store(&emu.quit, false);
+    atomic_store(&emu.fast_forward, config->fast_forward);
+    atomic_store(&emu.state_request, STATE_NONE);
+    emu.state_path = config->state_path;
+    gamegear_set_spin(emu.gg, config->spin);
+    gamegear_set_fast_forward(emu.gg, config->fast_forward);
+    gamegear_set_frameskip(emu.gg, config->frameskip == FRAMESKIP_AUTO ?
+                           GG_FRAMESKIP_AUTO : config->frameskip);
+    if (config->headless)
+        gamegear_simulate(emu.gg);
+    else
+        simulate_threaded();
 
     if (gamegear_get_exception(emu.gg))
         ERROR("caught exception: %s", gamegear_get_exception(emu.gg))
-    else
+    else if (!config->frames || emu.frames_left)
         WARN("caught signal, stopping...")
-    if (DEBUG_LEVEL)
+    if (DEBUG_LEVEL) {
         gamegear_print_state(emu.gg);
+        print_pacing(emu.gg);
+    }
+    if (config->benchmark)
+        print_benchmark(emu.gg);
 
-    cleanup_sdl();
+    if (config->headless) {
+        free(emu.pixels);
+        emu.pixels = NULL;
+    } else {
+        cleanup_sdl();
+    }
     signal(SIGINT, SIG_DFL);
     gamegear_destroy(emu.gg);
     emu.gg = NULL;
@@ -1,21 +1,25 @@
 /* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
    Released under the terms of the MIT License. See LICENSE for details. */
 
+#include <fcntl.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include "gamegear.h"
 #include "logging.h"
 #include "util.h"
 
-/* Clock speed in Hz was taken from the official Sega GG documentation */
-#define CPU_CLOCK_SPEED (3579545.)
-#define CYCLES_PER_FRAME (CPU_CLOCK_SPEED / GG_FPS)
-#define CYCLES_PER_LINE (CYCLES_PER_FRAME / VDP_LINES_PER_FRAME)
-#define NS_PER_FRAME (1000 * 1000 * 1000 / GG_FPS)
+#define NS_PER_FRAME ((uint64_t) (1000 * 1000 * 1000 / GG_FPS))
+#define PSG_RATE ((double) GG_CLOCK_SPEED / PSG_CLOCK_DIVIDER)
 
 #define SET_EXC(...) snprintf(gg->exc_buffer, GG_EXC_BUFF_SIZE, __VA_ARGS__);
 
+static void apply_state(GameGear*, const GGState*);
+
 /*
     Create and return a pointer to a new GameGear object.
 
@@ -29,13 +33,22 @@ GameGear* gamegear_create()
     GameGear *gg = cr_malloc(sizeof(GameGear));
     mmu_init(&gg->mmu);
     vdp_init(&gg->vdp);
-    psg_init(&gg->psg);
+    psg_init(&gg->psg, &gg->cpu.clock);
     io_init(&gg->io, &gg->mmu, &gg->vdp, &gg->psg);
     z80_init(&gg->cpu, &gg->mmu, &gg->io);
 
     gg->powered = false;
+    gg->throttled = true;
+    gg->profiling = false;
+    gg->fast_forward = false;
+    gg->frameskip = 0;
+    gg->audio_rate = 0;
+    gg->audio = NULL;
     gg->callback = NULL;
+    gg->rom = NULL;
+    gg->resume = NULL;
     gg->exc_buffer[0] = '\0';
+    pacer_init(&gg->pacer, GG_FPS);
     return gg;
 }
 
@@ -46,9 +59,12 @@ GameGear* gamegear_create()
 */
 void gamegear_destroy(GameGear *gg)
 {
+    z80_free(&gg->cpu);
     mmu_free(&gg->mmu);
     vdp_free(&gg->vdp);
     psg_free(&gg->psg);
+    gamegear_set_audio_rate(gg, 0);
+    free(gg->resume);
     free(gg);
 }
 
@@ -64,6 +80,7 @@ void gamegear_load_rom(GameGear *gg, const ROM *rom)
     if (gg->powered)
         return;
     mmu_load_rom(&gg->mmu, rom->data, rom->size);
+    gg->rom = rom;
 }
 
 /*
@@ -104,21 +121,292 @@ void gamegear_input(GameGear *gg, GGButton button, bool state)
         io_set_button(&gg->io, button, state);
 }
 
+/*
+    Set whether the GameGear is throttled to real time (the default).
+
+    An unthrottled GameGear runs frames back-to-back as fast as the host can
+    manage, which is mainly useful for headless testing and benchmarking.
+*/
+void gamegear_set_throttle(GameGear *gg, bool throttled)
+{
+    gg->throttled = throttled;
+}
+
+/*
+    Tell an unthrottled GameGear how far behind real time it is, in
+    nanoseconds, for automatic frameskip.
+
+    This is for hosts that pace emulation themselves (by an audio device's
+    clock, say) instead of with the GameGear's throttle, which works this out
+    on its own. Call it from the frame callback; the value holds until the
+    next call.
+*/
+void gamegear_set_lag(GameGear *gg, uint64_t lag_ns)
+{
+    gg->lag_ns = lag_ns;
+}
+
+/*
+    Set whether a throttled GameGear spins through the last moments before
+    each frame instead of sleeping.
+
+    This keeps frames more evenly spaced than the host's sleeps alone can,
+    at the cost of some CPU time.
+*/
+void gamegear_set_spin(GameGear *gg, bool spin)
+{
+    pacer_set_spin(&gg->pacer, spin);
+}
+
+/*
+    Set how many frames to skip drawing for every one that is drawn.
+
+    Skipped frames are emulated in full, display aside, so games run the same.
+    GG_FRAMESKIP_AUTO skips frames only while emulation is behind real time,
+    and never more than GG_MAX_AUTO_SKIP in a row.
+*/
+void gamegear_set_frameskip(GameGear *gg, int frameskip)
+{
+    gg->frameskip = frameskip;
+}
+
+/*
+    Set whether the GameGear is fast-forwarding.
+
+    A fast-forwarding GameGear runs unthrottled, like gamegear_set_throttle()
+    with false, but only draws as many frames as real time would show,
+    regardless of the frameskip setting. This can be changed at any time,
+    including from the frame callback.
+*/
+void gamegear_set_fast_forward(GameGear *gg, bool fast_forward)
+{
+    gg->fast_forward = fast_forward;
+}
+
+/*
+    Set whether the GameGear records how long the CPU and VDP take to run.
+
+    This adds a little overhead, so it is off by default. The results are
+    available from gamegear_get_stats().
+*/
+void gamegear_set_profiling(GameGear *gg, bool profiling)
+{
+    gg->profiling = profiling;
+}
+
+/*
+    Set the sample rate, in Hz, that the GameGear's audio is produced at.
+
+    The PSG's output is resampled to this rate at the end of every frame.
+    0 (the default) turns resampling off, leaving audio at the PSG's native
+    rate. This allocates, so it should be called before powering on rather
+    than from the frame callback.
+*/
+void gamegear_set_audio_rate(GameGear *gg, unsigned rate)
+{
+    if (gg->audio_rate) {
+        resampler_free(&gg->resampler);
+        free(gg->audio);
+        gg->audio = NULL;
+    }
+
+    gg->audio_rate = rate;
+    gg->audio_count = 0;
+    if (rate) {
+        resampler_init(&gg->resampler, PSG_RATE, rate);
+        gg->audio = cr_malloc(sizeof(int16_t) * 2 *
+            resampler_max_output(&gg->resampler, PSG_BUFFER_TICKS));
+    }
+}
+
+/*
+    Scale the audio rate by a factor close to 1, to speed up or slow down the
+    audio slightly without changing its pitch noticeably.
+
+    This is for keeping up with the host's audio device, and is cheap enough
+    to call every frame; it has no effect if no audio rate is set.
+*/
+void gamegear_adjust_audio_rate(GameGear *gg, double factor)
+{
+    if (gg->audio_rate)
+        resampler_set_rates(&gg->resampler, PSG_RATE,
+                            gg->audio_rate * factor);
+}
+
+/*
+    Return whether drawing the last frame was skipped.
+
+    Meant for the frame callback: if this is true, the display holds whatever
+    was drawn into it before, not the frame just emulated.
+*/
+bool gamegear_frame_skipped(const GameGear *gg)
+{
+    return gg->vdp.skip;
+}
+
+/*
+    Return whether the last frame was drawn and may differ from the one drawn
+    before it.
+
+    Meant for the frame callback: if this is false, the display holds the same
+    image as last time, so there's no need to show it again. Static screens,
+    like menus and pauses, often go many frames without changing.
+*/
+bool gamegear_frame_changed(const GameGear *gg)
+{
+    return !gg->vdp.skip && vdp_frame_changed(&gg->vdp);
+}
+
+/*
+    Return performance statistics since the GameGear was last powered on.
+
+    Frame counts and host time per frame are always recorded; the CPU and VDP
+    times are only recorded while profiling is enabled.
+*/
+const GGStats* gamegear_get_stats(const GameGear *gg)
+{
+    return &gg->stats;
+}
+
+/*
+    Return frame pacing statistics since the GameGear was last powered on.
+
+    These cover frames that were throttled to real time: how many the GameGear
+    waited for, how late it woke up for them (jitter), and how many it was
+    already late for, or so late that it gave up catching up (stalls).
+*/
+const PacerStats* gamegear_get_pacing(const GameGear *gg)
+{
+    return &gg->pacer.stats;
+}
+
+/*
+    Return the audio produced during the last frame.
+
+    This is valid from the frame callback until the next frame starts: count
+    is set to the number of samples, each an interleaved pair of signed
+    16-bit left and right values, at the rate given to
+    gamegear_set_audio_rate(), or if none was, the PSG's native rate of
+    GG_CLOCK_SPEED / PSG_CLOCK_DIVIDER (about 223.7 kHz).
+*/
+const int16_t* gamegear_get_audio(const GameGear *gg, size_t *count)
+{
+    if (gg->audio_rate) {
+        *count = gg->audio_count;
+        return gg->audio;
+    }
+    *count = gg->psg.sample_count;
+    return gg->psg.samples;
+}
+
+/*
+    Return the master clock time (in CPU cycles) at which the given scanline
+    ends, counting from power-on.
+
+    The CPU finishes whichever instruction crosses the end of the line, so
+    each line really runs a few cycles long, and the next a little short.
+*/
+static inline uint64_t get_line_end(uint64_t line)
+{
+    return line * GG_CYCLES_PER_LINE;
+}
+
+/*
+    Add an event to the scheduler's queue, to be run at the given time.
+
+    The queue is kept sorted by time. Events due at the same time run in order
+    of their kind, so a frame always ends after its last scanline.
+*/
+static void schedule_event(GGScheduler *sched, GGEventKind kind, uint64_t time)
+{
+    uint8_t i = sched->count++;
+    while (i > 0 && (sched->events[i - 1].time > time ||
+            (sched->events[i - 1].time == time &&
+             sched->events[i - 1].kind > kind))) {
+        sched->events[i] = sched->events[i - 1];
+        i--;
+    }
+    sched->events[i].time = time;
+    sched->events[i].kind = kind;
+}
+
+/*
+    Remove the next event from the scheduler's queue and run it.
+
+    Each kind of event reschedules itself for its next occurrence.
+*/
+static void run_next_event(GameGear *gg)
+{
+    GGScheduler *sched = &gg->sched;
+    GGEventKind kind = sched->events[0].kind;
+
+    sched->count--;
+    for (uint8_t i = 0; i < sched->count; i++)
+        sched->events[i] = sched->events[i + 1];
+
+    switch (kind) {
+        case GG_EVENT_LINE:
+            vdp_simulate_line(&gg->vdp);
+            io_update_irq(&gg->io);
+            sched->lines++;
+            schedule_event(sched, kind, get_line_end(sched->lines + 1));
+            break;
+        case GG_EVENT_FRAME:
+            sched->frame_done = true;
+            schedule_event(sched, kind,
+                           get_line_end(sched->lines + VDP_LINES_PER_FRAME));
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+    Reset the event scheduler, queueing the first scanline and frame.
+
+    This must be called after the CPU is powered on, which resets its clock.
+*/
+static void power_scheduler(GGScheduler *sched)
+{
+    sched->count = 0;
+    sched->lines = 0;
+    sched->frame_done = false;
+    schedule_event(sched, GG_EVENT_LINE, get_line_end(1));
+    schedule_event(sched, GG_EVENT_FRAME, get_line_end(VDP_LINES_PER_FRAME));
+}
+
 /*
     Power on the GameGear.
 
     This clears the exception buffer and executes boot code (e.g. clearing
-    memory and setting initial register values).
+    memory and setting initial register values). If a state was loaded while
+    the GameGear was off, it picks up from there instead.
 */
 static void power_on(GameGear *gg)
 {
     gg->exc_buffer[0] = '\0';
     gg->powered = true;
+    gg->stats = (GGStats) {0};
+    gg->skip_run = 0;
+    gg->lag_ns = gg->last_drawn = 0;
+    pacer_reset(&gg->pacer);
 
     mmu_power(&gg->mmu);
     vdp_power(&gg->vdp);
     io_power(&gg->io);
     z80_power(&gg->cpu);
+    psg_power(&gg->psg);
+    if (gg->audio_rate) {
+        resampler_reset(&gg->resampler);
+        gg->audio_count = 0;
+    }
+    power_scheduler(&gg->sched);
+
+    if (gg->resume) {
+        apply_state(gg, gg->resume);
+        free(gg->resume);
+        gg->resume = NULL;
+    }
 }
 
 /*
@@ -146,12 +434,34 @@ void gamegear_attach_callback(GameGear *gg, GGFrameCallback callback)
 /*
     Set a display to written to whenever the GameGear draws a pixel.
 
-    The array must be (GG_SCREEN_WIDTH * GG_SCREEN_HEIGHT) pixels large, where
-    each pixel is a 32-bit integer in ARGB order (i.e., A is the top 8 bits).
+    The display has GG_SCREEN_HEIGHT rows of GG_SCREEN_WIDTH pixels, each row
+    starting pitch bytes after the previous one (or right after it, if pitch
+    is 0), so frontends can pass in memory they upload directly, like a locked
+    texture. By default, each pixel is a 32-bit integer in ARGB order (i.e., A
+    is the top 8 bits). Use gamegear_set_pixel_format() to pick another format.
+
+    The display can be swapped for another one from the frame callback; the
+    previous one is no longer written to once this returns.
 */
-void gamegear_attach_display(GameGear *gg, uint32_t *pixels)
+void gamegear_attach_display(GameGear *gg, void *pixels, size_t pitch)
 {
+    vdp_sync(&gg->vdp);
     gg->vdp.pixels = pixels;
+    gg->vdp.pitch = pitch;
+}
+
+/*
+    Set the format of pixels written to the display.
+
+    This lets the frontend receive pixels in the format it will draw them in:
+    VDP_PIXEL_ARGB8888 (the default), VDP_PIXEL_RGB565 (16-bit pixels), or
+    VDP_PIXEL_CUSTOM, where color_table maps each BGR444 color (0xBGR) to a
+    32-bit pixel. The table must stay alive while the GameGear uses it.
+*/
+void gamegear_set_pixel_format(GameGear *gg, VDPPixelFormat format,
+    const uint32_t *color_table)
+{
+    vdp_set_pixel_format(&gg->vdp, format, color_table);
 }
 
 /*
@@ -161,31 +471,136 @@ void gamegear_attach_display(GameGear *gg, uint32_t *pixels)
 */
 void gamegear_detach(GameGear *gg)
 {
+    vdp_sync(&gg->vdp);
     gg->callback = NULL;
     gg->vdp.pixels = NULL;
+    gg->vdp.pitch = 0;
+}
+
+/*
+    Set the CPU's JIT mode (one of the Z80_JIT_* constants).
+
+    Return false if the JIT isn't available on this host, in which case the
+    CPU keeps using the interpreter.
+*/
+bool gamegear_set_jit(GameGear *gg, uint8_t mode)
+{
+    return z80_set_jit(&gg->cpu, mode);
+}
+
+/*
+    Set whether the VDP draws the screen on a separate thread.
+
+    This lets drawing overlap with the CPU on hosts with more than one core.
+    Return false if the thread couldn't be started, in which case the VDP
+    keeps drawing on the emulation thread.
+*/
+bool gamegear_set_render_thread(GameGear *gg, bool threaded)
+{
+    return vdp_set_threaded(&gg->vdp, threaded);
 }
 
 /*
     Simulate the GameGear for one frame.
 
-    This function simulates the number of clock cycles corresponding to 1/60th
-    of a second. The return value indicates whether an exception flag has been
-    set somewhere. If true, emulation must be stopped.
+    This function simulates the clock cycles of one frame: 262 scanlines of 228
+    cycles each, or 59,736 cycles (about 16.7 ms, at 59.92 frames per second).
+    The return value indicates whether an exception flag has been set
+    somewhere. If true, emulation must be stopped.
+
+    The CPU runs uninterrupted from one scheduled event to the next, and the
+    other components catch up when each event fires.
 */
 static bool simulate_frame(GameGear *gg)
 {
-    size_t line;
-    bool except;
+    GGScheduler *sched = &gg->sched;
+
+    sched->frame_done = false;
+    while (!sched->frame_done) {
+        if (!gg->profiling) {
+            if (z80_run_until(&gg->cpu, sched->events[0].time))
+                return true;
+            run_next_event(gg);
+            continue;
+        }
 
-    for (line = 0; line < VDP_LINES_PER_FRAME; line++) {
-        except = z80_do_cycles(&gg->cpu, CYCLES_PER_LINE);
-        if (except)
+        uint64_t start = get_time_ns();
+        if (z80_run_until(&gg->cpu, sched->events[0].time))
             return true;
-        vdp_simulate_line(&gg->vdp);
+        uint64_t split = get_time_ns();
+        run_next_event(gg);
+        gg->stats.cpu_ns += split - start;
+        gg->stats.vdp_ns += get_time_ns() - split;
     }
     return false;
 }
 
+/*
+    Have the PSG finish the frame's audio and resample it to the audio rate,
+    if one is set.
+*/
+static void mix_audio_frame(GameGear *gg)
+{
+    size_t count = psg_end_frame(&gg->psg);
+    if (gg->audio_rate)
+        gg->audio_count = resampler_run(&gg->resampler, gg->psg.samples,
+                                        count, gg->audio);
+}
+
+/*
+    Finish the frame's audio, timing it if profiling.
+*/
+static void end_audio_frame(GameGear *gg)
+{
+    if (!gg->profiling) {
+        mix_audio_frame(gg);
+        return;
+    }
+
+    uint64_t start = get_time_ns();
+    mix_audio_frame(gg);
+    gg->stats.psg_ns += get_time_ns() - start;
+}
+
+/*
+    Decide whether to skip drawing the frame that starts at the given time.
+*/
+static bool should_skip_frame(GameGear *gg, uint64_t now)
+{
+    bool skip;
+
+    if (gg->fast_forward)
+        skip = now - gg->last_drawn < NS_PER_FRAME;
+    else if (gg->frameskip == GG_FRAMESKIP_AUTO)
+        skip = gg->lag_ns >= NS_PER_FRAME && gg->skip_run < GG_MAX_AUTO_SKIP;
+    else
+        skip = gg->skip_run < (unsigned) gg->frameskip;
+
+    if (skip) {
+        gg->skip_run++;
+    } else {
+        gg->skip_run = 0;
+        gg->last_drawn = now;
+    }
+    return skip;
+}
+
+/*
+    Wait until the next frame is due, if throttled, and note how far behind
+    real time we are, for automatic frameskip. If unthrottled, the lag is
+    whatever the host last reported with gamegear_set_lag().
+*/
+static void throttle_frame(GameGear *gg)
+{
+    if (!gg->throttled || gg->fast_forward) {
+        pacer_stop(&gg->pacer);
+        if (gg->fast_forward)
+            gg->lag_ns = 0;
+        return;
+    }
+    gg->lag_ns = pacer_wait(&gg->pacer);
+}
+
 /*
     Simulate the GameGear.
 
@@ -194,7 +609,9 @@ static bool simulate_frame(GameGear *gg)
     either by an exception occurring or someone calling gamegear_power_off().
 
     If a callback has been set with gamegear_set_callback(), then we'll trigger
-    it after every frame has been simulated (sixty times per second).
+    it after every frame has been simulated (about 60 times per second, unless
+    throttling was disabled with gamegear_set_throttle()), whether or not the
+    frame was drawn.
 
     Exceptions can be retrieved after this call with gamegear_get_exception().
     If the simulation ended normally, then that function will return NULL.
@@ -210,20 +627,245 @@ void gamegear_simulate(GameGear *gg)
     while (gg->powered) {
         uint64_t start = get_time_ns(), delta;
 
+        gg->vdp.skip = should_skip_frame(gg, start);
         if (simulate_frame(gg) || !gg->powered)
             break;
+        end_audio_frame(gg);
+        vdp_sync(&gg->vdp);
         if (gg->callback)
             gg->callback(gg);
 
         delta = get_time_ns() - start;
-        if (delta < NS_PER_FRAME)
-            usleep((NS_PER_FRAME - delta) / 1000);
+        gg->stats.frames++;
+        gg->stats.skipped += gg->vdp.skip;
+        gg->stats.unchanged += !gg->vdp.skip && !vdp_frame_changed(&gg->vdp);
+        gg->stats.frame_ns += delta;
+        throttle_frame(gg);
     }
 
+    vdp_sync(&gg->vdp);
     DEBUG("GameGear: powering off")
     gamegear_power_off(gg);
 }
 
+/*
+    Return the size of a save state, in bytes.
+
+    Every state is exactly this size: a GGState, laid out as it is in memory.
+    That makes states specific to the host's byte order and struct layout, as
+    well as to the version of the format, but loading one is just a few
+    copies, with no parsing.
+*/
+size_t gamegear_state_size()
+{
+    return sizeof(GGState);
+}
+
+/*
+    Fill in a save state's header, identifying the format and loaded ROM.
+*/
+static void make_state_header(const GameGear *gg, GGStateHeader *header)
+{
+    memcpy(header->magic, GG_STATE_MAGIC, GG_STATE_MAGIC_LEN);
+    header->version = GG_STATE_VERSION;
+    header->size = sizeof(GGState);
+    if (gg->rom) {
+        header->rom_size = gg->rom->size;
+        header->product_code = gg->rom->product_code;
+        header->checksum = gg->rom->expected_checksum;
+    }
+}
+
+/*
+    Check that a buffer holds a save state this GameGear can load.
+
+    Return NULL if it does, or else the reason it doesn't.
+*/
+static const char* check_state(const GameGear *gg, const void *buffer,
+                               size_t size)
+{
+    const GGState *state = buffer;
+    GGStateHeader header = {0};
+
+    if ((uintptr_t) buffer % _Alignof(GGState))
+        return "misaligned buffer";
+    if (size < sizeof(GGStateHeader))
+        return "too short";
+    if (memcmp(state->header.magic, GG_STATE_MAGIC, GG_STATE_MAGIC_LEN))
+        return "invalid header (was this state created by crater?)";
+    if (state->header.version != GG_STATE_VERSION)
+        return "unknown or unsupported state version";
+    if (state->header.size != sizeof(GGState) || size != sizeof(GGState))
+        return "state size is wrong; it may be corrupt or from another host";
+
+    make_state_header(gg, &header);
+    if (state->header.rom_size != header.rom_size ||
+            state->header.product_code != header.product_code ||
+            state->header.checksum != header.checksum)
+        return "state was created for a different ROM";
+
+    if (state->sched.count != GG_NUM_EVENTS ||
+            state->sched.events[0].kind >= GG_NUM_EVENTS ||
+            state->sched.events[1].kind >= GG_NUM_EVENTS ||
+            state->sched.events[0].kind == state->sched.events[1].kind ||
+            state->psg.time > state->cpu.clock / PSG_CLOCK_DIVIDER)
+        return "state is inconsistent; it may be corrupt";
+    return NULL;
+}
+
+/*
+    Restore every component from a save state that passed check_state().
+*/
+static void apply_state(GameGear *gg, const GGState *state)
+{
+    z80_load_state(&gg->cpu, &state->cpu);
+    mmu_load_state(&gg->mmu, &state->mmu);
+    vdp_load_state(&gg->vdp, &state->vdp);
+    io_load_state(&gg->io, &state->io);
+    psg_load_state(&gg->psg, &state->psg);
+    gg->sched = state->sched;
+}
+
+/*
+    Restore the GameGear from a save state that passed check_state(): right
+    away if it's running, or else once it's next powered on.
+*/
+static void restore_state(GameGear *gg, const GGState *state)
+{
+    if (gg->powered) {
+        apply_state(gg, state);
+        return;
+    }
+    if (!gg->resume)
+        gg->resume = cr_malloc(sizeof(GGState));
+    memcpy(gg->resume, state, sizeof(GGState));
+}
+
+/*
+    Take a save state of the GameGear, writing it to the given buffer.
+
+    The buffer must have room for gamegear_state_size() bytes, and be aligned
+    like memory from malloc() is. This is meant to be called from the frame
+    callback, or once the simulation has stopped; audio and scanlines from a
+    frame in progress aren't saved. Return whether the state was saved.
+*/
+bool gamegear_save_state(GameGear *gg, void *buffer, size_t size)
+{
+    GGState *state = buffer;
+
+    if (gg->cpu.except) {
+        ERROR("couldn't save state: the GameGear isn't running")
+        return false;
+    }
+    if (size < sizeof(GGState) || (uintptr_t) buffer % _Alignof(GGState)) {
+        ERROR("couldn't save state: buffer is too small or misaligned")
+        return false;
+    }
+
+    // Clear padding too, so the same state always has the same bytes:
+    memset(state, 0, sizeof(GGState));
+    make_state_header(gg, &state->header);
+    z80_save_state(&gg->cpu, &state->cpu);
+    mmu_save_state(&gg->mmu, &state->mmu);
+    vdp_save_state(&gg->vdp, &state->vdp);
+    psg_save_state(&gg->psg, &state->psg);
+    io_save_state(&gg->io, &state->io);
+    state->sched = gg->sched;
+    return true;
+}
+
+/*
+    Load a save state into the GameGear from the given buffer.
+
+    The state must come from gamegear_save_state() on a GameGear with the same
+    ROM loaded. While the GameGear is running, this must be called from the
+    frame callback, and takes effect right away; otherwise, the state is kept
+    until it is next powered on, so it resumes there instead of booting.
+    Return whether the state was loaded.
+*/
+bool gamegear_load_state(GameGear *gg, const void *buffer, size_t size)
+{
+    const char *reason = check_state(gg, buffer, size);
+    if (reason) {
+        ERROR("couldn't load state: %s", reason)
+        return false;
+    }
+
+    restore_state(gg, buffer);
+    return true;
+}
+
+/*
+    Take a save state of the GameGear and write it to the given file.
+
+    The same rules as gamegear_save_state() apply. Return whether the state
+    was saved.
+*/
+bool gamegear_save_state_file(GameGear *gg, const char *path)
+{
+    GGState *state = cr_malloc(sizeof(GGState));
+    bool saved = false;
+
+    if (gamegear_save_state(gg, state, sizeof(GGState))) {
+        FILE *fp = fopen(path, "wb");
+        if (!fp) {
+            ERROR_ERRNO("couldn't save state file '%s'", path)
+        } else {
+            saved = fwrite(state, sizeof(GGState), 1, fp) == 1;
+            if (fclose(fp))
+                saved = false;
+            if (!saved)
+                ERROR_ERRNO("couldn't write state file '%s'", path)
+        }
+    }
+    free(state);
+    return saved;
+}
+
+/*
+    Load a save state into the GameGear from the given file.
+
+    The file is mapped rather than read, so the state is copied straight from
+    the page cache into the GameGear. The same rules as gamegear_load_state()
+    apply. Return whether the state was loaded.
+*/
+bool gamegear_load_state_file(GameGear *gg, const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        ERROR_ERRNO("couldn't load state file '%s'", path)
+        return false;
+    }
+
+    struct stat s;
+    if (fstat(fd, &s) < 0) {
+        ERROR_ERRNO("couldn't load state file '%s'", path)
+        close(fd);
+        return false;
+    }
+    if ((size_t) s.st_size != sizeof(GGState)) {
+        ERROR("couldn't load state file '%s': wrong size", path)
+        close(fd);
+        return false;
+    }
+
+    void *map = mmap(NULL, sizeof(GGState), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        ERROR_ERRNO("couldn't load state file '%s'", path)
+        return false;
+    }
+
+    const char *reason = check_state(gg, map, sizeof(GGState));
+    if (reason) {
+        ERROR("couldn't load state file '%s': %s", path, reason)
+    } else {
+        restore_state(gg, map);
+    }
+    munmap(map, sizeof(GGState));
+    return !reason;
+}
+
 /*
     If an exception flag has been set in the GameGear, return the reason.
 
@@ -244,6 +886,10 @@ const char* gamegear_get_exception(GameGear *gg)
                 case Z80_EXC_UNIMPLEMENTED_OPCODE:
                     SET_EXC("unimplemented opcode: 0x%02X", gg->cpu.exc_data)
                     break;
+                case Z80_EXC_JIT_MISMATCH:
+                    SET_EXC("JIT disagrees with interpreter at PC=0x%04X",
+                            gg->cpu.regs.pc)
+                    break;
                 default:
                     SET_EXC("unknown exception")
                     break;
@@ -4,11 +4,14 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "io.h"
 #include "mmu.h"
+#include "pacer.h"
 #include "psg.h"
+#include "resampler.h"
 #include "rom.h"
 #include "save.h"
 #include "z80.h"
@@ -20,22 +23,90 @@
 #define GG_LOGICAL_WIDTH  (GG_SCREEN_WIDTH  * GG_PIXEL_WIDTH)
 #define GG_LOGICAL_HEIGHT (GG_SCREEN_HEIGHT * GG_PIXEL_HEIGHT)
 
-#define GG_FPS 60
+/* Clock speed in Hz was taken from the official Sega GG documentation */
+#define GG_CLOCK_SPEED 3579545
+
+/* NTSC timing: 228 CPU cycles per scanline, for about 59.92 frames/second */
+#define GG_CYCLES_PER_LINE 228
+#define GG_CYCLES_PER_FRAME (GG_CYCLES_PER_LINE * VDP_LINES_PER_FRAME)
+#define GG_FPS ((double) GG_CLOCK_SPEED / GG_CYCLES_PER_FRAME)
 #define GG_EXC_BUFF_SIZE 128
 
+#define GG_FRAMESKIP_AUTO -1
+#define GG_MAX_AUTO_SKIP 4
+
+/* Bump the state version whenever GGState, or anything in it, changes */
+#define GG_STATE_MAGIC "CRATERST"
+#define GG_STATE_MAGIC_LEN 8
+#define GG_STATE_VERSION 1
+
 /* Structs, etc. */
 
 struct GameGear;
 typedef void (*GGFrameCallback)(struct GameGear*);
 
+typedef enum {
+    GG_EVENT_LINE  = 0,
+    GG_EVENT_FRAME = 1,
+    GG_NUM_EVENTS
+} GGEventKind;
+
+typedef struct {
+    uint64_t time;
+    GGEventKind kind;
+} GGEvent;
+
+typedef struct {
+    GGEvent events[GG_NUM_EVENTS];
+    uint8_t count;
+    uint64_t lines;
+    bool frame_done;
+} GGScheduler;
+
+typedef struct {
+    char magic[GG_STATE_MAGIC_LEN];
+    uint32_t version;
+    uint32_t size;
+    uint32_t rom_size;
+    uint32_t product_code;
+    uint16_t checksum;
+} GGStateHeader;
+
+typedef struct {
+    GGStateHeader header;
+    Z80State cpu;
+    MMUState mmu;
+    VDPState vdp;
+    PSGState psg;
+    IOState io;
+    GGScheduler sched;
+} GGState;
+
+typedef struct {
+    uint64_t frames, skipped, unchanged;
+    uint64_t frame_ns, cpu_ns, vdp_ns, psg_ns;
+} GGStats;
+
 typedef struct GameGear {
     Z80 cpu;
     MMU mmu;
     VDP vdp;
     PSG psg;
     IO io;
-    bool powered;
+    Resampler resampler;
+    GGScheduler sched;
+    GGStats stats;
+    Pacer pacer;
+    bool powered, throttled, profiling, fast_forward;
+    int frameskip;
+    unsigned skip_run;
+    uint64_t lag_ns, last_drawn;
+    unsigned audio_rate;
+    int16_t *audio;
+    size_t audio_count;
     GGFrameCallback callback;
+    const ROM *rom;
+    GGState *resume;
     char exc_buffer[GG_EXC_BUFF_SIZE];
 } GameGear;
 
@@ -61,8 +132,30 @@ void gamegear_input(GameGear*, GGButton, bool);
 void gamegear_power_off(GameGear*);
 
 void gamegear_attach_callback(GameGear*, GGFrameCallback);
-void gamegear_attach_display(GameGear*, uint32_t*);
+void gamegear_attach_display(GameGear*, void*, size_t);
+void gamegear_set_pixel_format(GameGear*, VDPPixelFormat, const uint32_t*);
 void gamegear_detach(GameGear*);
+bool gamegear_set_jit(GameGear*, uint8_t);
+bool gamegear_set_render_thread(GameGear*, bool);
+void gamegear_set_throttle(GameGear*, bool);
+void gamegear_set_lag(GameGear*, uint64_t);
+void gamegear_set_spin(GameGear*, bool);
+void gamegear_set_frameskip(GameGear*, int);
+void gamegear_set_fast_forward(GameGear*, bool);
+void gamegear_set_profiling(GameGear*, bool);
+void gamegear_set_audio_rate(GameGear*, unsigned);
+void gamegear_adjust_audio_rate(GameGear*, double);
+bool gamegear_frame_skipped(const GameGear*);
+bool gamegear_frame_changed(const GameGear*);
+const GGStats* gamegear_get_stats(const GameGear*);
+const PacerStats* gamegear_get_pacing(const GameGear*);
+const int16_t* gamegear_get_audio(const GameGear*, size_t*);
+
+size_t gamegear_state_size();
+bool gamegear_save_state(GameGear*, void*, size_t);
+bool gamegear_load_state(GameGear*, const void*, size_t);
+bool gamegear_save_state_file(GameGear*, const char*);
+bool gamegear_load_state_file(GameGear*, const char*);
 
 const char* gamegear_get_exception(GameGear*);
 void gamegear_print_state(const GameGear*);
@@ -1,6 +1,8 @@
 /* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
    Released under the terms of the MIT License. See LICENSE for details. */
 
+#include <string.h>
+
 #include "io.h"
 #include "logging.h"
 
@@ -28,14 +30,19 @@ void io_power(IO *io)
 
     io->buttons = 0xFF;
     io->start = true;
+    io->irq = false;
 }
 
 /*
-    Return whether the IRQ line is currently active.
+    Update the state of the IRQ line from the VDP.
+
+    The line can only change when the VDP finishes a scanline or its control
+    port is accessed (reading the status clears the interrupt flags, and
+    register writes toggle interrupts), so this must be called after either.
 */
-bool io_check_irq(IO *io)
+void io_update_irq(IO *io)
 {
-    return vdp_assert_irq(io->vdp);
+    io->irq = vdp_assert_irq(io->vdp);
 }
 
 /*
@@ -97,7 +104,26 @@ static void write_system_port(IO *io, uint8_t port, uint8_t value)
 */
 static void write_memory_control(IO *io, uint8_t value)
 {
-    io->mmu->bios_enabled = !(value & 0x08);
+    mmu_enable_bios(io->mmu, !(value & 0x08));
+}
+
+/*
+    Read from the VDP's control port, which may clear its interrupt flags.
+*/
+static uint8_t read_vdp_control(IO *io)
+{
+    uint8_t status = vdp_read_control(io->vdp);
+    io_update_irq(io);
+    return status;
+}
+
+/*
+    Write to the VDP's control port, which may toggle its interrupts.
+*/
+static void write_vdp_control(IO *io, uint8_t value)
+{
+    vdp_write_control(io->vdp, value);
+    io_update_irq(io);
 }
 
 /*
@@ -116,7 +142,7 @@ uint8_t io_port_read(IO *io, uint8_t port)
     else if (port <= 0xBF && !(port % 2))
         return vdp_read_data(io->vdp);
     else if (port <= 0xBF)
-        return vdp_read_control(io->vdp);
+        return read_vdp_control(io);
     else if (port == 0xCD || port == 0xDC)
         return io->buttons;
     else if (port == 0xC1 || port == 0xDD)
@@ -141,5 +167,28 @@ void io_port_write(IO *io, uint8_t port, uint8_t value)
     else if (port <= 0xBF && !(port % 2))
         vdp_write_data(io->vdp, value);
     else if (port <= 0xBF)
-        vdp_write_control(io->vdp, value);
+        write_vdp_control(io, value);
+}
+
+/*
+    Save the state of the system ports, for restoring later with
+    io_load_state().
+
+    Buttons are left out; they belong to whoever is playing, not the game.
+*/
+void io_save_state(const IO *io, IOState *state)
+{
+    memcpy(state->ports, io->ports, sizeof(state->ports));
+}
+
+/*
+    Restore the system ports from a state saved by io_save_state().
+
+    This must be called after the VDP's state is restored, since the IRQ
+    line is recomputed from it.
+*/
+void io_load_state(IO *io, const IOState *state)
+{
+    memcpy(io->ports, state->ports, sizeof(io->ports));
+    io_update_irq(io);
 }
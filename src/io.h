@@ -19,14 +19,32 @@ typedef struct {
     uint8_t ports[6];
     uint8_t buttons;
     bool start;
+    bool irq;
 } IO;
 
+typedef struct {
+    uint8_t ports[6];
+} IOState;
+
 /* Functions */
 
 void io_init(IO*, MMU*, VDP*, PSG*);
 void io_power(IO*);
-bool io_check_irq(IO*);
+void io_update_irq(IO*);
 void io_set_button(IO*, uint8_t, bool);
 void io_set_start(IO*, bool);
 uint8_t io_port_read(IO*, uint8_t);
 void io_port_write(IO*, uint8_t, uint8_t);
+void io_save_state(const IO*, IOState*);
+void io_load_state(IO*, const IOState*);
+
+/*
+    Return whether the IRQ line is currently active.
+
+    This is polled by the CPU before every instruction, so it only reads the
+    line's last known state; see io_update_irq().
+*/
+static inline bool io_check_irq(const IO *io)
+{
+    return io->irq;
+}
@@ -9,6 +9,12 @@
 #include "util.h"
 #include "z80.h"
 
+static void update_page(MMU*, size_t);
+static void update_page_tables(MMU*);
+
+/* Page read in place of memory that isn't mapped; filled with 0xFF */
+static uint8_t unmapped_page[MMU_PAGE_SIZE];
+
 /*
     Initialize a MMU object. This must be called before using the MMU.
 */
@@ -21,13 +27,20 @@ void mmu_init(MMU *mmu)
     mmu->cart_ram_mapped = false;
     mmu->cart_ram_external = false;
     mmu->bios_enabled = false;
+    mmu->map_gen = 0;
     mmu->save = NULL;
 
+    memset(mmu->code_pages, false, sizeof(mmu->code_pages));
+    memset(mmu->code_gen, 0, sizeof(mmu->code_gen));
+    memset(unmapped_page, 0xFF, MMU_PAGE_SIZE);
+
     for (size_t slot = 0; slot < MMU_NUM_SLOTS; slot++)
         mmu->rom_slots[slot] = NULL;
 
     for (size_t bank = 0; bank < MMU_NUM_ROM_BANKS; bank++)
         mmu->rom_banks[bank] = NULL;
+
+    update_page_tables(mmu);
 }
 
 /*
@@ -128,13 +141,80 @@ void mmu_load_save(MMU *mmu, Save *save)
     }
 }
 
+/*
+    Return the host memory backing a 1 KB page of ROM, or the unmapped page.
+*/
+static inline const uint8_t* rom_page(const uint8_t *bank, uint16_t addr)
+{
+    return bank ? bank + (addr & (MMU_ROM_BANK_SIZE - 1)) : unmapped_page;
+}
+
+/*
+    Rebuild one page of the MMU's page tables from its current memory mapping.
+
+    Every page gets a read pointer. Only pages of RAM get a write pointer; the
+    others are left NULL so writes to them trap into mmu_write_trapped(). That
+    includes ROM, the last page of the RAM mirror (which holds the mapper
+    registers at 0xFFFC - 0xFFFF), and pages of RAM being watched for code.
+
+    Memory region information is based on:
+    - http://www.smspower.org/Development/MemoryMap
+    - http://www.smspower.org/Development/Mappers
+*/
+static void update_page(MMU *mmu, size_t page)
+{
+    uint16_t addr = page << MMU_PAGE_BITS;
+    const uint8_t *read;
+    uint8_t *write = NULL;
+
+    if (addr < 0x0400) {  // First kilobyte is unpaged, for interrupt handlers
+        if (mmu->bios_enabled && mmu->bios_rom)
+            read = mmu->bios_rom;
+        else
+            read = rom_page(mmu->rom_banks[0], addr);
+    } else if (addr < 0x4000) {  // Slot 0 (0x0400 - 0x3FFF)
+        read = rom_page(mmu->rom_slots[0], addr);
+    } else if (addr < 0x8000) {  // Slot 1 (0x4000 - 0x7FFF)
+        read = rom_page(mmu->rom_slots[1], addr);
+    } else if (addr < 0xC000) {  // Slot 2 (0x8000 - 0xBFFF)
+        if (mmu->cart_ram_mapped)
+            read = write = mmu->cart_ram_slot + (addr - 0x8000);
+        else
+            read = rom_page(mmu->rom_slots[2], addr);
+    } else {  // System RAM (0xC000 - 0xDFFF), mirrored (0xE000 - 0xFFFF)
+        read = write = mmu->system_ram + (addr & 0x1FFF);
+    }
+
+    if (page == MMU_NUM_PAGES - 1 || mmu->code_pages[page] ||
+            (addr >= 0xC000 && mmu->code_pages[page ^ 0x08]))
+        write = NULL;
+
+    mmu->read_map[page] = read;
+    mmu->write_map[page] = write;
+}
+
+/*
+    Rebuild all of the MMU's page tables; see update_page().
+*/
+static void update_page_tables(MMU *mmu)
+{
+    for (size_t page = 0; page < MMU_NUM_PAGES; page++)
+        update_page(mmu, page);
+}
+
 /*
     Map the given RAM slot to the given ROM bank.
+
+    The CPU keys its decoded instructions on the host address they came from
+    (see mmu_map_code()), so remapping a slot implicitly invalidates them; we
+    only bump the mapping generation to tell it to check again.
 */
 static inline void map_rom_slot(MMU *mmu, size_t slot, size_t bank)
 {
     TRACE("MMU mapping memory slot %zu to ROM bank 0x%02zX", slot, bank)
     mmu->rom_slots[slot] = mmu->rom_banks[bank];
+    mmu->map_gen++;
+    update_page_tables(mmu);
 }
 
 /*
@@ -152,62 +232,94 @@ void mmu_power(MMU *mmu)
 
     if (mmu->bios_rom)
         mmu->bios_enabled = true;
+    update_page_tables(mmu);
 }
 
 /*
-    Read a byte from a memory bank, or return 0xFF if the bank is not mapped.
+    Enable or disable the BIOS, which covers the first kilobyte of memory.
 */
-static inline uint8_t bank_byte_read(const uint8_t* bank, uint16_t addr)
+void mmu_enable_bios(MMU *mmu, bool enabled)
 {
-    return bank ? bank[addr] : 0xFF;
+    mmu->bios_enabled = enabled;
+    mmu->map_gen++;
+    update_page_tables(mmu);
 }
 
 /*
-    Read a byte of memory from the given address.
+    Return the host address backing the given address, or NULL if unmapped.
 
-    Memory region information is based on:
-    - http://www.smspower.org/Development/MemoryMap
-    - http://www.smspower.org/Development/Mappers
+    The CPU's decode cache uses this to identify the code at an address: it
+    changes whenever the containing slot is remapped to a different bank (or
+    the BIOS or cartridge RAM is toggled), so cached instructions from the old
+    mapping stop matching without needing to be flushed. Anything that changes
+    the mapping must increment map_gen so the CPU knows to check.
 */
-uint8_t mmu_read_byte(const MMU *mmu, uint16_t addr)
+const uint8_t* mmu_map_code(const MMU *mmu, uint16_t addr)
 {
-    if (addr < 0x0400) {  // First kilobyte is unpaged, for interrupt handlers
-        if (mmu->bios_enabled && mmu->bios_rom)
-            return mmu->bios_rom[addr];
-        return bank_byte_read(mmu->rom_banks[0], addr);
-    } else if (addr < 0x4000) {  // Slot 0 (0x0400 - 0x3FFF)
-        return bank_byte_read(mmu->rom_slots[0], addr);
-    } else if (addr < 0x8000) {  // Slot 1 (0x4000 - 0x7FFF)
-        return bank_byte_read(mmu->rom_slots[1], addr - 0x4000);
-    } else if (addr < 0xC000) {  // Slot 2 (0x8000 - 0xBFFF)
-        if (mmu->cart_ram_mapped)
-            return mmu->cart_ram_slot[addr - 0x8000];
-        return bank_byte_read(mmu->rom_slots[2], addr - 0x8000);
-    } else if (addr < 0xE000) {  // System RAM (0xC000 - 0xDFFF)
-        return mmu->system_ram[addr - 0xC000];
-    } else {  // System RAM, mirrored (0xE000 - 0xFFFF)
-        return mmu->system_ram[addr - 0xE000];
-    }
+    const uint8_t *page = mmu->read_map[addr >> MMU_PAGE_BITS];
+    if (page == unmapped_page)
+        return NULL;
+    return page + (addr & (MMU_PAGE_SIZE - 1));
 }
 
 /*
-    Read two bytes of memory from the given address.
+    Watch the 1 KB page containing the given address for code modification.
+
+    Return whether the address is in RAM. If so, the next write to the page
+    (or its mirror) will increment the page's code generation, which the CPU
+    compares against when reusing instructions decoded from it. ROM never
+    changes, so it is not watched.
+
+    Watched pages lose their write pointers, so writes to them are trapped.
 */
-uint16_t mmu_read_double(const MMU *mmu, uint16_t addr)
+bool mmu_watch_code(MMU *mmu, uint16_t addr)
 {
-    return mmu_read_byte(mmu, addr) + (mmu_read_byte(mmu, addr + 1) << 8);
+    if (addr < 0x8000 || (addr < 0xC000 && !mmu->cart_ram_mapped))
+        return false;
+
+    size_t page = addr >> MMU_PAGE_BITS;
+    mmu->code_pages[page] = true;
+    mmu->write_map[page] = NULL;
+    if (addr >= 0xC000)
+        mmu->write_map[page ^ 0x08] = NULL;
+    return true;
 }
 
 /*
-    Read four bytes of memory from the given address.
+    Invalidate code decoded from RAM if the given address is in a watched page.
+
+    Only that page (and its mirror, for system RAM) is affected: its code
+    generation is bumped, and it stops being watched until code is decoded
+    from it again, so it gets its write pointer back.
 */
-uint32_t mmu_read_quad(const MMU *mmu, uint16_t addr)
+static inline void invalidate_code(MMU *mmu, uint16_t addr)
 {
-    return (
-         mmu_read_byte(mmu, addr) +
-        (mmu_read_byte(mmu, addr + 1) <<  8) +
-        (mmu_read_byte(mmu, addr + 2) << 16) +
-        (mmu_read_byte(mmu, addr + 3) << 24));
+    size_t page = addr >> MMU_PAGE_BITS;
+    size_t mirror = addr >= 0xC000 ? page ^ 0x08 : page;
+
+    if (mmu->code_pages[page] || mmu->code_pages[mirror]) {
+        mmu->code_pages[page] = mmu->code_pages[mirror] = false;
+        mmu->code_gen[page]++;
+        mmu->code_gen[mirror]++;
+        update_page(mmu, page);
+        update_page(mmu, mirror);
+    }
+}
+
+/*
+    Create fresh cartridge RAM, in the save if there is one.
+*/
+static void init_cart_ram(MMU *mmu)
+{
+    DEBUG("MMU initializing cartridge RAM (fresh battery save)")
+    if (mmu->save && save_init_cart_ram(mmu->save)) {
+        mmu->cart_ram = save_get_cart_ram(mmu->save);
+        mmu->cart_ram_external = true;
+    } else {
+        mmu->cart_ram = cr_malloc(sizeof(uint8_t) * MMU_CART_RAM_SIZE);
+        mmu->cart_ram_external = false;
+    }
+    memset(mmu->cart_ram, 0xFF, MMU_CART_RAM_SIZE);
 }
 
 /*
@@ -224,39 +336,35 @@ static void write_ram_control_register(MMU *mmu, uint8_t value)
     else if (!slot2_enable && mmu->cart_ram_mapped)
         TRACE("MMU disabling cart RAM in memory slot 2")
 
-    if (slot2_enable && !mmu->cart_ram) {
-        DEBUG("MMU initializing cartridge RAM (fresh battery save)")
-        if (mmu->save && save_init_cart_ram(mmu->save)) {
-            mmu->cart_ram = save_get_cart_ram(mmu->save);
-            mmu->cart_ram_external = true;
-        } else {
-            mmu->cart_ram = cr_malloc(sizeof(uint8_t) * MMU_CART_RAM_SIZE);
-            mmu->cart_ram_external = false;
-        }
-        memset(mmu->cart_ram, 0xFF, MMU_CART_RAM_SIZE);
-    }
+    if (slot2_enable && !mmu->cart_ram)
+        init_cart_ram(mmu);
 
     mmu->cart_ram_slot =
         bank_select ? (mmu->cart_ram + 0x4000) : mmu->cart_ram;
     mmu->cart_ram_mapped = slot2_enable;
+    mmu->map_gen++;
+    update_page_tables(mmu);
 }
 
 /*
-    Write a byte of memory to the given address.
+    Write a byte of memory to an address whose page has no write pointer.
 
-    Return true if the byte was written, and false if it wasn't. Writes will
-    fail when attempting to write to read-only memory.
+    This is the slow path of mmu_write_byte(), covering ROM (which ignores the
+    write), the mapper registers, and pages of RAM that hold cached code. It
+    returns the same as mmu_write_byte().
 */
-bool mmu_write_byte(MMU *mmu, uint16_t addr, uint8_t value)
+bool mmu_write_trapped(MMU *mmu, uint16_t addr, uint8_t value)
 {
     if (addr < 0xC000) {
         if (addr >= 0x8000 && mmu->cart_ram_mapped) {
             mmu->cart_ram_slot[addr - 0x8000] = value;
+            invalidate_code(mmu, addr);
             return true;
         }
         return false;
     } else if (addr < 0xE000) {  // System RAM (0xC000 - 0xDFFF)
         mmu->system_ram[addr - 0xC000] = value;
+        invalidate_code(mmu, addr);
         return true;
     } else {  // System RAM, mirrored (0xE000 - 0xFFFF)
         if (addr == 0xFFFC)
@@ -268,16 +376,69 @@ bool mmu_write_byte(MMU *mmu, uint16_t addr, uint8_t value)
         else if (addr == 0xFFFF)
             map_rom_slot(mmu, 2, value & 0x3F);
         mmu->system_ram[addr - 0xE000] = value;
+        invalidate_code(mmu, addr);
         return true;
     }
 }
 
 /*
-    Write two bytes of memory to the given address.
+    Save the MMU's state, for restoring later with mmu_load_state().
+
+    Mapped slots are saved as the ROM banks they hold, not as host pointers,
+    so the state can be loaded by any MMU with the same ROM.
+*/
+void mmu_save_state(const MMU *mmu, MMUState *state)
+{
+    memcpy(state->system_ram, mmu->system_ram, MMU_SYSTEM_RAM_SIZE);
+    if (mmu->cart_ram)
+        memcpy(state->cart_ram, mmu->cart_ram, MMU_CART_RAM_SIZE);
+    else
+        memset(state->cart_ram, 0xFF, MMU_CART_RAM_SIZE);
+
+    for (size_t slot = 0; slot < MMU_NUM_SLOTS; slot++) {
+        size_t bank = 0;
+        while (bank < MMU_NUM_ROM_BANKS - 1 &&
+                mmu->rom_banks[bank] != mmu->rom_slots[slot])
+            bank++;
+        state->rom_slots[slot] = bank;
+    }
+
+    state->has_cart_ram = mmu->cart_ram != NULL;
+    state->cart_ram_mapped = mmu->cart_ram_mapped;
+    state->cart_ram_high =
+        mmu->cart_ram && mmu->cart_ram_slot == mmu->cart_ram + 0x4000;
+    state->bios_enabled = mmu->bios_enabled;
+}
+
+/*
+    Restore the MMU's state from one saved by mmu_save_state().
+
+    Cartridge RAM is created if the state has some and the MMU doesn't yet.
+    Since memory may have changed under any code the CPU has decoded, the
+    code and mapping generations are both bumped.
 */
-bool mmu_write_double(MMU *mmu, uint16_t addr, uint16_t value)
+void mmu_load_state(MMU *mmu, const MMUState *state)
 {
-    bool b1 = mmu_write_byte(mmu, addr, value & 0xFF);
-    bool b2 = mmu_write_byte(mmu, addr + 1, value >> 8);
-    return b1 && b2;
+    memcpy(mmu->system_ram, state->system_ram, MMU_SYSTEM_RAM_SIZE);
+    if (state->has_cart_ram) {
+        if (!mmu->cart_ram)
+            init_cart_ram(mmu);
+        memcpy(mmu->cart_ram, state->cart_ram, MMU_CART_RAM_SIZE);
+    }
+
+    for (size_t slot = 0; slot < MMU_NUM_SLOTS; slot++)
+        mmu->rom_slots[slot] =
+            mmu->rom_banks[state->rom_slots[slot] % MMU_NUM_ROM_BANKS];
+
+    if (mmu->cart_ram)
+        mmu->cart_ram_slot =
+            state->cart_ram_high ? (mmu->cart_ram + 0x4000) : mmu->cart_ram;
+    mmu->cart_ram_mapped = state->cart_ram_mapped && mmu->cart_ram;
+    mmu->bios_enabled = state->bios_enabled && mmu->bios_rom;
+
+    memset(mmu->code_pages, false, sizeof(mmu->code_pages));
+    for (size_t page = 0; page < MMU_NUM_PAGES; page++)
+        mmu->code_gen[page]++;
+    mmu->map_gen++;
+    update_page_tables(mmu);
 }
@@ -14,6 +14,9 @@
 #define MMU_ROM_BANK_SIZE   (16 * 1024)
 #define MMU_SYSTEM_RAM_SIZE ( 8 * 1024)
 #define MMU_CART_RAM_SIZE   (32 * 1024)
+#define MMU_PAGE_BITS       (10)
+#define MMU_PAGE_SIZE       (1 << MMU_PAGE_BITS)
+#define MMU_NUM_PAGES       (0x10000 >> MMU_PAGE_BITS)
 
 /* Structs */
 
@@ -26,9 +29,22 @@ typedef struct {
     const uint8_t *bios_rom;
     bool cart_ram_mapped, cart_ram_external;
     bool bios_enabled;
+    bool code_pages[MMU_NUM_PAGES];
+    uint32_t code_gen[MMU_NUM_PAGES];
+    uint32_t map_gen;
+    const uint8_t *read_map[MMU_NUM_PAGES];
+    uint8_t *write_map[MMU_NUM_PAGES];
     Save *save;
 } MMU;
 
+typedef struct {
+    uint8_t system_ram[MMU_SYSTEM_RAM_SIZE];
+    uint8_t cart_ram[MMU_CART_RAM_SIZE];
+    uint8_t rom_slots[MMU_NUM_SLOTS];
+    bool has_cart_ram, cart_ram_mapped, cart_ram_high;
+    bool bios_enabled;
+} MMUState;
+
 /* Functions */
 
 void mmu_init(MMU*);
@@ -37,9 +53,80 @@ void mmu_load_rom(MMU*, const uint8_t*, size_t);
 void mmu_load_bios(MMU*, const uint8_t*);
 void mmu_load_save(MMU*, Save*);
 void mmu_power(MMU*);
+void mmu_enable_bios(MMU*, bool);
+void mmu_save_state(const MMU*, MMUState*);
+void mmu_load_state(MMU*, const MMUState*);
+
+const uint8_t* mmu_map_code(const MMU*, uint16_t);
+bool mmu_watch_code(MMU*, uint16_t);
+bool mmu_write_trapped(MMU*, uint16_t, uint8_t);
+
+/* Inline memory access */
+
+/*
+    Read a byte of memory from the given address.
+
+    Each 1 KB page of the address space has an entry in the read map pointing
+    to the memory behind it (unmapped pages point to a page of 0xFF bytes).
+    The map is rebuilt whenever the memory mapping changes; see mmu.c.
+*/
+static inline uint8_t mmu_read_byte(const MMU *mmu, uint16_t addr)
+{
+    return mmu->read_map[addr >> MMU_PAGE_BITS][addr & (MMU_PAGE_SIZE - 1)];
+}
+
+/*
+    Read two bytes of memory from the given address.
+*/
+static inline uint16_t mmu_read_double(const MMU *mmu, uint16_t addr)
+{
+    uint16_t offset = addr & (MMU_PAGE_SIZE - 1);
+    if (offset <= MMU_PAGE_SIZE - 2) {
+        const uint8_t *ptr = mmu->read_map[addr >> MMU_PAGE_BITS] + offset;
+        return ptr[0] | ptr[1] << 8;
+    }
+    return mmu_read_byte(mmu, addr) | mmu_read_byte(mmu, addr + 1) << 8;
+}
+
+/*
+    Read four bytes of memory from the given address.
+*/
+static inline uint32_t mmu_read_quad(const MMU *mmu, uint16_t addr)
+{
+    uint16_t offset = addr & (MMU_PAGE_SIZE - 1);
+    if (offset <= MMU_PAGE_SIZE - 4) {
+        const uint8_t *ptr = mmu->read_map[addr >> MMU_PAGE_BITS] + offset;
+        return ptr[0] | ptr[1] << 8 | ptr[2] << 16 | (uint32_t) ptr[3] << 24;
+    }
+    return mmu_read_double(mmu, addr) |
+        (uint32_t) mmu_read_double(mmu, addr + 2) << 16;
+}
+
+/*
+    Write a byte of memory to the given address.
+
+    Return true if the byte was written, and false if it wasn't. Writes will
+    fail when attempting to write to read-only memory.
+
+    Pages of RAM have an entry in the write map pointing to their memory. The
+    rest (ROM, the page with the mapper registers, and RAM that holds cached
+    code) are trapped, and the write is handled by mmu_write_trapped().
+*/
+static inline bool mmu_write_byte(MMU *mmu, uint16_t addr, uint8_t value)
+{
+    uint8_t *page = mmu->write_map[addr >> MMU_PAGE_BITS];
+    if (!page)
+        return mmu_write_trapped(mmu, addr, value);
+    page[addr & (MMU_PAGE_SIZE - 1)] = value;
+    return true;
+}
 
-uint8_t mmu_read_byte(const MMU*, uint16_t);
-uint16_t mmu_read_double(const MMU*, uint16_t);
-uint32_t mmu_read_quad(const MMU*, uint16_t);
-bool mmu_write_byte(MMU*, uint16_t, uint8_t);
-bool mmu_write_double(MMU*, uint16_t, uint16_t);
+/*
+    Write two bytes of memory to the given address.
+*/
+static inline bool mmu_write_double(MMU *mmu, uint16_t addr, uint16_t value)
+{
+    bool b1 = mmu_write_byte(mmu, addr, value & 0xFF);
+    bool b2 = mmu_write_byte(mmu, addr + 1, value >> 8);
+    return b1 && b2;
+}
@@ -0,0 +1,142 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    The pacer keeps frames on a schedule of absolute deadlines, counted from
+    when it started: frame n is due at n times the period after the first.
+    Each wait sleeps until the next deadline on the monotonic clock, rather
+    than for a period's worth of time, so oversleeping before one frame is
+    made up by sleeping less before the next, and the schedule never drifts
+    from real time.
+
+    Sleeping tends to overshoot by tens of microseconds, and by more on a busy
+    host. With spinning enabled, the pacer wakes up PACER_SPIN_NS early and
+    busy-waits through the rest, trading some CPU time for steadier frames.
+*/
+#if defined __linux__
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <errno.h>
+#include <time.h>
+
+#include "pacer.h"
+#include "util.h"
+
+#define NS_PER_SEC 1000000000
+
+/*
+    Initialize a pacer for the given number of frames per second.
+*/
+void pacer_init(Pacer *pacer, double fps)
+{
+    pacer->period = NS_PER_SEC / fps;
+    pacer->spin_ns = 0;
+    pacer_reset(pacer);
+}
+
+/*
+    Set whether the pacer spins through the end of each wait.
+*/
+void pacer_set_spin(Pacer *pacer, bool spin)
+{
+    pacer->spin_ns = spin ? PACER_SPIN_NS : 0;
+}
+
+/*
+    Clear the pacer's statistics and stop it.
+*/
+void pacer_reset(Pacer *pacer)
+{
+    pacer->stats = (PacerStats) {0};
+    pacer_stop(pacer);
+}
+
+/*
+    Stop the pacer, as when frames stop being paced for a while. The next
+    wait starts a new schedule instead of trying to catch up to the old one.
+*/
+void pacer_stop(Pacer *pacer)
+{
+    pacer->running = false;
+}
+
+/*
+    Start a new schedule, with its first deadline at the given time.
+*/
+static void restart(Pacer *pacer, uint64_t now)
+{
+    pacer->origin = now;
+    pacer->count = 0;
+    pacer->running = true;
+}
+
+/*
+    Sleep until the given monotonic time, in nanoseconds.
+*/
+static void sleep_until(uint64_t deadline)
+{
+#if defined __linux__
+    struct timespec spec = {
+        .tv_sec = deadline / NS_PER_SEC,
+        .tv_nsec = deadline % NS_PER_SEC
+    };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &spec, NULL) ==
+           EINTR);
+#else
+    // No absolute sleeps here, but the next deadline still doesn't depend
+    // on how long this one took:
+    uint64_t now = get_time_ns();
+    if (now >= deadline)
+        return;
+    struct timespec spec = {
+        .tv_sec = (deadline - now) / NS_PER_SEC,
+        .tv_nsec = (deadline - now) % NS_PER_SEC
+    };
+    while (nanosleep(&spec, &spec) && errno == EINTR);
+#endif
+}
+
+/*
+    Wait until the next frame is due. Return how far behind schedule we are,
+    in nanoseconds, or zero if we had to wait.
+
+    When the pacer isn't running, this starts a new schedule from now, so the
+    frame is due right away. If we're more than PACER_MAX_LAG frames behind
+    (the host stalled, or we were suspended), the lost time is written off
+    the same way, rather than made up by running frames back to back.
+*/
+uint64_t pacer_wait(Pacer *pacer)
+{
+    uint64_t now = get_time_ns();
+
+    if (!pacer->running) {
+        restart(pacer, now);
+        return 0;
+    }
+
+    pacer->count++;
+    uint64_t deadline = pacer->origin +
+        (uint64_t) (pacer->count * pacer->period + 0.5);
+    if (now >= deadline) {
+        uint64_t lag = now - deadline;
+        pacer->stats.late++;
+        if (lag > PACER_MAX_LAG * pacer->period) {
+            pacer->stats.stalls++;
+            restart(pacer, now);
+            return 0;
+        }
+        return lag;
+    }
+
+    if (deadline - now > pacer->spin_ns)
+        sleep_until(deadline - pacer->spin_ns);
+    while ((now = get_time_ns()) < deadline);
+
+    uint64_t jitter = now - deadline;
+    pacer->stats.waits++;
+    pacer->stats.jitter_total_ns += jitter;
+    if (jitter > pacer->stats.jitter_max_ns)
+        pacer->stats.jitter_max_ns = jitter;
+    return 0;
+}
@@ -0,0 +1,37 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* How many frames behind schedule we can fall before giving up on catching
+   up and starting a new schedule */
+#define PACER_MAX_LAG 2
+
+/* How much of each wait is spent spinning, if enabled, in nanoseconds */
+#define PACER_SPIN_NS 500000
+
+/* Structs */
+
+typedef struct {
+    uint64_t waits, late, stalls;
+    uint64_t jitter_total_ns, jitter_max_ns;
+} PacerStats;
+
+typedef struct {
+    double period;
+    uint64_t spin_ns;
+    uint64_t origin, count;
+    bool running;
+    PacerStats stats;
+} Pacer;
+
+/* Functions */
+
+void pacer_init(Pacer*, double);
+void pacer_set_spin(Pacer*, bool);
+void pacer_reset(Pacer*);
+void pacer_stop(Pacer*);
+uint64_t pacer_wait(Pacer*);
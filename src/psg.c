@@ -1,16 +1,52 @@
 /* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
    Released under the terms of the MIT License. See LICENSE for details. */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "psg.h"
 #include "util.h"
 
+/*
+    The SN76489 has three square wave tone channels and one noise channel,
+    each with its own volume. Every PSG tick, a channel's counter counts down,
+    and when it runs out, it's reloaded from the channel's period and the
+    channel's output flips. The Game Gear adds a stereo control that can turn
+    each channel off on either side.
+
+    Synthesis is lazy: nothing is done until a port write is about to change
+    the chip's state, or the frame ends. Then, rather than tick the counters
+    one by one, we work out when each channel flipped since we last caught
+    up, and add a step (the change in its level) to a delta buffer at that
+    tick. At the end of the frame, the buffer is summed into the waveform at
+    one sample per tick. Every step lands exactly on a sample at this rate,
+    so nothing is smeared or aliased here; band-limiting the result for the
+    host's sample rate is left to whoever plays it.
+
+    Writes are timed by the CPU's clock, which the CPU brings up to date
+    before each instruction it interprets (the JIT leaves I/O to the
+    interpreter), so they take effect at the tick the OUT instruction starts.
+*/
+
+#define LFSR_RESET 0x8000
+
+/* Channel amplitudes for each attenuation, 2 dB apart; 0x0F is silence */
+static const int32_t amplitudes[16] = {
+    8191, 6506, 5168, 4105, 3261, 2590, 2057, 1634,
+    1298, 1031,  819,  651,  517,  411,  326,    0
+};
+
 /*
     Initialize the SN76489 Programmable Sound Generator (PSG).
+
+    The PSG reads the time of each write from the given CPU clock.
 */
-void psg_init(PSG *psg)
+void psg_init(PSG *psg, const uint64_t *clock)
 {
-    // TODO
-    (void) psg;
+    psg->clock = clock;
+    psg->deltas = cr_calloc(2 * (PSG_BUFFER_TICKS + 1), sizeof(int32_t));
+    psg->samples = cr_calloc(2 * PSG_BUFFER_TICKS, sizeof(int16_t));
+    psg->sample_count = 0;
 }
 
 /*
@@ -18,36 +54,329 @@ void psg_init(PSG *psg)
 */
 void psg_free(PSG *psg)
 {
-    // TODO
-    (void) psg;
+    free(psg->deltas);
+    free(psg->samples);
 }
 
 /*
     Power on the PSG, setting up initial state.
+
+    This must be called after the CPU is powered on, which resets its clock.
 */
 void psg_power(PSG *psg)
 {
-    psg->tone1 = psg->tone2 = psg->tone3 = 0x0000;
-    psg->vol1 = psg->vol2 = psg->vol3 = 0x0F;
+    for (unsigned ch = 0; ch < PSG_CHANNELS; ch++) {
+        if (ch < 3)
+            psg->tone[ch] = 0x0000;
+        psg->vol[ch] = 0x0F;
+        psg->counter[ch] = 1;
+        psg->output[ch] = ch < 3;
+        psg->level[ch][0] = psg->level[ch][1] = 0;
+    }
     psg->noise = 0x00;
+    psg->latch = 0x00;
+    psg->stereo = 0xFF;
+    psg->lfsr = LFSR_RESET;
+    psg->noise_phase = false;
+
+    psg->time = psg->frame_start = *psg->clock / PSG_CLOCK_DIVIDER;
+    psg->sum[0] = psg->sum[1] = 0;
+    memset(psg->deltas, 0, sizeof(int32_t) * 2 * (PSG_BUFFER_TICKS + 1));
+    psg->sample_count = 0;
+}
+
+/*
+    Add a step to the delta buffer at the given tick.
+*/
+static inline void add_step(PSG *psg, uint64_t tick, int32_t left,
+                            int32_t right)
+{
+    int32_t *delta = psg->deltas + 2 * (tick - psg->frame_start);
+    delta[0] += left;
+    delta[1] += right;
+}
+
+/*
+    Recompute a channel's level after its volume or panning changed, stepping
+    to it at the given tick.
+*/
+static void update_level(PSG *psg, unsigned ch, uint64_t tick)
+{
+    int32_t amp = amplitudes[psg->vol[ch]];
+    int32_t value = psg->output[ch] ? amp : -amp;
+    int32_t left = (psg->stereo >> (ch + 4)) & 1 ? value : 0;
+    int32_t right = (psg->stereo >> ch) & 1 ? value : 0;
+
+    add_step(psg, tick, left - psg->level[ch][0], right - psg->level[ch][1]);
+    psg->level[ch][0] = left;
+    psg->level[ch][1] = right;
+}
+
+/*
+    Flip a channel's output at the given tick.
+*/
+static inline void flip_output(PSG *psg, unsigned ch, uint64_t tick)
+{
+    int32_t *level = psg->level[ch];
+
+    psg->output[ch] = !psg->output[ch];
+    add_step(psg, tick, -2 * level[0], -2 * level[1]);
+    level[0] = -level[0];
+    level[1] = -level[1];
+}
+
+/*
+    Synthesize a tone channel up to (not including) the given tick.
+
+    A period of 0 or 1 holds the output high instead of flipping it at an
+    inaudible rate, which games use to play samples by changing the volume.
+*/
+static void run_tone(PSG *psg, unsigned ch, uint64_t until)
+{
+    uint16_t period = psg->tone[ch];
+
+    if (period <= 1) {
+        if (!psg->output[ch])
+            flip_output(psg, ch, psg->time);
+        psg->counter[ch] = 1;
+        return;
+    }
+
+    uint64_t next = psg->time + psg->counter[ch] - 1;
+    for (; next < until; next += period)
+        flip_output(psg, ch, next);
+    psg->counter[ch] = next - until + 1;
+}
+
+/*
+    Return the noise channel's period, in ticks.
+*/
+static uint16_t noise_period(const PSG *psg)
+{
+    switch (psg->noise & 0x03) {
+        case 0:  return 0x10;
+        case 1:  return 0x20;
+        case 2:  return 0x40;
+        default: return psg->tone[2] ? psg->tone[2] : 1;
+    }
+}
+
+/*
+    Synthesize the noise channel up to (not including) the given tick.
+
+    The noise counter flips an internal phase; on every other flip, the
+    linear feedback shift register shifts, and its low bit is the output.
+    White noise feeds back bits 0 and 3; periodic noise, just bit 0.
+*/
+static void run_noise(PSG *psg, uint64_t until)
+{
+    uint16_t period = noise_period(psg);
+    uint64_t next = psg->time + psg->counter[3] - 1;
+
+    for (; next < until; next += period) {
+        psg->noise_phase = !psg->noise_phase;
+        if (!psg->noise_phase)
+            continue;
+
+        uint16_t lfsr = psg->lfsr;
+        uint16_t bit = psg->noise & 0x04 ? (lfsr ^ (lfsr >> 3)) & 1 : lfsr & 1;
+        psg->lfsr = lfsr = (lfsr >> 1) | (bit << 15);
+        if ((lfsr & 1) != psg->output[3])
+            flip_output(psg, 3, next);
+    }
+    psg->counter[3] = next - until + 1;
+}
+
+/*
+    Synthesize all channels up to (not including) the given tick.
+*/
+static void synthesize(PSG *psg, uint64_t until)
+{
+    if (until <= psg->time)
+        return;
+
+    for (unsigned ch = 0; ch < 3; ch++)
+        run_tone(psg, ch, until);
+    run_noise(psg, until);
+    psg->time = until;
+}
+
+/*
+    Sum the delta buffer into samples, up to the current tick, and start a new
+    frame there. The samples are written to out, unless it's NULL. Return how
+    many there were.
+
+    A step can land on the current tick itself, if a write just happened, so
+    it's carried over to the start of the new frame.
+*/
+static size_t mix_down(PSG *psg, int16_t *out)
+{
+    size_t count = psg->time - psg->frame_start;
+    int32_t left = psg->sum[0], right = psg->sum[1];
+    int32_t *deltas = psg->deltas;
+
+    if (out) {
+        for (size_t i = 0; i < count; i++) {
+            out[2 * i]     = left  += deltas[2 * i];
+            out[2 * i + 1] = right += deltas[2 * i + 1];
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            left  += deltas[2 * i];
+            right += deltas[2 * i + 1];
+        }
+    }
+
+    psg->sum[0] = left;
+    psg->sum[1] = right;
+    deltas[0] = deltas[2 * count];
+    deltas[1] = deltas[2 * count + 1];
+    memset(deltas + 2, 0, sizeof(int32_t) * 2 * count);
+    psg->frame_start = psg->time;
+    return count;
+}
+
+/*
+    Catch up to the CPU's clock.
+
+    If frames aren't being ended (say, the PSG has no listener), anything
+    older than the buffer is summed and thrown away.
+*/
+static void catch_up(PSG *psg)
+{
+    uint64_t now = *psg->clock / PSG_CLOCK_DIVIDER;
+
+    while (now - psg->frame_start > PSG_BUFFER_TICKS) {
+        synthesize(psg, psg->frame_start + PSG_BUFFER_TICKS);
+        mix_down(psg, NULL);
+    }
+    synthesize(psg, now);
 }
 
 /*
     Write a byte of input to the PSG.
+
+    A byte with the high bit set latches one of the eight registers (a tone
+    period or volume for each channel, plus the noise control) and sets its
+    low four bits. Other bytes set the latched register's remaining bits: the
+    upper six of a tone period, or the same bits as the latch otherwise.
 */
 void psg_write(PSG *psg, uint8_t byte)
 {
-    // TODO
-    (void) psg;
-    TRACE("PSG ignoring write: 0x%02X", byte)
+    catch_up(psg);
+
+    if (byte & 0x80)
+        psg->latch = (byte >> 4) & 0x07;
+
+    unsigned ch = psg->latch >> 1;
+    if (psg->latch & 1) {
+        psg->vol[ch] = byte & 0x0F;
+        update_level(psg, ch, psg->time);
+    } else if (ch < 3) {
+        if (byte & 0x80)
+            psg->tone[ch] = (psg->tone[ch] & 0x3F0) | (byte & 0x0F);
+        else
+            psg->tone[ch] = (psg->tone[ch] & 0x00F) | (byte & 0x3F) << 4;
+    } else {
+        psg->noise = byte & 0x07;
+        psg->lfsr = LFSR_RESET;
+        if (psg->output[3])
+            flip_output(psg, 3, psg->time);
+    }
 }
 
 /*
     Send a byte to the PSG's stereo control.
+
+    Bits 4-7 enable each channel on the left, and bits 0-3 on the right.
 */
 void psg_stereo(PSG *psg, uint8_t byte)
 {
-    // TODO
-    (void) psg;
-    TRACE("PSG ignoring stereo: 0x%02X", byte)
+    catch_up(psg);
+
+    psg->stereo = byte;
+    for (unsigned ch = 0; ch < PSG_CHANNELS; ch++)
+        update_level(psg, ch, psg->time);
+}
+
+/*
+    Finish the current frame of audio, catching up to the CPU's clock.
+
+    The frame's samples are left in the PSG's sample buffer as interleaved
+    left and right pairs of signed 16-bit values, one pair per tick (the
+    CPU's clock over PSG_CLOCK_DIVIDER). Return how many pairs there are.
+*/
+size_t psg_end_frame(PSG *psg)
+{
+    catch_up(psg);
+    psg->sample_count = mix_down(psg, psg->samples);
+    return psg->sample_count;
+}
+
+/*
+    Save the PSG's state, for restoring later with psg_load_state().
+
+    The state doesn't hold the delta buffer: any steps since the frame began
+    are summed into the running level, as if the frame had ended, leaving
+    only the step carried over to the next one. Samples not yet taken with
+    psg_end_frame() are lost, so this is best done between frames.
+*/
+void psg_save_state(const PSG *psg, PSGState *state)
+{
+    size_t count = psg->time - psg->frame_start;
+    int32_t left = psg->sum[0], right = psg->sum[1];
+
+    for (size_t i = 0; i < count; i++) {
+        left  += psg->deltas[2 * i];
+        right += psg->deltas[2 * i + 1];
+    }
+
+    memcpy(state->tone, psg->tone, sizeof(state->tone));
+    memcpy(state->vol, psg->vol, sizeof(state->vol));
+    state->noise = psg->noise;
+    state->latch = psg->latch;
+    state->stereo = psg->stereo;
+    state->lfsr = psg->lfsr;
+
+    memcpy(state->counter, psg->counter, sizeof(state->counter));
+    memcpy(state->output, psg->output, sizeof(state->output));
+    state->noise_phase = psg->noise_phase;
+    memcpy(state->level, psg->level, sizeof(state->level));
+    state->time = psg->time;
+    state->sum[0] = left;
+    state->sum[1] = right;
+    state->carry[0] = psg->deltas[2 * count];
+    state->carry[1] = psg->deltas[2 * count + 1];
+}
+
+/*
+    Restore the PSG's state from one saved by psg_save_state().
+
+    The PSG's time is counted on the CPU's clock, so the CPU's state must be
+    restored from the same save.
+*/
+void psg_load_state(PSG *psg, const PSGState *state)
+{
+    for (unsigned ch = 0; ch < PSG_CHANNELS; ch++) {
+        if (ch < 3)
+            psg->tone[ch] = state->tone[ch] & 0x3FF;
+        psg->vol[ch] = state->vol[ch] & 0x0F;
+        psg->counter[ch] = state->counter[ch] ? state->counter[ch] : 1;
+    }
+    psg->noise = state->noise & 0x07;
+    psg->latch = state->latch & 0x07;
+    psg->stereo = state->stereo;
+    psg->lfsr = state->lfsr;
+
+    memcpy(psg->output, state->output, sizeof(psg->output));
+    psg->noise_phase = state->noise_phase;
+    memcpy(psg->level, state->level, sizeof(psg->level));
+    psg->time = psg->frame_start = state->time;
+    psg->sum[0] = state->sum[0];
+    psg->sum[1] = state->sum[1];
+
+    memset(psg->deltas, 0, sizeof(int32_t) * 2 * (PSG_BUFFER_TICKS + 1));
+    psg->deltas[0] = state->carry[0];
+    psg->deltas[1] = state->carry[1];
+    psg->sample_count = 0;
 }
@@ -3,20 +3,64 @@
 
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+#define PSG_CHANNELS 4
+
+/* The PSG's counters tick once every this many CPU cycles */
+#define PSG_CLOCK_DIVIDER 16
+
+/* A frame is about 3,734 ticks; the buffers have room for two */
+#define PSG_BUFFER_TICKS 8192
+
 /* Structs */
 
 typedef struct {
-    uint16_t tone1, tone2, tone3;
-    uint8_t vol1, vol2, vol3;
+    const uint64_t *clock;
+    uint16_t tone[3];
+    uint8_t vol[PSG_CHANNELS];
     uint8_t noise;
+    uint8_t latch;
+    uint8_t stereo;
+    uint16_t lfsr;
+
+    uint16_t counter[PSG_CHANNELS];
+    bool output[PSG_CHANNELS];
+    bool noise_phase;
+    int32_t level[PSG_CHANNELS][2];
+    uint64_t time, frame_start;
+    int32_t sum[2];
+    int32_t *deltas;
+    int16_t *samples;
+    size_t sample_count;
 } PSG;
 
+typedef struct {
+    uint16_t tone[3];
+    uint8_t vol[PSG_CHANNELS];
+    uint8_t noise;
+    uint8_t latch;
+    uint8_t stereo;
+    uint16_t lfsr;
+
+    uint16_t counter[PSG_CHANNELS];
+    bool output[PSG_CHANNELS];
+    bool noise_phase;
+    int32_t level[PSG_CHANNELS][2];
+    uint64_t time;
+    int32_t sum[2];
+    int32_t carry[2];
+} PSGState;
+
 /* Functions */
 
-void psg_init(PSG*);
+void psg_init(PSG*, const uint64_t*);
 void psg_free(PSG*);
 void psg_power(PSG*);
 void psg_write(PSG*, uint8_t);
 void psg_stereo(PSG*, uint8_t);
+size_t psg_end_frame(PSG*);
+void psg_save_state(const PSG*, PSGState*);
+void psg_load_state(PSG*, const PSGState*);
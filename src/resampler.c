@@ -0,0 +1,256 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    The resampler converts the PSG's stereo output from its native rate
+    (about 223.7 kHz) to the host's with a polyphase FIR filter: a windowed
+    sinc low-pass, precomputed at RESAMPLER_PHASES offsets between one input
+    sample and the next. Each output sample is the dot product of
+    RESAMPLER_TAPS input samples with the row for its offset, rounded down to
+    the nearest phase.
+
+    Input is fed through in blocks of up to RESAMPLER_BLOCK samples, split
+    into a left and a right history buffer that keep the last few samples of
+    the previous block. Everything is allocated up front, so running it never
+    allocates.
+
+    Coefficients are 16-bit fixed point, so the dot products are exact integer
+    sums, and the vector versions (see resampler_simd.inc.c) match the plain
+    C loop bit for bit. Build with -DRESAMPLER_NO_SIMD to use only plain C.
+*/
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(RESAMPLER_NO_SIMD)
+#define RESAMPLER_SIMD
+#endif
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "resampler.h"
+#include "util.h"
+
+#if RESAMPLER_TAPS % 16 || RESAMPLER_TAPS < 16
+#error "RESAMPLER_TAPS must be a positive multiple of 16"
+#endif
+
+#define PI 3.14159265358979323846
+
+/* The filter's cutoff, as a fraction of the lower rate's Nyquist frequency */
+#define CUTOFF 0.9
+
+#define COEF_BITS 15
+#define HISTORY_SIZE (RESAMPLER_TAPS + RESAMPLER_BLOCK)
+
+#ifdef RESAMPLER_SIMD
+#include "resampler_simd.inc.c"
+#endif
+
+/*
+    Compute the filter's coefficients for the given rates.
+
+    Each phase is scaled to a gain of exactly one after rounding, with the
+    rounding error put on its largest tap, so a constant input comes out
+    unchanged.
+*/
+static void build_filter(Resampler *r, double in_rate, double out_rate)
+{
+    double cutoff = CUTOFF * fmin(in_rate, out_rate) / 2 / in_rate;
+    double row[RESAMPLER_TAPS];
+
+    for (unsigned phase = 0; phase < RESAMPLER_PHASES; phase++) {
+        int16_t *coefs = r->coefs + phase * RESAMPLER_TAPS;
+        double offset = (double) phase / RESAMPLER_PHASES, sum = 0;
+        unsigned peak = 0;
+
+        for (unsigned k = 0; k < RESAMPLER_TAPS; k++) {
+            double d = (double) k - (RESAMPLER_TAPS / 2 - 1) - offset;
+            double x = 2 * cutoff * d, t = d / RESAMPLER_TAPS;
+            double sinc = x == 0 ? 1 : sin(PI * x) / (PI * x);
+            double window = 0.42 + 0.5 * cos(2 * PI * t) +
+                            0.08 * cos(4 * PI * t);
+            row[k] = sinc * window;
+            sum += row[k];
+            if (row[k] > row[peak])
+                peak = k;
+        }
+
+        int32_t total = 0;
+        for (unsigned k = 0; k < RESAMPLER_TAPS; k++) {
+            coefs[k] = lround(row[k] / sum * (1 << COEF_BITS));
+            total += coefs[k];
+        }
+        coefs[peak] += (1 << COEF_BITS) - total;
+    }
+}
+
+/*
+    Initialize a resampler between the given rates, in Hz.
+*/
+void resampler_init(Resampler *r, double in_rate, double out_rate)
+{
+    r->coefs = cr_malloc(
+        sizeof(int16_t) * RESAMPLER_PHASES * RESAMPLER_TAPS);
+    r->history[0] = cr_malloc(sizeof(int16_t) * HISTORY_SIZE);
+    r->history[1] = cr_malloc(sizeof(int16_t) * HISTORY_SIZE);
+    r->simd = SIMD_NONE;
+#ifdef RESAMPLER_SIMD
+    r->simd = get_simd_level();
+#endif
+
+    build_filter(r, in_rate, out_rate);
+    resampler_set_rates(r, in_rate, out_rate);
+    resampler_reset(r);
+}
+
+/*
+    Free memory previously allocated by the resampler.
+*/
+void resampler_free(Resampler *r)
+{
+    free(r->coefs);
+    free(r->history[0]);
+    free(r->history[1]);
+}
+
+/*
+    Change the rates being converted between, keeping the filter.
+
+    This is meant for small adjustments, like matching the host's audio clock;
+    the cutoff stays where it was set by resampler_init().
+*/
+void resampler_set_rates(Resampler *r, double in_rate, double out_rate)
+{
+    r->step = llround(ldexp(in_rate / out_rate, 32));
+}
+
+/*
+    Clear the resampler's history, as if it had only been fed silence.
+*/
+void resampler_reset(Resampler *r)
+{
+    memset(r->history[0], 0, sizeof(int16_t) * HISTORY_SIZE);
+    memset(r->history[1], 0, sizeof(int16_t) * HISTORY_SIZE);
+    r->fill = RESAMPLER_TAPS - 1;
+    r->pos = 0;
+}
+
+/*
+    Return the most output samples that the given number of input samples
+    can produce, at the current rates.
+*/
+size_t resampler_max_output(const Resampler *r, size_t count)
+{
+    return (((uint64_t) count + RESAMPLER_TAPS) << 32) / r->step + 1;
+}
+
+/*
+    Take the dot product of the filter with both channels' history.
+*/
+static void dot_product(const Resampler *r, const int16_t *left,
+                        const int16_t *right, const int16_t *coefs,
+                        int32_t *sums)
+{
+#ifdef RESAMPLER_SIMD
+    if (r->simd == SIMD_AVX2) {
+        dot_product_avx2(left, right, coefs, sums);
+        return;
+    }
+    if (r->simd == SIMD_SSE2) {
+        dot_product_sse2(left, right, coefs, sums);
+        return;
+    }
+#else
+    (void) r;
+#endif
+
+    int32_t sum_left = 0, sum_right = 0;
+    for (unsigned k = 0; k < RESAMPLER_TAPS; k++) {
+        sum_left += left[k] * coefs[k];
+        sum_right += right[k] * coefs[k];
+    }
+    sums[0] = sum_left;
+    sums[1] = sum_right;
+}
+
+/*
+    Scale a dot product back down to a sample, rounding and clipping it.
+*/
+static inline int16_t to_sample(int32_t sum)
+{
+    int32_t value = (sum + (1 << (COEF_BITS - 1))) >> COEF_BITS;
+    return value > INT16_MAX ? INT16_MAX : value < INT16_MIN ? INT16_MIN :
+           value;
+}
+
+/*
+    Produce as many output samples as the history allows. Return how many.
+*/
+static size_t filter_history(Resampler *r, int16_t *out)
+{
+    uint64_t pos = r->pos;
+    size_t count = 0;
+
+    while ((pos >> 32) + RESAMPLER_TAPS <= r->fill) {
+        size_t index = pos >> 32;
+        unsigned phase = (pos >> (32 - RESAMPLER_PHASE_BITS)) &
+                         (RESAMPLER_PHASES - 1);
+        int32_t sums[2];
+
+        dot_product(r, r->history[0] + index, r->history[1] + index,
+                    r->coefs + phase * RESAMPLER_TAPS, sums);
+        out[2 * count]     = to_sample(sums[0]);
+        out[2 * count + 1] = to_sample(sums[1]);
+        count++;
+        pos += r->step;
+    }
+    r->pos = pos;
+    return count;
+}
+
+/*
+    Drop history the filter has moved past.
+*/
+static void shift_history(Resampler *r)
+{
+    size_t used = r->pos >> 32;
+    if (used > r->fill)
+        used = r->fill;
+
+    for (unsigned ch = 0; ch < 2; ch++)
+        memmove(r->history[ch], r->history[ch] + used,
+                sizeof(int16_t) * (r->fill - used));
+    r->fill -= used;
+    r->pos -= (uint64_t) used << 32;
+}
+
+/*
+    Resample a run of interleaved stereo samples.
+
+    The output is written as interleaved stereo samples too, and must have
+    room for resampler_max_output() of them. Return how many were written.
+*/
+size_t resampler_run(Resampler *r, const int16_t *in, size_t count,
+                     int16_t *out)
+{
+    size_t written = 0;
+
+    while (count) {
+        size_t block = HISTORY_SIZE - r->fill;
+        if (block > count)
+            block = count;
+
+        int16_t *left = r->history[0] + r->fill;
+        int16_t *right = r->history[1] + r->fill;
+        for (size_t i = 0; i < block; i++) {
+            left[i] = in[2 * i];
+            right[i] = in[2 * i + 1];
+        }
+        r->fill += block;
+        in += 2 * block;
+        count -= block;
+
+        written += filter_history(r, out + 2 * written);
+        shift_history(r);
+    }
+    return written;
+}
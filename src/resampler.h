@@ -0,0 +1,41 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "util.h"
+
+/*
+    Filter length, in input samples. More taps give a sharper cutoff (a
+    flatter top end with less aliasing) for proportionally more work; it must
+    be a multiple of 16.
+*/
+#ifndef RESAMPLER_TAPS
+#define RESAMPLER_TAPS 256
+#endif
+
+#define RESAMPLER_PHASE_BITS 8
+#define RESAMPLER_PHASES (1 << RESAMPLER_PHASE_BITS)
+#define RESAMPLER_BLOCK 1024
+
+/* Structs */
+
+typedef struct {
+    uint64_t step, pos;
+    int16_t *coefs;
+    int16_t *history[2];
+    size_t fill;
+    SIMDLevel simd;
+} Resampler;
+
+/* Functions */
+
+void resampler_init(Resampler*, double, double);
+void resampler_free(Resampler*);
+void resampler_set_rates(Resampler*, double, double);
+void resampler_reset(Resampler*);
+size_t resampler_max_output(const Resampler*, size_t);
+size_t resampler_run(Resampler*, const int16_t*, size_t, int16_t*);
@@ -0,0 +1,70 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    This file contains the x86-64 vector versions of the resampler's dot
+    product. It is included near the top of resampler.c and should not be
+    compiled separately.
+
+    Both multiply pairs of 16-bit samples and coefficients into 32-bit sums
+    (pmaddwd), 8 or 16 taps at a time, and add the lanes together at the end.
+    Integer addition doesn't care about order, so they give exactly what the
+    plain C loop does. The AVX2 one is compiled for it with a target attribute
+    and only used when resampler_init() finds the host supports it.
+*/
+
+#include <immintrin.h>
+
+/*
+    Add together the four 32-bit lanes of a vector.
+*/
+static inline int32_t sum_lanes_sse2(__m128i vec)
+{
+    vec = _mm_add_epi32(vec, _mm_shuffle_epi32(vec, 0x4E));
+    vec = _mm_add_epi32(vec, _mm_shuffle_epi32(vec, 0xB1));
+    return _mm_cvtsi128_si32(vec);
+}
+
+/*
+    Take the dot product of the filter with both channels, 8 taps at a time.
+*/
+static void dot_product_sse2(const int16_t *left, const int16_t *right,
+                             const int16_t *coefs, int32_t *sums)
+{
+    __m128i acc_left = _mm_setzero_si128(), acc_right = _mm_setzero_si128();
+
+    for (unsigned k = 0; k < RESAMPLER_TAPS; k += 8) {
+        __m128i coef = _mm_loadu_si128((const __m128i*) (coefs + k));
+        __m128i l = _mm_loadu_si128((const __m128i*) (left + k));
+        __m128i r = _mm_loadu_si128((const __m128i*) (right + k));
+        acc_left = _mm_add_epi32(acc_left, _mm_madd_epi16(l, coef));
+        acc_right = _mm_add_epi32(acc_right, _mm_madd_epi16(r, coef));
+    }
+    sums[0] = sum_lanes_sse2(acc_left);
+    sums[1] = sum_lanes_sse2(acc_right);
+}
+
+/*
+    Take the dot product of the filter with both channels, 16 taps at a time.
+*/
+TARGET_AVX2
+static void dot_product_avx2(const int16_t *left, const int16_t *right,
+                             const int16_t *coefs, int32_t *sums)
+{
+    __m256i acc_left = _mm256_setzero_si256();
+    __m256i acc_right = _mm256_setzero_si256();
+
+    for (unsigned k = 0; k < RESAMPLER_TAPS; k += 16) {
+        __m256i coef = _mm256_loadu_si256((const __m256i*) (coefs + k));
+        __m256i l = _mm256_loadu_si256((const __m256i*) (left + k));
+        __m256i r = _mm256_loadu_si256((const __m256i*) (right + k));
+        acc_left = _mm256_add_epi32(acc_left, _mm256_madd_epi16(l, coef));
+        acc_right = _mm256_add_epi32(acc_right, _mm256_madd_epi16(r, coef));
+    }
+    sums[0] = sum_lanes_sse2(_mm_add_epi32(
+        _mm256_castsi256_si128(acc_left),
+        _mm256_extracti128_si256(acc_left, 1)));
+    sums[1] = sum_lanes_sse2(_mm_add_epi32(
+        _mm256_castsi256_si128(acc_right),
+        _mm256_extracti128_si256(acc_right, 1)));
+}
@@ -0,0 +1,495 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    The scaler is a software post-processing stage between the VDP's output
+    and the display: it can blend each frame with the last (the Game Gear's
+    LCD was slow enough to ghost), scale it up by an integer factor (with
+    nearest neighbor or Scale2x), and correct it to the Game Gear's 8:7 pixel
+    aspect ratio.
+
+    On x86-64, it uses SSE2, or AVX2 when the host has it (see
+    scaler_simd.inc.c). Build with -DSCALER_NO_SIMD to use only plain C.
+    Large outputs can also be split by rows across a few threads.
+*/
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(SCALER_NO_SIMD)
+#define SCALER_SIMD
+#endif
+
+#include <pthread.h>
+#include <string.h>
+
+#include "scaler.h"
+#include "logging.h"
+#include "util.h"
+
+#define IN_PIXELS (SCALER_IN_WIDTH * SCALER_IN_HEIGHT)
+#define PAR_WIDTH  8
+#define PAR_HEIGHT 7
+
+/*
+    Each thread has a scratch area for three rows: the current source row
+    with its edge pixels repeated on either side (for Scale2x), a row at
+    twice the width, and a row at the full scaled width, before aspect
+    correction. The last two have padding the aspect filter can read into.
+*/
+#define ROW_PAD 8
+#define LINE_OFFSET 0
+#define DOUBLED_OFFSET (LINE_OFFSET + SCALER_IN_WIDTH + 2 * ROW_PAD)
+#define WIDE_OFFSET (DOUBLED_OFFSET + 2 * SCALER_IN_WIDTH + ROW_PAD)
+#define SCRATCH_SIZE \
+    (WIDE_OFFSET + SCALER_IN_WIDTH * SCALER_MAX_SCALE + ROW_PAD)
+
+typedef struct {
+    ScalerPool *pool;
+    unsigned index;
+} ScalerWorker;
+
+struct ScalerPool {
+    pthread_t threads[SCALER_MAX_THREADS];
+    ScalerWorker workers[SCALER_MAX_THREADS];
+    unsigned count;
+    pthread_mutex_t lock;
+    pthread_cond_t start, done;
+    unsigned generation, pending;
+    bool running;
+
+    Scaler *scaler;
+    const uint32_t *in;
+    void *dst;
+    size_t pitch;
+};
+
+#ifdef SCALER_SIMD
+#include "scaler_simd.inc.c"
+#endif
+
+static void build_columns(Scaler*);
+
+/*
+    Initialize a scaler.
+
+    The output is scale times the size of the Game Gear's screen, and also
+    8/7 as wide if aspect is set. Scale2x needs an even scale, and applies
+    nearest neighbor scaling after doubling for scales above two. If blend is
+    set, each output frame is an even mix of the input and the input before
+    it. The scaler runs on the calling thread until scaler_set_threads() says
+    otherwise.
+*/
+void scaler_init(Scaler *scaler, unsigned scale, ScalerFilter filter,
+                 bool aspect, bool blend)
+{
+    unsigned wide = SCALER_IN_WIDTH * scale;
+
+    scaler->scale = scale;
+    scaler->filter = filter;
+    scaler->aspect = aspect;
+    scaler->blend = blend;
+    scaler->width = aspect ? (wide * PAR_WIDTH + PAR_HEIGHT / 2) / PAR_HEIGHT
+                           : wide;
+    scaler->height = SCALER_IN_HEIGHT * scale;
+    scaler->simd = SIMD_NONE;
+#ifdef SCALER_SIMD
+    scaler->simd = get_simd_level();
+#endif
+
+    scaler->frame = cr_malloc(sizeof(uint32_t) * IN_PIXELS);
+    scaler->prev = cr_malloc(sizeof(uint32_t) * IN_PIXELS);
+    scaler->have_prev = false;
+    scaler->columns = NULL;
+    scaler->weights = NULL;
+    if (aspect) {
+        scaler->columns = cr_malloc(sizeof(uint16_t) * scaler->width);
+        scaler->weights = cr_malloc(sizeof(uint16_t) * scaler->width);
+        build_columns(scaler);
+    }
+    scaler->scratch = cr_calloc(SCRATCH_SIZE, sizeof(uint32_t));
+    scaler->threads = 1;
+    scaler->pool = NULL;
+}
+
+/*
+    Stop a scaler's worker threads, if it has any.
+*/
+static void stop_pool(Scaler *scaler)
+{
+    ScalerPool *pool = scaler->pool;
+    if (!pool)
+        return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->running = false;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+    for (unsigned i = 1; i < pool->count; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+    scaler->pool = NULL;
+}
+
+/*
+    Free memory previously allocated by the scaler.
+*/
+void scaler_free(Scaler *scaler)
+{
+    stop_pool(scaler);
+    free(scaler->frame);
+    free(scaler->prev);
+    free(scaler->columns);
+    free(scaler->weights);
+    free(scaler->scratch);
+}
+
+/*
+    Work out which pixels of a scaled row each output pixel comes from when
+    correcting the aspect ratio.
+
+    Every output pixel covers 7/8 of a scaled pixel. Most fit inside one and
+    take its color; those that straddle two are mixed in proportion, weighted
+    out of 256 toward the second, so pixel edges stay as sharp as they can.
+*/
+static void build_columns(Scaler *scaler)
+{
+    uint64_t wide = SCALER_IN_WIDTH * scaler->scale, width = scaler->width;
+
+    for (uint64_t x = 0; x < width; x++) {
+        uint64_t start = x * wide * 256 / width;
+        uint64_t end = (x + 1) * wide * 256 / width;
+        uint64_t column = start >> 8, edge = (column + 1) << 8;
+
+        scaler->columns[x] = column;
+        scaler->weights[x] = end > edge ? (end - edge) * 256 / (end - start)
+                                        : 0;
+    }
+}
+
+/*
+    Mix two colors, weighted out of 256 toward the second.
+*/
+static inline uint32_t mix_colors(uint32_t a, uint32_t b, unsigned weight)
+{
+    uint32_t out = 0;
+
+    for (unsigned shift = 0; shift < 32; shift += 8) {
+        unsigned ca = (a >> shift) & 0xFF, cb = (b >> shift) & 0xFF;
+        out |= ((ca * (256 - weight) + cb * weight) >> 8) << shift;
+    }
+    return out;
+}
+
+/*
+    Blend a frame with the one before it into the scaler's frame buffer.
+
+    Each channel is the average of the two, rounded up.
+*/
+static void blend_frame(Scaler *scaler, const uint32_t *in)
+{
+    if (!scaler->have_prev) {
+        memcpy(scaler->frame, in, sizeof(uint32_t) * IN_PIXELS);
+        memcpy(scaler->prev, in, sizeof(uint32_t) * IN_PIXELS);
+        scaler->have_prev = true;
+        return;
+    }
+
+#ifdef SCALER_SIMD
+    if (scaler->simd == SIMD_AVX2) {
+        blend_frame_avx2(scaler, in);
+        return;
+    }
+    if (scaler->simd == SIMD_SSE2) {
+        blend_frame_sse2(scaler, in);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < IN_PIXELS; i++) {
+        uint32_t a = in[i], b = scaler->prev[i];
+        scaler->frame[i] = (a | b) - (((a ^ b) & 0xFEFEFEFE) >> 1);
+        scaler->prev[i] = a;
+    }
+}
+
+/*
+    Repeat every pixel in a row the given number of times.
+*/
+static void repeat_row(const Scaler *scaler, uint32_t *dst,
+                       const uint32_t *src, unsigned width, unsigned factor)
+{
+    if (factor == 1) {
+        memcpy(dst, src, sizeof(uint32_t) * width);
+        return;
+    }
+
+#ifdef SCALER_SIMD
+    if (scaler->simd != SIMD_NONE && (factor == 2 || factor == 4)) {
+        repeat_row_sse2(dst, src, width, factor);
+        return;
+    }
+#else
+    (void) scaler;
+#endif
+
+    for (unsigned x = 0; x < width; x++) {
+        for (unsigned i = 0; i < factor; i++)
+            *(dst++) = src[x];
+    }
+}
+
+/*
+    Double a row with Scale2x, writing the top or bottom half of the result.
+
+    line is the row itself, with its first and last pixels repeated just
+    outside it; above and below are its neighbors, or the row again at the
+    edges of the screen.
+*/
+static void scale2x_row(const Scaler *scaler, uint32_t *dst,
+                        const uint32_t *above, const uint32_t *line,
+                        const uint32_t *below, bool bottom)
+{
+#ifdef SCALER_SIMD
+    if (scaler->simd == SIMD_AVX2) {
+        scale2x_row_avx2(dst, above, line, below, bottom);
+        return;
+    }
+    if (scaler->simd == SIMD_SSE2) {
+        scale2x_row_sse2(dst, above, line, below, bottom);
+        return;
+    }
+#else
+    (void) scaler;
+#endif
+
+    const uint32_t *left = line - 1, *right = line + 1;
+
+    for (unsigned x = 0; x < SCALER_IN_WIDTH; x++) {
+        uint32_t a = above[x], b = right[x], c = left[x];
+        uint32_t d = below[x], p = line[x];
+
+        if (!bottom) {
+            dst[2 * x]     = (c == a && c != d && a != b) ? a : p;
+            dst[2 * x + 1] = (a == b && a != c && b != d) ? b : p;
+        } else {
+            dst[2 * x]     = (d == c && d != b && c != a) ? c : p;
+            dst[2 * x + 1] = (b == d && b != a && d != c) ? d : p;
+        }
+    }
+}
+
+/*
+    Resample a scaled row to the output width, correcting its aspect ratio.
+*/
+static void aspect_row(const Scaler *scaler, uint32_t *dst,
+                       const uint32_t *wide)
+{
+    unsigned x = 0;
+
+#ifdef SCALER_SIMD
+    if (scaler->simd == SIMD_AVX2)
+        x = aspect_row_avx2(scaler, dst, wide);
+    else if (scaler->simd == SIMD_SSE2)
+        x = aspect_row_sse2(scaler, dst, wide);
+#endif
+
+    for (; x < scaler->width; x++) {
+        const uint32_t *src = wide + scaler->columns[x];
+        dst[x] = mix_colors(src[0], src[1], scaler->weights[x]);
+    }
+}
+
+/*
+    Finish a group of output rows that all look the same.
+
+    The first row is built in wide (or in place, without aspect correction)
+    before this is called; it's resampled if need be, then copied down.
+*/
+static void finish_rows(const Scaler *scaler, uint8_t *out, size_t pitch,
+                        const uint32_t *wide, unsigned count)
+{
+    if (scaler->aspect)
+        aspect_row(scaler, (uint32_t*) out, wide);
+    for (unsigned i = 1; i < count; i++)
+        memcpy(out + i * pitch, out, sizeof(uint32_t) * scaler->width);
+}
+
+/*
+    Scale the given source rows of a frame into the output.
+*/
+static void scale_rows(const Scaler *scaler, const uint32_t *in, void *dst,
+                       size_t pitch, unsigned first, unsigned last,
+                       uint32_t *scratch)
+{
+    uint32_t *line = scratch + LINE_OFFSET + ROW_PAD;
+    uint32_t *doubled = scratch + DOUBLED_OFFSET;
+    uint32_t *wide = scratch + WIDE_OFFSET;
+    unsigned scale = scaler->scale;
+
+    for (unsigned y = first; y < last; y++) {
+        const uint32_t *row = in + y * SCALER_IN_WIDTH;
+        uint8_t *out = (uint8_t*) dst + y * scale * pitch;
+
+        if (scaler->filter == SCALER_NEAREST) {
+            uint32_t *target = scaler->aspect ? wide : (uint32_t*) out;
+            repeat_row(scaler, target, row, SCALER_IN_WIDTH, scale);
+            finish_rows(scaler, out, pitch, wide, scale);
+            continue;
+        }
+
+        const uint32_t *above = y > 0 ? row - SCALER_IN_WIDTH : row;
+        const uint32_t *below =
+            y < SCALER_IN_HEIGHT - 1 ? row + SCALER_IN_WIDTH : row;
+        unsigned half = scale / 2;
+
+        memcpy(line, row, sizeof(uint32_t) * SCALER_IN_WIDTH);
+        line[-1] = row[0];
+        line[SCALER_IN_WIDTH] = row[SCALER_IN_WIDTH - 1];
+
+        for (unsigned bottom = 0; bottom < 2; bottom++) {
+            uint8_t *half_out = out + bottom * half * pitch;
+            uint32_t *target = scaler->aspect ? wide : (uint32_t*) half_out;
+
+            if (half == 1) {
+                scale2x_row(scaler, target, above, line, below, bottom);
+            } else {
+                scale2x_row(scaler, doubled, above, line, below, bottom);
+                repeat_row(scaler, target, doubled, 2 * SCALER_IN_WIDTH, half);
+            }
+            finish_rows(scaler, half_out, pitch, wide, half);
+        }
+    }
+}
+
+/*
+    Scale one thread's share of the frame's rows.
+*/
+static void scale_band(Scaler *scaler, unsigned index, const uint32_t *in,
+                       void *dst, size_t pitch)
+{
+    unsigned first = SCALER_IN_HEIGHT * index / scaler->threads;
+    unsigned last = SCALER_IN_HEIGHT * (index + 1) / scaler->threads;
+
+    scale_rows(scaler, in, dst, pitch, first, last,
+               scaler->scratch + index * SCRATCH_SIZE);
+}
+
+/*
+    Main function of a scaler worker thread: scale a share of every frame
+    handed out, until the pool is stopped.
+*/
+static void* worker_main(void *arg)
+{
+    ScalerWorker *worker = arg;
+    ScalerPool *pool = worker->pool;
+    unsigned seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true) {
+        while (pool->running && pool->generation == seen)
+            pthread_cond_wait(&pool->start, &pool->lock);
+        if (!pool->running)
+            break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        scale_band(pool->scaler, worker->index, pool->in, pool->dst,
+                   pool->pitch);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0)
+            pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/*
+    Set how many threads (including the caller's) split up the scaling.
+
+    The first frame blending step always runs on the caller's thread, since
+    it's cheap. Return false if not all of the threads could be started, in
+    which case the scaler uses as many as it could.
+*/
+bool scaler_set_threads(Scaler *scaler, unsigned threads)
+{
+    if (threads < 1)
+        threads = 1;
+    if (threads > SCALER_MAX_THREADS)
+        threads = SCALER_MAX_THREADS;
+
+    stop_pool(scaler);
+    free(scaler->scratch);
+    scaler->scratch = cr_calloc(threads * SCRATCH_SIZE, sizeof(uint32_t));
+    scaler->threads = 1;
+    if (threads == 1)
+        return true;
+
+    ScalerPool *pool = cr_malloc(sizeof(ScalerPool));
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    pool->generation = pool->pending = 0;
+    pool->running = true;
+    pool->scaler = scaler;
+    pool->count = 1;
+    scaler->pool = pool;
+
+    for (unsigned i = 1; i < threads; i++) {
+        pool->workers[i] = (ScalerWorker) {pool, i};
+        if (pthread_create(&pool->threads[i], NULL, worker_main,
+                           &pool->workers[i]))
+            break;
+        pool->count++;
+    }
+    scaler->threads = pool->count;
+    if (pool->count == 1)
+        stop_pool(scaler);
+    return scaler->threads == threads;
+}
+
+/*
+    Forget the last frame, so the next one isn't blended with it.
+*/
+void scaler_reset(Scaler *scaler)
+{
+    scaler->have_prev = false;
+}
+
+/*
+    Post-process a frame from the VDP into the output.
+
+    The input is a packed ARGB8888 frame, the size of the Game Gear's screen.
+    The output has the scaler's width and height, with rows pitch bytes
+    apart.
+*/
+void scaler_run(Scaler *scaler, const uint32_t *in, void *dst, size_t pitch)
+{
+    if (scaler->blend) {
+        blend_frame(scaler, in);
+        in = scaler->frame;
+    }
+
+    ScalerPool *pool = scaler->pool;
+    if (!pool) {
+        scale_band(scaler, 0, in, dst, pitch);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->in = in;
+    pool->dst = dst;
+    pool->pitch = pitch;
+    pool->pending = pool->count - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    scale_band(scaler, 0, in, dst, pitch);
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->pending)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
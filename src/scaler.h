@@ -0,0 +1,47 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "util.h"
+
+#define SCALER_IN_WIDTH  160
+#define SCALER_IN_HEIGHT 144
+#define SCALER_MAX_SCALE 8
+#define SCALER_MAX_THREADS 8
+
+/* Structs */
+
+typedef enum {
+    SCALER_NEAREST = 0,
+    SCALER_SCALE2X = 1
+} ScalerFilter;
+
+typedef struct ScalerPool ScalerPool;
+
+typedef struct {
+    unsigned scale;
+    ScalerFilter filter;
+    bool aspect, blend;
+    unsigned width, height;
+    SIMDLevel simd;
+
+    uint32_t *frame, *prev;
+    bool have_prev;
+    uint16_t *columns, *weights;
+    uint32_t *scratch;
+    unsigned threads;
+    ScalerPool *pool;
+} Scaler;
+
+/* Functions */
+
+void scaler_init(Scaler*, unsigned, ScalerFilter, bool, bool);
+void scaler_free(Scaler*);
+bool scaler_set_threads(Scaler*, unsigned);
+void scaler_reset(Scaler*);
+void scaler_run(Scaler*, const uint32_t*, void*, size_t);
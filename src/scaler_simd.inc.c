@@ -0,0 +1,250 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    This file contains the x86-64 vector versions of the scaler's routines. It
+    is included near the top of scaler.c and should not be compiled
+    separately.
+
+    As with the VDP's, each routine does exactly what the plain C loop it
+    replaces does, 4 or 8 pixels at a time. The AVX2 ones are compiled for it
+    with a target attribute and only used when scaler_init() finds the host
+    supports it; pixel repetition is bound by memory, so it has no AVX2
+    version.
+*/
+
+#include <immintrin.h>
+
+/*
+    Blend a frame with the previous one, 4 pixels at a time.
+*/
+static void blend_frame_sse2(Scaler *scaler, const uint32_t *in)
+{
+    for (size_t i = 0; i < IN_PIXELS; i += 4) {
+        __m128i cur = _mm_loadu_si128((const __m128i*) (in + i));
+        __m128i old = _mm_loadu_si128((const __m128i*) (scaler->prev + i));
+        _mm_storeu_si128((__m128i*) (scaler->frame + i), _mm_avg_epu8(cur, old));
+        _mm_storeu_si128((__m128i*) (scaler->prev + i), cur);
+    }
+}
+
+/*
+    Blend a frame with the previous one, 8 pixels at a time.
+*/
+TARGET_AVX2
+static void blend_frame_avx2(Scaler *scaler, const uint32_t *in)
+{
+    for (size_t i = 0; i < IN_PIXELS; i += 8) {
+        __m256i cur = _mm256_loadu_si256((const __m256i*) (in + i));
+        __m256i old = _mm256_loadu_si256((const __m256i*) (scaler->prev + i));
+        _mm256_storeu_si256((__m256i*) (scaler->frame + i),
+                            _mm256_avg_epu8(cur, old));
+        _mm256_storeu_si256((__m256i*) (scaler->prev + i), cur);
+    }
+}
+
+/*
+    Repeat every pixel in a row two or four times, 4 source pixels at a time.
+    The width must be a multiple of four.
+*/
+static void repeat_row_sse2(uint32_t *dst, const uint32_t *src,
+                            unsigned width, unsigned factor)
+{
+    for (unsigned x = 0; x < width; x += 4) {
+        __m128i pixels = _mm_loadu_si128((const __m128i*) (src + x));
+        __m128i lo = _mm_unpacklo_epi32(pixels, pixels);
+        __m128i hi = _mm_unpackhi_epi32(pixels, pixels);
+
+        if (factor == 2) {
+            _mm_storeu_si128((__m128i*) (dst + 2 * x), lo);
+            _mm_storeu_si128((__m128i*) (dst + 2 * x + 4), hi);
+        } else {
+            __m128i *out = (__m128i*) (dst + 4 * x);
+            _mm_storeu_si128(out,     _mm_unpacklo_epi32(lo, lo));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi32(lo, lo));
+            _mm_storeu_si128(out + 2, _mm_unpacklo_epi32(hi, hi));
+            _mm_storeu_si128(out + 3, _mm_unpackhi_epi32(hi, hi));
+        }
+    }
+}
+
+/*
+    Double a row with Scale2x, 4 source pixels at a time.
+
+    Each output pixel is either the source pixel P or one of its neighbors,
+    picked with a mask built from four comparisons: A above, B right, C left,
+    and D below.
+*/
+static void scale2x_row_sse2(uint32_t *dst, const uint32_t *above,
+                             const uint32_t *line, const uint32_t *below,
+                             bool bottom)
+{
+    for (unsigned x = 0; x < SCALER_IN_WIDTH; x += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i*) (above + x));
+        __m128i b = _mm_loadu_si128((const __m128i*) (line + x + 1));
+        __m128i c = _mm_loadu_si128((const __m128i*) (line + x - 1));
+        __m128i d = _mm_loadu_si128((const __m128i*) (below + x));
+        __m128i p = _mm_loadu_si128((const __m128i*) (line + x));
+
+        __m128i ca = _mm_cmpeq_epi32(c, a), cd = _mm_cmpeq_epi32(c, d);
+        __m128i ab = _mm_cmpeq_epi32(a, b), bd = _mm_cmpeq_epi32(b, d);
+        __m128i m0, m1, v0, v1;
+
+        if (!bottom) {
+            m0 = _mm_andnot_si128(_mm_or_si128(cd, ab), ca);
+            m1 = _mm_andnot_si128(_mm_or_si128(ca, bd), ab);
+            v0 = a;
+            v1 = b;
+        } else {
+            m0 = _mm_andnot_si128(_mm_or_si128(bd, ca), cd);
+            m1 = _mm_andnot_si128(_mm_or_si128(ab, cd), bd);
+            v0 = c;
+            v1 = d;
+        }
+
+        __m128i e0 = _mm_or_si128(_mm_and_si128(m0, v0),
+                                  _mm_andnot_si128(m0, p));
+        __m128i e1 = _mm_or_si128(_mm_and_si128(m1, v1),
+                                  _mm_andnot_si128(m1, p));
+        _mm_storeu_si128((__m128i*) (dst + 2 * x), _mm_unpacklo_epi32(e0, e1));
+        _mm_storeu_si128((__m128i*) (dst + 2 * x + 4),
+                         _mm_unpackhi_epi32(e0, e1));
+    }
+}
+
+/*
+    Double a row with Scale2x, 8 source pixels at a time.
+
+    Interleaving works within 128-bit lanes, so the halves are put back in
+    order afterward.
+*/
+TARGET_AVX2
+static void scale2x_row_avx2(uint32_t *dst, const uint32_t *above,
+                             const uint32_t *line, const uint32_t *below,
+                             bool bottom)
+{
+    for (unsigned x = 0; x < SCALER_IN_WIDTH; x += 8) {
+        __m256i a = _mm256_loadu_si256((const __m256i*) (above + x));
+        __m256i b = _mm256_loadu_si256((const __m256i*) (line + x + 1));
+        __m256i c = _mm256_loadu_si256((const __m256i*) (line + x - 1));
+        __m256i d = _mm256_loadu_si256((const __m256i*) (below + x));
+        __m256i p = _mm256_loadu_si256((const __m256i*) (line + x));
+
+        __m256i ca = _mm256_cmpeq_epi32(c, a), cd = _mm256_cmpeq_epi32(c, d);
+        __m256i ab = _mm256_cmpeq_epi32(a, b), bd = _mm256_cmpeq_epi32(b, d);
+        __m256i m0, m1, v0, v1;
+
+        if (!bottom) {
+            m0 = _mm256_andnot_si256(_mm256_or_si256(cd, ab), ca);
+            m1 = _mm256_andnot_si256(_mm256_or_si256(ca, bd), ab);
+            v0 = a;
+            v1 = b;
+        } else {
+            m0 = _mm256_andnot_si256(_mm256_or_si256(bd, ca), cd);
+            m1 = _mm256_andnot_si256(_mm256_or_si256(ab, cd), bd);
+            v0 = c;
+            v1 = d;
+        }
+
+        __m256i e0 = _mm256_blendv_epi8(p, v0, m0);
+        __m256i e1 = _mm256_blendv_epi8(p, v1, m1);
+        __m256i lo = _mm256_unpacklo_epi32(e0, e1);
+        __m256i hi = _mm256_unpackhi_epi32(e0, e1);
+        _mm256_storeu_si256((__m256i*) (dst + 2 * x),
+                            _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i*) (dst + 2 * x + 8),
+                            _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+}
+
+/*
+    Mix two pixels per register half with 16-bit weights, one per channel.
+*/
+static inline __m128i mix_sse2(__m128i a, __m128i b, __m128i weight)
+{
+    const __m128i full = _mm_set1_epi16(256);
+    __m128i sum = _mm_add_epi16(
+        _mm_mullo_epi16(a, _mm_sub_epi16(full, weight)),
+        _mm_mullo_epi16(b, weight));
+    return _mm_srli_epi16(sum, 8);
+}
+
+/*
+    Resample a scaled row for aspect correction, 4 output pixels at a time.
+    Return how many pixels were done; the rest are left to plain C.
+
+    SSE2 has no gather, so source pixels are fetched one by one.
+*/
+static unsigned aspect_row_sse2(const Scaler *scaler, uint32_t *dst,
+                                const uint32_t *wide)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const uint16_t *cols = scaler->columns;
+    unsigned end = scaler->width & ~3u;
+
+    for (unsigned x = 0; x < end; x += 4) {
+        __m128i a = _mm_set_epi32(wide[cols[x + 3]], wide[cols[x + 2]],
+                                  wide[cols[x + 1]], wide[cols[x]]);
+        __m128i b = _mm_set_epi32(wide[cols[x + 3] + 1], wide[cols[x + 2] + 1],
+                                  wide[cols[x + 1] + 1], wide[cols[x] + 1]);
+        __m128i w = _mm_loadl_epi64((const __m128i*) (scaler->weights + x));
+        w = _mm_unpacklo_epi16(w, w);
+
+        __m128i lo = mix_sse2(_mm_unpacklo_epi8(a, zero),
+                              _mm_unpacklo_epi8(b, zero),
+                              _mm_unpacklo_epi32(w, w));
+        __m128i hi = mix_sse2(_mm_unpackhi_epi8(a, zero),
+                              _mm_unpackhi_epi8(b, zero),
+                              _mm_unpackhi_epi32(w, w));
+        _mm_storeu_si128((__m128i*) (dst + x), _mm_packus_epi16(lo, hi));
+    }
+    return end;
+}
+
+/*
+    Mix two pixels per 128-bit lane with 16-bit weights, one per channel.
+*/
+TARGET_AVX2
+static inline __m256i mix_avx2(__m256i a, __m256i b, __m256i weight)
+{
+    const __m256i full = _mm256_set1_epi16(256);
+    __m256i sum = _mm256_add_epi16(
+        _mm256_mullo_epi16(a, _mm256_sub_epi16(full, weight)),
+        _mm256_mullo_epi16(b, weight));
+    return _mm256_srli_epi16(sum, 8);
+}
+
+/*
+    Resample a scaled row for aspect correction, 8 output pixels at a time,
+    gathering the source pixels. Return how many pixels were done.
+
+    The weights are widened to match how the pixels unpack: within each lane,
+    the low half holds its first two pixels and the high half the other two.
+*/
+TARGET_AVX2
+static unsigned aspect_row_avx2(const Scaler *scaler, uint32_t *dst,
+                                const uint32_t *wide)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    unsigned end = scaler->width & ~7u;
+
+    for (unsigned x = 0; x < end; x += 8) {
+        __m256i index = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128((const __m128i*) (scaler->columns + x)));
+        __m256i a = _mm256_i32gather_epi32((const int*) wide, index, 4);
+        __m256i b = _mm256_i32gather_epi32((const int*) (wide + 1), index, 4);
+        __m256i w = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128((const __m128i*) (scaler->weights + x)));
+        w = _mm256_or_si256(w, _mm256_slli_epi32(w, 16));
+
+        __m256i lo = mix_avx2(_mm256_unpacklo_epi8(a, zero),
+                              _mm256_unpacklo_epi8(b, zero),
+                              _mm256_unpacklo_epi32(w, w));
+        __m256i hi = mix_avx2(_mm256_unpackhi_epi8(a, zero),
+                              _mm256_unpackhi_epi8(b, zero),
+                              _mm256_unpackhi_epi32(w, w));
+        _mm256_storeu_si256((__m256i*) (dst + x),
+                            _mm256_packus_epi16(lo, hi));
+    }
+    return end;
+}
@@ -53,6 +53,21 @@ uint64_t get_time_ns()
 #endif
 }
 
+/*
+    Return the best vector instruction set the host supports.
+
+    SSE2 is part of x86-64, so only AVX2 needs checking for. Elsewhere, or
+    without GCC or clang to compile the vector code, this is SIMD_NONE.
+*/
+SIMDLevel get_simd_level()
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+    return __builtin_cpu_supports("avx2") ? SIMD_AVX2 : SIMD_SSE2;
+#else
+    return SIMD_NONE;
+#endif
+}
+
 /*
     Return whether the given character is valid in a symbol (label, define).
 */
@@ -21,11 +21,23 @@
     (data & (1 << 1) ? 1 : 0), \
     (data & (1 << 0) ? 1 : 0)
 
+/* Compile a function for AVX2, to be called only if the host supports it */
+#define TARGET_AVX2 __attribute__((target("avx2")))
+
+/* Structs */
+
+typedef enum {
+    SIMD_NONE = 0,
+    SIMD_SSE2 = 1,
+    SIMD_AVX2 = 2
+} SIMDLevel;
+
 /* Functions */
 
 uint8_t bcd_encode(uint8_t);
 uint8_t bcd_decode(uint8_t);
 uint64_t get_time_ns();
+SIMDLevel get_simd_level();
 bool is_valid_symbol_char(char, bool);
 const char* region_code_to_string(uint8_t);
 uint8_t region_string_to_code(const char*);
@@ -1,8 +1,15 @@
 /* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
    Released under the terms of the MIT License. See LICENSE for details. */
 
+/*
+    On x86-64, scanlines are composited with SSE2, or AVX2 when the host has
+    it (see vdp_simd.inc.c). Build with -DVDP_NO_SIMD to use only plain C.
+*/
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(VDP_NO_SIMD)
+#define VDP_SIMD
+#endif
+
 #include <string.h>
-#include <SDL.h>
 
 #include "vdp.h"
 #include "util.h"
@@ -18,21 +25,70 @@
 #define CODE_REG_WRITE  2
 #define CODE_CRAM_WRITE 3
 
-#define COLBUF_BG_PRIORITY   0x10
-#define COLBUF_OPAQUE_SPRITE 0x20
+/* Line buffers have room for tiles and sprites that hang off either edge */
+#define LINE_MARGIN 8
+#define LINE_SIZE (160 + 2 * LINE_MARGIN)
+
+/* Decoded patterns are stored one byte per pixel, plus a mirrored copy */
+#define PATTERN_CACHE_SIZE (2 * VDP_PATTERNS * 64)
+#define PATTERN_HFLIP (VDP_PATTERNS * 64)
+
+/* Kinds of entries in the render thread's journal (see vdp_thread.inc.c) */
+#define OP_VRAM 0
+#define OP_CRAM 1
+#define OP_REG  2
+#define OP_LINE 3
+
+/*
+    A scanline under construction, as one byte per pixel.
+
+    bg holds palette indices (0-31) for the background, and later the whole
+    line; mask is 0xFF wherever sprites can't be seen (under high-priority
+    tiles and in the margins); sprites holds sprite palette indices (0-15),
+    with 0 for transparent.
+*/
+typedef struct {
+    uint8_t bg[LINE_SIZE];
+    uint8_t mask[LINE_SIZE];
+    uint8_t sprites[LINE_SIZE];
+} LineBuffer;
+
+#ifdef VDP_SIMD
+#include "vdp_simd.inc.c"
+#endif
+
+static void render_push(VDP*, uint8_t, uint16_t, uint8_t);
+static void render_line(VDP*);
+static void render_collect_flags(VDP*);
+static void render_set_pixel_format(VDP*);
+static void render_reset(VDP*);
 
 /*
     Initialize the Video Display Processor (VDP).
 
     The VDP will write to its pixels array whenever it draws a scanline. It
     defaults to NULL, but you should set it to something if you want to see its
-    output.
+    output. Pixels are in ARGB8888 format unless vdp_set_pixel_format() says
+    otherwise. Rows are pitch bytes apart, or packed together if pitch is 0.
+
+    While skip is set, scanlines aren't drawn, but sprites are still checked
+    for overflows and collisions, so skipped frames run the same as others.
 */
 void vdp_init(VDP *vdp)
 {
     vdp->pixels = NULL;
+    vdp->pitch = 0;
+    vdp->skip = false;
+    vdp->pixel_format = VDP_PIXEL_ARGB8888;
+    vdp->color_table = NULL;
+    vdp->simd = SIMD_NONE;
+#ifdef VDP_SIMD
+    vdp->simd = get_simd_level();
+#endif
     vdp->vram = cr_malloc(sizeof(uint8_t) * VDP_VRAM_SIZE);
     vdp->cram = cr_malloc(sizeof(uint8_t) * VDP_CRAM_SIZE);
+    vdp->pattern_cache = cr_malloc(sizeof(uint8_t) * PATTERN_CACHE_SIZE);
+    vdp->renderer = NULL;
 }
 
 /*
@@ -40,8 +96,59 @@ void vdp_init(VDP *vdp)
 */
 void vdp_free(VDP *vdp)
 {
+    vdp_set_threaded(vdp, false);
     free(vdp->vram);
     free(vdp->cram);
+    free(vdp->pattern_cache);
+}
+
+/*
+    Convert a BGR444 color from CRAM into the host's pixel format.
+*/
+static uint32_t convert_color(const VDP *vdp, uint16_t color)
+{
+    uint8_t r = color & 0x000F;
+    uint8_t g = (color & 0x00F0) >> 4;
+    uint8_t b = (color & 0x0F00) >> 8;
+
+    switch (vdp->pixel_format) {
+        case VDP_PIXEL_RGB565:
+            return ((r << 1 | r >> 3) << 11) + ((g << 2 | g >> 2) << 5) +
+                (b << 1 | b >> 3);
+        case VDP_PIXEL_CUSTOM:
+            return vdp->color_table[color & 0x0FFF];
+        default:
+            return (0xFF << 24) + (0x11 * r << 16) + (0x11 * g << 8) + 0x11 * b;
+    }
+}
+
+/*
+    Update the palette entry for the given color from CRAM.
+*/
+static void update_color(VDP *vdp, uint8_t index)
+{
+    uint16_t color = vdp->cram[2 * index] + (vdp->cram[2 * index + 1] << 8);
+    vdp->palette[index] = convert_color(vdp, color);
+}
+
+/*
+    Set the format of pixels written to the VDP's pixels array.
+
+    ARGB8888 (the default) and custom pixels are 32 bits wide, and RGB565
+    pixels are 16 bits wide. For custom pixels, color_table must have an entry
+    for each of the 4,096 BGR444 colors (0xBGR) and stay alive while the VDP
+    uses it; it is ignored for the other formats.
+*/
+void vdp_set_pixel_format(VDP *vdp, VDPPixelFormat format,
+    const uint32_t *color_table)
+{
+    vdp->pixel_format = format;
+    vdp->color_table = color_table;
+    for (uint8_t index = 0; index < VDP_COLORS; index++)
+        update_color(vdp, index);
+    vdp->dirty = true;
+    if (vdp->renderer)
+        render_set_pixel_format(vdp);
 }
 
 /*
@@ -51,6 +158,10 @@ void vdp_power(VDP *vdp)
 {
     memset(vdp->vram, 0x00, VDP_VRAM_SIZE);
     memset(vdp->cram, 0x00, VDP_CRAM_SIZE);
+    memset(vdp->pattern_dirty, 0xFF, sizeof(vdp->pattern_dirty));
+    vdp->sprites_dirty = true;
+    for (uint8_t index = 0; index < VDP_COLORS; index++)
+        update_color(vdp, index);
 
     vdp->regs[0x00] = 0x00;
     vdp->regs[0x01] = 0x00;
@@ -74,6 +185,10 @@ void vdp_power(VDP *vdp)
     vdp->line_count = 0x01;
     vdp->read_buf = 0;
     vdp->cram_latch = 0;
+    vdp->dirty = vdp->was_dirty = true;
+
+    if (vdp->renderer)
+        render_reset(vdp);
 }
 
 /*
@@ -167,51 +282,61 @@ static uint16_t get_background_tile(const VDP *vdp, uint8_t row, uint8_t col)
 }
 
 /*
-    Get the CRAM color index of the given (row, col) in the given pattern.
-*/
-static uint8_t read_pattern(const VDP *vdp, uint16_t pattern,
-    uint8_t row, uint8_t col)
-{
-    uint8_t *planes = &vdp->vram[32 * pattern + 4 * row];
-    return ((planes[0] >> (7 - col)) & 1) +
-          (((planes[1] >> (7 - col)) & 1) << 1) +
-          (((planes[2] >> (7 - col)) & 1) << 2) +
-          (((planes[3] >> (7 - col)) & 1) << 3);
-}
-
-/*
-    Return the BGR444 color at the given CRAM index.
+    Decode the given pattern from VRAM into the pattern cache.
 
-    The index should be between 0 and 15, as there are 16 colors per palette.
+    Patterns are stored in VRAM as four bitplanes per row; the cache holds the
+    CRAM color index of each pixel in its own byte, in both the normal and the
+    horizontally flipped orientation.
 */
-static uint16_t get_color(const VDP *vdp, uint8_t index, bool palette)
+static void decode_pattern(VDP *vdp, uint16_t pattern)
 {
-    uint8_t offset = 2 * (index + 16 * palette);
-    return vdp->cram[offset] + (vdp->cram[offset + 1] << 8);
+    const uint8_t *planes = &vdp->vram[32 * pattern];
+    uint8_t *normal = vdp->pattern_cache + 64 * pattern;
+    uint8_t *flipped = normal + PATTERN_HFLIP;
+
+    for (uint8_t row = 0; row < 8; row++) {
+        for (uint8_t col = 0; col < 8; col++) {
+            uint8_t index =
+                 ((planes[0] >> (7 - col)) & 1) +
+                (((planes[1] >> (7 - col)) & 1) << 1) +
+                (((planes[2] >> (7 - col)) & 1) << 2) +
+                (((planes[3] >> (7 - col)) & 1) << 3);
+            normal[8 * row + col] = flipped[8 * row + 7 - col] = index;
+        }
+        planes += 4;
+    }
 }
 
 /*
-    Draw a pixel onto our pixel array at the given coordinates.
+    Return the CRAM color indices of the given row in the given pattern.
 
-    The color should be in BGR444 format, as returned by get_color().
+    The result is an array of eight pixels, mirrored if hflip is set. Patterns
+    are decoded when first drawn after any of their VRAM changes.
 */
-static void draw_pixel(VDP *vdp, uint8_t y, uint8_t x, uint16_t color)
+static const uint8_t* read_pattern_row(VDP *vdp, uint16_t pattern,
+    uint8_t row, bool hflip)
 {
-    uint8_t r = 0x11 *  (color & 0x000F);
-    uint8_t g = 0x11 * ((color & 0x00F0) >> 4);
-    uint8_t b = 0x11 * ((color & 0x0F00) >> 8);
-
-    uint32_t argb = (0xFF << 24) + (r << 16) + (g << 8) + b;
-    vdp->pixels[y * 160 + x] = argb;
+    uint32_t *dirty = &vdp->pattern_dirty[pattern >> 5];
+    uint32_t bit = 1U << (pattern & 0x1F);
+    if (*dirty & bit) {
+        decode_pattern(vdp, pattern);
+        *dirty &= ~bit;
+    }
+    return vdp->pattern_cache + (hflip ? PATTERN_HFLIP : 0) +
+        64 * pattern + 8 * row;
 }
 
 /*
-    Draw the background of the current scanline.
+    Render the background of the current scanline into a line buffer.
+
+    Each tile's row is copied whole, which is why the buffer has margins: the
+    first and last tiles are partly off-screen when scrolling horizontally.
+    Tiles with priority set mark their pixels in the mask; mask_sprites()
+    later clears this for transparent pixels.
 */
-static void draw_background(VDP *vdp, uint8_t *colbuf)
+static void draw_background(VDP *vdp, LineBuffer *line)
 {
     uint8_t src_row = (vdp->v_counter + get_bg_vscroll(vdp)) % (28 << 3);
-    uint8_t dst_row = vdp->v_counter - 0x18;
     uint8_t vcell = src_row >> 3;
     uint8_t hcell, col;
 
@@ -227,61 +352,141 @@ static void draw_background(VDP *vdp, uint8_t *colbuf)
         bool     vflip    = tile & 0x0400;
         bool     hflip    = tile & 0x0200;
 
-        uint8_t vshift = vflip ? (7 - src_row % 8) : (src_row % 8), hshift;
-        uint8_t pixel, index;
-        int16_t dst_col;
-        uint16_t color;
-
-        for (pixel = 0; pixel < 8; pixel++) {
-            dst_col = ((col - 6) << 3) + pixel + fine_scroll;
-            if (dst_col < 0 || dst_col >= 160)
-                continue;
-
-            hshift = hflip ? (7 - pixel) : pixel;
-            index = read_pattern(vdp, pattern, vshift, hshift);
-            if (is_display_visible(vdp))
-                color = get_color(vdp, index, palette);
-            else
-                color = get_color(vdp, get_backdrop_color(vdp), 1);
-            draw_pixel(vdp, dst_row, dst_col, color);
-
-            if (priority && index != 0)
-                colbuf[dst_col] |= COLBUF_BG_PRIORITY;
-        }
+        uint8_t vshift = vflip ? (7 - src_row % 8) : (src_row % 8);
+        const uint8_t *indices = read_pattern_row(vdp, pattern, vshift, hflip);
+        unsigned pos = LINE_MARGIN + ((col - 6) << 3) + fine_scroll;
+        uint64_t row;
+
+        memcpy(&row, indices, 8);
+        if (palette)
+            row |= 0x1010101010101010ULL;
+        memcpy(line->bg + pos, &row, 8);
+        memset(line->mask + pos, priority ? 0xFF : 0x00, 8);
     }
 }
 
 /*
-    Draw sprites in the current scanline.
+    Finish the sprite mask of a line buffer once its background is drawn.
+
+    High-priority tiles only hide sprites where they aren't transparent, and
+    sprites are always hidden in the margins.
 */
-static void draw_sprites(VDP *vdp, uint8_t *colbuf)
+static void mask_sprites(const VDP *vdp, LineBuffer *line)
 {
-    uint8_t *sat = vdp->vram + get_sat_base(vdp);
-    uint8_t spritebuf[8], nsprites = 0, i;
-    uint8_t height = get_sprite_height(vdp);
+    memset(line->mask, 0xFF, LINE_MARGIN);
+    memset(line->mask + LINE_MARGIN + 160, 0xFF, LINE_MARGIN);
 
-    for (i = 0; i < 64; i++) {
+#ifdef VDP_SIMD
+    if (vdp->simd == SIMD_AVX2) {
+        mask_sprites_avx2(line);
+        return;
+    }
+    if (vdp->simd == SIMD_SSE2) {
+        mask_sprites_sse2(line);
+        return;
+    }
+#else
+    (void) vdp;
+#endif
+
+    for (unsigned i = LINE_MARGIN; i < LINE_MARGIN + 160; i++) {
+        if (!(line->bg[i] & 0x0F))
+            line->mask[i] = 0x00;
+    }
+}
+
+/*
+    Merge one row of a sprite into a line buffer at the given position.
+
+    Transparent and masked pixels are skipped. Return whether any of the
+    sprite's visible pixels landed on another sprite's.
+*/
+static bool merge_sprite(const VDP *vdp, LineBuffer *line, unsigned pos,
+                         const uint8_t *indices)
+{
+#ifdef VDP_SIMD
+    if (vdp->simd != SIMD_NONE)
+        return merge_sprite_sse2(line, pos, indices);
+#else
+    (void) vdp;
+#endif
+
+    bool collision = false;
+    for (unsigned pixel = 0; pixel < 8; pixel++) {
+        if (!indices[pixel] || line->mask[pos + pixel])
+            continue;
+        if (line->sprites[pos + pixel])
+            collision = true;
+        line->sprites[pos + pixel] = indices[pixel];
+    }
+    return collision;
+}
+
+/*
+    Work out which sprites appear on each line, in priority order.
+
+    This is what the VDP does at the start of every line, but the result only
+    depends on the first 64 bytes of the sprite attribute table (the Y
+    coordinates) and the sprite height, so we keep it until one of those
+    changes. A line with more than eight sprites has a count of nine, which
+    means it overflowed; its list holds the first eight.
+*/
+static void evaluate_sprites(VDP *vdp)
+{
+    const uint8_t *sat = vdp->vram + get_sat_base(vdp);
+    unsigned height = get_sprite_height(vdp) * 8;
+
+    memset(vdp->sprite_count, 0x00, sizeof(vdp->sprite_count));
+    for (uint8_t i = 0; i < 64; i++) {
         uint8_t y = sat[i] + 1;
         if (y == 0xD0 + 1)
             break;
-        if (vdp->v_counter >= y && vdp->v_counter < y + (height * 8)) {
-            if (nsprites >= 8) {
-                vdp->flags |= FLAG_SPR_OVF;
-                break;
-            }
-            spritebuf[nsprites++] = i;
+
+        for (unsigned line = y; line < y + height && line < 256; line++) {
+            uint8_t count = vdp->sprite_count[line];
+            if (count < VDP_LINE_SPRITES)
+                vdp->sprite_lines[line][count] = i;
+            if (count <= VDP_LINE_SPRITES)
+                vdp->sprite_count[line] = count + 1;
         }
     }
+    vdp->sprites_dirty = false;
+}
+
+/*
+    Render sprites in the current scanline into a line buffer.
+
+    Sprites are merged from last to first, so earlier ones end up on top.
+*/
+static void draw_sprites(VDP *vdp, LineBuffer *line)
+{
+    uint8_t *sat = vdp->vram + get_sat_base(vdp);
+    uint8_t nsprites, i;
+    uint8_t height = get_sprite_height(vdp);
+
+    memset(line->sprites, 0x00, LINE_SIZE);
+
+    if (vdp->sprites_dirty)
+        evaluate_sprites(vdp);
 
-    uint8_t dst_row = vdp->v_counter - 0x18;
+    const uint8_t *spritebuf = vdp->sprite_lines[vdp->v_counter];
+    nsprites = vdp->sprite_count[vdp->v_counter];
+    if (nsprites > VDP_LINE_SPRITES) {
+        vdp->flags |= FLAG_SPR_OVF;
+        nsprites = VDP_LINE_SPRITES;
+    }
 
     while (nsprites-- > 0) {
         i = spritebuf[nsprites];
         uint8_t y = sat[i] + 1;
         uint8_t x = sat[0x80 + 2 * i];
+        int16_t dst_col = x - (6 << 3);
         uint8_t vshift;
         uint16_t pattern;
 
+        if (dst_col <= -8 || dst_col >= 160)
+            continue;
+
         if (height == 1) {
             pattern = get_sgt_offset(vdp) + sat[0x80 + 2 * i + 1];
             vshift = vdp->v_counter - y;
@@ -293,45 +498,122 @@ static void draw_sprites(VDP *vdp, uint8_t *colbuf)
             // TODO: sprite doubling
         }
 
-        uint8_t pixel, index;
-        uint16_t color;
-        int16_t dst_col;
-
-        for (pixel = 0; pixel < 8; pixel++) {
-            dst_col = x + pixel - (6 << 3);
-            if (dst_col < 0 || dst_col >= 160)
-                continue;
-            if (colbuf[dst_col] & COLBUF_BG_PRIORITY)
-                continue;
-
-            index = read_pattern(vdp, pattern, vshift, pixel);
-            if (index == 0)
-                continue;
-
-            if (colbuf[dst_col] & COLBUF_OPAQUE_SPRITE)
-                vdp->flags |= FLAG_SPR_COL;
-            else
-                colbuf[dst_col] |= COLBUF_OPAQUE_SPRITE;
-
-            if (is_display_visible(vdp)) {
-                color = get_color(vdp, index, 1);
-                draw_pixel(vdp, dst_row, dst_col, color);
-            }
-        }
+        const uint8_t *indices = read_pattern_row(vdp, pattern, vshift, false);
+        if (merge_sprite(vdp, line, LINE_MARGIN + dst_col, indices))
+            vdp->flags |= FLAG_SPR_COL;
+    }
+}
+
+/*
+    Combine the background and sprites of a line buffer into its bg array.
+*/
+static void merge_line(const VDP *vdp, LineBuffer *line)
+{
+#ifdef VDP_SIMD
+    if (vdp->simd == SIMD_AVX2) {
+        merge_line_avx2(line);
+        return;
     }
+    if (vdp->simd == SIMD_SSE2) {
+        merge_line_sse2(line);
+        return;
+    }
+#else
+    (void) vdp;
+#endif
+
+    for (unsigned i = LINE_MARGIN; i < LINE_MARGIN + 160; i++) {
+        if (line->sprites[i])
+            line->bg[i] = line->sprites[i] | 0x10;
+    }
+}
+
+/*
+    Return a pointer to the given row of our pixel array.
+*/
+static void* get_pixel_row(const VDP *vdp, uint8_t y)
+{
+    size_t pitch = vdp->pitch;
+    if (!pitch)
+        pitch = 160 * (vdp->pixel_format == VDP_PIXEL_RGB565 ? 2 : 4);
+    return (uint8_t*) vdp->pixels + y * pitch;
+}
+
+/*
+    Write a finished line buffer to our pixel array as host colors.
+*/
+static void expand_line(const VDP *vdp, const LineBuffer *line, uint8_t y)
+{
+    const uint8_t *colors = line->bg + LINE_MARGIN;
+    void *row = get_pixel_row(vdp, y);
+
+#ifdef VDP_SIMD
+    if (vdp->simd == SIMD_AVX2) {
+        expand_line_avx2(vdp, colors, row);
+        return;
+    }
+#endif
+
+    if (vdp->pixel_format == VDP_PIXEL_RGB565) {
+        uint16_t *dst = row;
+        for (unsigned x = 0; x < 160; x++)
+            dst[x] = vdp->palette[colors[x]];
+    } else {
+        uint32_t *dst = row;
+        for (unsigned x = 0; x < 160; x++)
+            dst[x] = vdp->palette[colors[x]];
+    }
+}
+
+/*
+    Set the current scanline's sprite flags without drawing it.
+
+    Only lines with two or more sprites can collide, and only if the flag
+    isn't set already; those still need their background, since high-priority
+    tiles hide sprites from each other.
+*/
+static void check_sprites(VDP *vdp)
+{
+    if (vdp->sprites_dirty)
+        evaluate_sprites(vdp);
+
+    uint8_t count = vdp->sprite_count[vdp->v_counter];
+    if (count > VDP_LINE_SPRITES)
+        vdp->flags |= FLAG_SPR_OVF;
+    if (count < 2 || vdp->flags & FLAG_SPR_COL)
+        return;
+
+    LineBuffer line;
+    draw_background(vdp, &line);
+    mask_sprites(vdp, &line);
+    draw_sprites(vdp, &line);
 }
 
 /*
     Draw the current scanline.
+
+    The line is built as palette indices first and only converted to host
+    colors at the end, so the layers can be merged many pixels at a time.
 */
 static void draw_scanline(VDP *vdp)
 {
     if (!vdp->pixels)
         return;
+    if (vdp->skip) {
+        check_sprites(vdp);
+        return;
+    }
 
-    uint8_t colbuf[160] = {0x00};
-    draw_background(vdp, colbuf);
-    draw_sprites(vdp, colbuf);
+    LineBuffer line;
+    draw_background(vdp, &line);
+    mask_sprites(vdp, &line);
+    draw_sprites(vdp, &line);
+
+    if (is_display_visible(vdp))
+        merge_line(vdp, &line);
+    else
+        memset(line.bg + LINE_MARGIN, 16 + get_backdrop_color(vdp), 160);
+    expand_line(vdp, &line, vdp->v_counter - 0x18);
 }
 
 /*
@@ -370,14 +652,96 @@ static void advance_scanline(VDP *vdp)
 */
 void vdp_simulate_line(VDP *vdp)
 {
-    if (vdp->v_counter >= 0x18 && vdp->v_counter < 0xA8)
-        draw_scanline(vdp);
+    if (vdp->v_counter == 0x18 && !vdp->skip) {
+        vdp->was_dirty = vdp->dirty;
+        vdp->dirty = false;
+    }
+    if (vdp->v_counter >= 0x18 && vdp->v_counter < 0xA8) {
+        if (vdp->renderer)
+            render_line(vdp);
+        else
+            draw_scanline(vdp);
+    }
     if (vdp->v_counter == 0xC0)
         vdp->flags |= FLAG_FRAME_INT;
     update_line_counter(vdp);
     advance_scanline(vdp);
 }
 
+/*
+    Return whether the last frame drawn may look different from the one drawn
+    before it.
+
+    Anything that changes the display (VRAM, CRAM, or register writes that
+    change a value, or a new pixel format) marks the VDP dirty. A frame is
+    unchanged only if nothing was marked from the start of the previous drawn
+    frame until now, since a change partway through that frame also affects
+    its top half in this one. Skipped frames don't count as drawn.
+*/
+bool vdp_frame_changed(const VDP *vdp)
+{
+    return vdp->dirty || vdp->was_dirty;
+}
+
+/*
+    Save the VDP's state, for restoring later with vdp_load_state().
+
+    Only the VDP's own memory and registers are saved; the pattern and
+    sprite caches are rebuilt from them on load. If drawing is threaded,
+    this collects the sprite flags the render thread has found so far.
+*/
+void vdp_save_state(VDP *vdp, VDPState *state)
+{
+    if (vdp->renderer)
+        render_collect_flags(vdp);
+
+    memcpy(state->vram, vdp->vram, VDP_VRAM_SIZE);
+    memcpy(state->cram, vdp->cram, VDP_CRAM_SIZE);
+    memcpy(state->regs, vdp->regs, VDP_REGS);
+
+    state->h_counter = vdp->h_counter;
+    state->v_counter = vdp->v_counter;
+    state->v_count_jump = vdp->v_count_jump;
+
+    state->flags = vdp->flags;
+    state->control_code = vdp->control_code;
+    state->control_addr = vdp->control_addr;
+    state->line_count = vdp->line_count;
+    state->read_buf = vdp->read_buf;
+    state->cram_latch = vdp->cram_latch;
+}
+
+/*
+    Restore the VDP's state from one saved by vdp_save_state().
+
+    The display, pixel format, and render thread are kept as they are.
+*/
+void vdp_load_state(VDP *vdp, const VDPState *state)
+{
+    memcpy(vdp->vram, state->vram, VDP_VRAM_SIZE);
+    memcpy(vdp->cram, state->cram, VDP_CRAM_SIZE);
+    memcpy(vdp->regs, state->regs, VDP_REGS);
+    memset(vdp->pattern_dirty, 0xFF, sizeof(vdp->pattern_dirty));
+    vdp->sprites_dirty = true;
+    for (uint8_t index = 0; index < VDP_COLORS; index++)
+        update_color(vdp, index);
+
+    vdp->h_counter = state->h_counter;
+    vdp->v_counter = state->v_counter;
+    vdp->v_count_jump = state->v_count_jump;
+
+    vdp->flags = state->flags;
+    vdp->control_code = state->control_code;
+    vdp->control_addr = state->control_addr & 0x3FFF;
+    vdp->line_count = state->line_count;
+    vdp->read_buf = state->read_buf;
+    vdp->cram_latch = state->cram_latch;
+    vdp->dirty = vdp->was_dirty = true;
+
+    if (vdp->renderer)
+        render_reset(vdp);
+}
+
 /*
     Read a byte from the VDP's control port, revealing status flags.
 
@@ -394,6 +758,9 @@ void vdp_simulate_line(VDP *vdp)
 */
 uint8_t vdp_read_control(VDP *vdp)
 {
+    if (vdp->renderer)
+        render_collect_flags(vdp);
+
     uint8_t status =
         (!!(vdp->flags & FLAG_FRAME_INT) << 7) +
         (!!(vdp->flags & FLAG_SPR_OVF)   << 6) +
@@ -423,7 +790,16 @@ uint8_t vdp_read_data(VDP *vdp)
 */
 static void write_reg(VDP *vdp, uint8_t reg, uint8_t byte)
 {
+    // Sprite evaluation depends on the sprite height and the SAT's location:
+    if ((reg == 0x01 && (vdp->regs[reg] ^ byte) & 0x02) ||
+        (reg == 0x05 && (vdp->regs[reg] ^ byte) & 0x7E))
+        vdp->sprites_dirty = true;
+    // The line counter's reload value is the only register not drawn with:
+    if (reg != 0x0A && vdp->regs[reg] != byte)
+        vdp->dirty = true;
     vdp->regs[reg] = byte;
+    if (vdp->renderer)
+        render_push(vdp, OP_REG, reg, byte);
 }
 
 /*
@@ -462,30 +838,59 @@ void vdp_write_control(VDP *vdp, uint8_t byte)
 
 /*
     Write a byte into CRAM. Handles even/odd address latching.
+
+    A color takes effect once its high byte is written, which also updates the
+    palette of host colors.
 */
 static void write_cram(VDP *vdp, uint8_t byte)
 {
     if (!(vdp->control_addr % 2)) {
         vdp->cram_latch = byte;
     } else {
-        vdp->cram[(vdp->control_addr - 1) & 0x3F] = vdp->cram_latch;
-        vdp->cram[ vdp->control_addr      & 0x3F] = byte & 0x0F;
+        uint8_t addr = vdp->control_addr & 0x3F;
+        if (vdp->cram[addr - 1] != vdp->cram_latch ||
+            vdp->cram[addr] != (byte & 0x0F))
+            vdp->dirty = true;
+        vdp->cram[addr - 1] = vdp->cram_latch;
+        vdp->cram[addr] = byte & 0x0F;
+        update_color(vdp, addr >> 1);
+        if (vdp->renderer) {
+            render_push(vdp, OP_CRAM, addr - 1, vdp->cram_latch);
+            render_push(vdp, OP_CRAM, addr, byte & 0x0F);
+        }
     }
 }
 
+/*
+    Write a byte to VRAM, invalidating anything we've derived from it.
+*/
+static void write_vram(VDP *vdp, uint16_t addr, uint8_t byte)
+{
+    vdp->dirty = true;
+    vdp->vram[addr] = byte;
+    vdp->pattern_dirty[addr >> 10] |= 1U << ((addr >> 5) & 0x1F);
+    if ((addr & 0x3FC0) == get_sat_base(vdp))
+        vdp->sprites_dirty = true;
+}
+
 /*
     Write a byte into the VDP's data port.
 
     Depending on the control code, this either writes into the VRAM or CRAM at
     the current control address, which is then incremented. The control flag is
-    also reset, and the read buffer is squashed.
+    also reset, and the read buffer is squashed. Games often rewrite VRAM with
+    what's already there (like the sprite table, every frame), so those writes
+    are dropped before they can invalidate anything.
 */
 void vdp_write_data(VDP *vdp, uint8_t byte)
 {
-    if (vdp->control_code == CODE_CRAM_WRITE)
+    if (vdp->control_code == CODE_CRAM_WRITE) {
         write_cram(vdp, byte);
-    else
-        vdp->vram[vdp->control_addr] = byte;
+    } else if (vdp->vram[vdp->control_addr] != byte) {
+        write_vram(vdp, vdp->control_addr, byte);
+        if (vdp->renderer)
+            render_push(vdp, OP_VRAM, vdp->control_addr, byte);
+    }
 
     vdp->control_addr = (vdp->control_addr + 1) & 0x3FFF;
     vdp->flags &= ~FLAG_CONTROL;
@@ -524,3 +929,5 @@ void vdp_dump_registers(const VDP *vdp)
     DEBUG("- $09:  0x%02X (VS)", regs[0x09])
     DEBUG("- $0A:  0x%02X (LC)", regs[0x0A])
 }
+
+#include "vdp_thread.inc.c"
@@ -4,17 +4,37 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
+#include "util.h"
+
 #define VDP_LINES_PER_FRAME 262
 #define VDP_VRAM_SIZE (16 * 1024)
 #define VDP_CRAM_SIZE (64)
 #define VDP_REGS 11
+#define VDP_PATTERNS (VDP_VRAM_SIZE / 32)
+#define VDP_COLORS (VDP_CRAM_SIZE / 2)
+#define VDP_LINE_SPRITES 8
 
 /* Structs */
 
+typedef enum {
+    VDP_PIXEL_ARGB8888 = 0,
+    VDP_PIXEL_RGB565   = 1,
+    VDP_PIXEL_CUSTOM   = 2
+} VDPPixelFormat;
+
+typedef struct VDPRenderer VDPRenderer;
+
 typedef struct {
-    uint32_t *pixels;
+    void *pixels;
+    size_t pitch;
+    bool skip;
+    VDPPixelFormat pixel_format;
+    const uint32_t *color_table;
+    uint32_t palette[VDP_COLORS];
+    SIMDLevel simd;
 
     uint8_t  *vram;
     uint8_t  *cram;
@@ -30,14 +50,48 @@ typedef struct {
     uint8_t  line_count;
     uint8_t  read_buf;
     uint8_t  cram_latch;
+
+    uint8_t  *pattern_cache;
+    uint32_t pattern_dirty[VDP_PATTERNS / 32];
+
+    uint8_t  sprite_count[256];
+    uint8_t  sprite_lines[256][VDP_LINE_SPRITES];
+    bool     sprites_dirty;
+
+    bool     dirty, was_dirty;
+
+    VDPRenderer *renderer;
 } VDP;
 
+typedef struct {
+    uint8_t  vram[VDP_VRAM_SIZE];
+    uint8_t  cram[VDP_CRAM_SIZE];
+    uint8_t  regs[VDP_REGS];
+
+    uint8_t  h_counter;
+    uint8_t  v_counter;
+    bool     v_count_jump;
+
+    uint8_t  flags;
+    uint8_t  control_code;
+    uint16_t control_addr;
+    uint8_t  line_count;
+    uint8_t  read_buf;
+    uint8_t  cram_latch;
+} VDPState;
+
 /* Functions */
 
 void vdp_init(VDP*);
 void vdp_free(VDP*);
 void vdp_power(VDP*);
+void vdp_set_pixel_format(VDP*, VDPPixelFormat, const uint32_t*);
+bool vdp_set_threaded(VDP*, bool);
+void vdp_sync(VDP*);
 void vdp_simulate_line(VDP*);
+bool vdp_frame_changed(const VDP*);
+void vdp_save_state(VDP*, VDPState*);
+void vdp_load_state(VDP*, const VDPState*);
 
 uint8_t vdp_read_control(VDP*);
 uint8_t vdp_read_data(VDP*);
@@ -0,0 +1,149 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    This file contains the x86-64 vector versions of the VDP's scanline
+    compositor. It is included near the top of vdp.c and should not be
+    compiled separately.
+
+    Each routine does exactly what the plain C loop it replaces in vdp.c does,
+    only 8, 16, or 32 pixels at a time. SSE2 is part of x86-64, so those are
+    always usable; the AVX2 ones are compiled for it with a target attribute
+    and only called when vdp_init() finds the host supports it.
+
+    Expanding a line to host colors needs a gather, which SSE2 doesn't have,
+    so without AVX2 that step stays in plain C.
+*/
+
+#include <immintrin.h>
+
+/*
+    Clear the sprite mask under transparent background pixels, 16 at a time.
+*/
+static void mask_sprites_sse2(LineBuffer *line)
+{
+    const __m128i zero = _mm_setzero_si128(), low = _mm_set1_epi8(0x0F);
+
+    for (unsigned i = LINE_MARGIN; i < LINE_MARGIN + 160; i += 16) {
+        __m128i bg = _mm_loadu_si128((const __m128i*) (line->bg + i));
+        __m128i mask = _mm_loadu_si128((const __m128i*) (line->mask + i));
+        __m128i clear = _mm_cmpeq_epi8(_mm_and_si128(bg, low), zero);
+        _mm_storeu_si128((__m128i*) (line->mask + i),
+                         _mm_andnot_si128(clear, mask));
+    }
+}
+
+/*
+    Clear the sprite mask under transparent background pixels, 32 at a time.
+*/
+TARGET_AVX2
+static void mask_sprites_avx2(LineBuffer *line)
+{
+    const __m256i zero = _mm256_setzero_si256(), low = _mm256_set1_epi8(0x0F);
+
+    for (unsigned i = LINE_MARGIN; i < LINE_MARGIN + 160; i += 32) {
+        __m256i bg = _mm256_loadu_si256((const __m256i*) (line->bg + i));
+        __m256i mask = _mm256_loadu_si256((const __m256i*) (line->mask + i));
+        __m256i clear = _mm256_cmpeq_epi8(_mm256_and_si256(bg, low), zero);
+        _mm256_storeu_si256((__m256i*) (line->mask + i),
+                            _mm256_andnot_si256(clear, mask));
+    }
+}
+
+/*
+    Merge one row of a sprite into a line buffer, all eight pixels at once.
+
+    A pixel is hidden if it's transparent or masked; visible pixels replace
+    whatever is below them and collide with any sprite already there.
+*/
+static bool merge_sprite_sse2(LineBuffer *line, unsigned pos,
+                              const uint8_t *indices)
+{
+    const __m128i zero = _mm_setzero_si128(), ones = _mm_set1_epi8(-1);
+    __m128i new = _mm_loadl_epi64((const __m128i*) indices);
+    __m128i old = _mm_loadl_epi64((const __m128i*) (line->sprites + pos));
+    __m128i mask = _mm_loadl_epi64((const __m128i*) (line->mask + pos));
+
+    __m128i hidden = _mm_or_si128(_mm_cmpeq_epi8(new, zero), mask);
+    __m128i empty = _mm_cmpeq_epi8(old, zero);
+    __m128i overlap = _mm_andnot_si128(_mm_or_si128(hidden, empty), ones);
+
+    _mm_storel_epi64((__m128i*) (line->sprites + pos),
+                     _mm_or_si128(_mm_and_si128(hidden, old),
+                                  _mm_andnot_si128(hidden, new)));
+    return _mm_movemask_epi8(overlap) != 0;
+}
+
+/*
+    Put opaque sprite pixels over the background, 16 at a time.
+*/
+static void merge_line_sse2(LineBuffer *line)
+{
+    const __m128i zero = _mm_setzero_si128(), high = _mm_set1_epi8(0x10);
+
+    for (unsigned i = LINE_MARGIN; i < LINE_MARGIN + 160; i += 16) {
+        __m128i bg = _mm_loadu_si128((const __m128i*) (line->bg + i));
+        __m128i spr = _mm_loadu_si128((const __m128i*) (line->sprites + i));
+        __m128i empty = _mm_cmpeq_epi8(spr, zero);
+        __m128i fg = _mm_or_si128(spr, high);
+        _mm_storeu_si128((__m128i*) (line->bg + i),
+                         _mm_or_si128(_mm_and_si128(empty, bg),
+                                      _mm_andnot_si128(empty, fg)));
+    }
+}
+
+/*
+    Put opaque sprite pixels over the background, 32 at a time.
+*/
+TARGET_AVX2
+static void merge_line_avx2(LineBuffer *line)
+{
+    const __m256i zero = _mm256_setzero_si256(), high = _mm256_set1_epi8(0x10);
+
+    for (unsigned i = LINE_MARGIN; i < LINE_MARGIN + 160; i += 32) {
+        __m256i bg = _mm256_loadu_si256((const __m256i*) (line->bg + i));
+        __m256i spr = _mm256_loadu_si256((const __m256i*) (line->sprites + i));
+        __m256i empty = _mm256_cmpeq_epi8(spr, zero);
+        __m256i fg = _mm256_or_si256(spr, high);
+        _mm256_storeu_si256((__m256i*) (line->bg + i),
+                            _mm256_blendv_epi8(fg, bg, empty));
+    }
+}
+
+/*
+    Look up the host colors of eight palette indices with a gather.
+*/
+TARGET_AVX2
+static __m256i gather_colors(const VDP *vdp, const uint8_t *colors)
+{
+    __m256i index = _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64((const __m128i*) colors));
+    return _mm256_i32gather_epi32((const int*) vdp->palette, index, 4);
+}
+
+/*
+    Write a line of palette indices to a row of pixels as host colors.
+
+    RGB565 colors are gathered as 32-bit values, then packed down to 16 bits;
+    they never exceed 0xFFFF, so the saturating pack is exact.
+*/
+TARGET_AVX2
+static void expand_line_avx2(const VDP *vdp, const uint8_t *colors,
+                             void *row)
+{
+    if (vdp->pixel_format == VDP_PIXEL_RGB565) {
+        uint16_t *dst = row;
+        for (unsigned x = 0; x < 160; x += 16) {
+            __m256i lo = gather_colors(vdp, colors + x);
+            __m256i hi = gather_colors(vdp, colors + x + 8);
+            __m256i packed = _mm256_permute4x64_epi64(
+                _mm256_packus_epi32(lo, hi), 0xD8);
+            _mm256_storeu_si256((__m256i*) (dst + x), packed);
+        }
+    } else {
+        uint32_t *dst = row;
+        for (unsigned x = 0; x < 160; x += 8)
+            _mm256_storeu_si256((__m256i*) (dst + x),
+                                gather_colors(vdp, colors + x));
+    }
+}
@@ -0,0 +1,306 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    This file contains the VDP's optional render thread. It is included at the
+    end of vdp.c and should not be compiled separately.
+
+    While the thread runs, the VDP doesn't draw scanlines itself. Instead, it
+    keeps a journal of everything that affects drawing (VRAM, CRAM, and
+    register writes) along with each line it would have drawn. A worker thread
+    replays the journal into a private copy of the VDP, the shadow, which
+    draws those lines into the display while the CPU keeps running.
+
+    The only results of drawing the emulated game can see are the sprite
+    overflow and collision flags, so reading the status register waits for the
+    worker to catch up and collects them. Anything reading the display should
+    call vdp_sync() first.
+*/
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* Must be a power of two */
+#define RENDER_QUEUE_SIZE (1 << 16)
+
+/* The thread is woken up to draw lines in batches of this many (which must
+   divide the 144 visible lines), keeping context switches to a few a frame */
+#define RENDER_BATCH_LINES 48
+
+typedef struct {
+    uint8_t  kind;
+    uint8_t  value;
+    uint16_t addr;
+} RenderOp;
+
+struct VDPRenderer {
+    VDP shadow;
+    RenderOp *queue;
+    atomic_uint head, tail;
+    atomic_uint flags;
+    atomic_bool sleeping;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t wake, drained;
+    bool running;
+};
+
+/*
+    Apply one journal entry to the shadow VDP.
+*/
+static void render_apply(VDPRenderer *r, RenderOp op)
+{
+    VDP *shadow = &r->shadow;
+
+    switch (op.kind) {
+        case OP_VRAM:
+            write_vram(shadow, op.addr, op.value);
+            break;
+        case OP_CRAM:
+            shadow->cram[op.addr] = op.value;
+            update_color(shadow, op.addr >> 1);
+            break;
+        case OP_REG:
+            write_reg(shadow, op.addr, op.value);
+            break;
+        case OP_LINE:
+            shadow->v_counter = op.addr;
+            shadow->skip = op.value;
+            draw_scanline(shadow);
+            if (shadow->flags) {
+                atomic_fetch_or(&r->flags, shadow->flags);
+                shadow->flags = 0;
+            }
+            break;
+    }
+}
+
+/*
+    Main function of the render thread.
+
+    Replay the journal whenever there's something in it, and sleep otherwise,
+    waking up anyone waiting in vdp_sync() first. Stop once the renderer is
+    shut down and the journal is empty.
+*/
+static void* render_main(void *arg)
+{
+    VDPRenderer *r = arg;
+    unsigned tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+
+    pthread_mutex_lock(&r->lock);
+    while (true) {
+        atomic_store(&r->sleeping, true);
+        unsigned head = atomic_load(&r->head);
+        if (tail == head) {
+            if (!r->running)
+                break;
+            pthread_cond_broadcast(&r->drained);
+            pthread_cond_wait(&r->wake, &r->lock);
+            continue;
+        }
+        atomic_store(&r->sleeping, false);
+
+        pthread_mutex_unlock(&r->lock);
+        while (tail != head) {
+            render_apply(r, r->queue[tail++ % RENDER_QUEUE_SIZE]);
+            if (tail % 256 == 0)
+                atomic_store_explicit(&r->tail, tail, memory_order_release);
+        }
+        atomic_store_explicit(&r->tail, tail, memory_order_release);
+        pthread_mutex_lock(&r->lock);
+    }
+    pthread_mutex_unlock(&r->lock);
+    return NULL;
+}
+
+/*
+    Wake up the render thread if it's waiting for work.
+
+    The thread marks itself as sleeping before its last look at the journal,
+    and we only check after adding to it, so one of us always sees the other.
+*/
+static void render_wake(VDPRenderer *r)
+{
+    if (!atomic_load(&r->sleeping))
+        return;
+    pthread_mutex_lock(&r->lock);
+    pthread_cond_signal(&r->wake);
+    pthread_mutex_unlock(&r->lock);
+}
+
+/*
+    Add an entry to the render thread's journal.
+
+    If the journal is full, wait for the thread to empty it.
+*/
+static void render_push(VDP *vdp, uint8_t kind, uint16_t addr, uint8_t value)
+{
+    VDPRenderer *r = vdp->renderer;
+    unsigned head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+
+    if (head - tail == RENDER_QUEUE_SIZE)
+        vdp_sync(vdp);
+    r->queue[head % RENDER_QUEUE_SIZE] = (RenderOp) {kind, value, addr};
+    atomic_store(&r->head, head + 1);
+}
+
+/*
+    Queue the current scanline to be drawn by the render thread.
+
+    Like draw_scanline(), nothing is drawn without a display. The shadow picks
+    up display changes only while the thread is idle. The last visible line
+    ends a batch, so a frame is always handed over in full.
+*/
+static void render_line(VDP *vdp)
+{
+    VDPRenderer *r = vdp->renderer;
+
+    if (vdp->pixels != r->shadow.pixels || vdp->pitch != r->shadow.pitch) {
+        vdp_sync(vdp);
+        r->shadow.pixels = vdp->pixels;
+        r->shadow.pitch = vdp->pitch;
+    }
+    if (!vdp->pixels)
+        return;
+
+    render_push(vdp, OP_LINE, vdp->v_counter, vdp->skip);
+    if ((vdp->v_counter - 0x18) % RENDER_BATCH_LINES == RENDER_BATCH_LINES - 1)
+        render_wake(r);
+}
+
+/*
+    Wait for the render thread to draw everything queued so far, then fold
+    the sprite flags it produced into the VDP's own.
+*/
+static void render_collect_flags(VDP *vdp)
+{
+    vdp_sync(vdp);
+    vdp->flags |= atomic_exchange(&vdp->renderer->flags, 0);
+}
+
+/*
+    Give the shadow the VDP's current pixel format.
+*/
+static void render_set_pixel_format(VDP *vdp)
+{
+    vdp_sync(vdp);
+    vdp_set_pixel_format(&vdp->renderer->shadow, vdp->pixel_format,
+                         vdp->color_table);
+}
+
+/*
+    Copy the VDP's whole state into the shadow, discarding pending flags.
+*/
+static void render_reset(VDP *vdp)
+{
+    VDPRenderer *r = vdp->renderer;
+    VDP *shadow = &r->shadow;
+
+    vdp_sync(vdp);
+    memcpy(shadow->vram, vdp->vram, VDP_VRAM_SIZE);
+    memcpy(shadow->cram, vdp->cram, VDP_CRAM_SIZE);
+    memcpy(shadow->regs, vdp->regs, VDP_REGS);
+    memset(shadow->pattern_dirty, 0xFF, sizeof(shadow->pattern_dirty));
+    shadow->sprites_dirty = true;
+    shadow->pixels = vdp->pixels;
+    shadow->pitch = vdp->pitch;
+    shadow->simd = vdp->simd;
+    shadow->flags = 0;
+    vdp_set_pixel_format(shadow, vdp->pixel_format, vdp->color_table);
+    atomic_store(&r->flags, 0);
+}
+
+/*
+    Free a renderer whose thread isn't running.
+*/
+static void render_free(VDPRenderer *r)
+{
+    pthread_cond_destroy(&r->drained);
+    pthread_cond_destroy(&r->wake);
+    pthread_mutex_destroy(&r->lock);
+    vdp_free(&r->shadow);
+    free(r->queue);
+    free(r);
+}
+
+/*
+    Shut down the render thread, after it draws everything queued so far.
+*/
+static void render_stop(VDP *vdp)
+{
+    VDPRenderer *r = vdp->renderer;
+
+    render_collect_flags(vdp);
+    pthread_mutex_lock(&r->lock);
+    r->running = false;
+    pthread_cond_signal(&r->wake);
+    pthread_mutex_unlock(&r->lock);
+    pthread_join(r->thread, NULL);
+
+    render_free(r);
+    vdp->renderer = NULL;
+}
+
+/*
+    Set whether scanlines are drawn on a separate thread.
+
+    This can be changed at any time. Return false if the thread couldn't be
+    started, in which case the VDP keeps drawing scanlines itself.
+*/
+bool vdp_set_threaded(VDP *vdp, bool threaded)
+{
+    if (!threaded) {
+        if (vdp->renderer)
+            render_stop(vdp);
+        return true;
+    }
+    if (vdp->renderer)
+        return true;
+
+    VDPRenderer *r = cr_malloc(sizeof(VDPRenderer));
+    vdp_init(&r->shadow);
+    r->queue = cr_malloc(sizeof(RenderOp) * RENDER_QUEUE_SIZE);
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+    atomic_init(&r->flags, 0);
+    atomic_init(&r->sleeping, false);
+    pthread_mutex_init(&r->lock, NULL);
+    pthread_cond_init(&r->wake, NULL);
+    pthread_cond_init(&r->drained, NULL);
+    r->running = true;
+
+    vdp->renderer = r;
+    render_reset(vdp);
+
+    if (pthread_create(&r->thread, NULL, render_main, r)) {
+        ERROR("couldn't start the render thread")
+        render_free(r);
+        vdp->renderer = NULL;
+        return false;
+    }
+    return true;
+}
+
+/*
+    Wait until the render thread has drawn every scanline queued so far.
+
+    This does nothing if the VDP isn't threaded. Afterwards, the display is
+    safe to read until the VDP simulates another line.
+*/
+void vdp_sync(VDP *vdp)
+{
+    VDPRenderer *r = vdp->renderer;
+    if (!r)
+        return;
+
+    unsigned head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    if (atomic_load_explicit(&r->tail, memory_order_acquire) == head)
+        return;
+
+    pthread_mutex_lock(&r->lock);
+    pthread_cond_signal(&r->wake);
+    while (atomic_load_explicit(&r->tail, memory_order_acquire) != head)
+        pthread_cond_wait(&r->drained, &r->lock);
+    pthread_mutex_unlock(&r->lock);
+}
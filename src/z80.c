@@ -1,8 +1,26 @@
 /* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
    Released under the terms of the MIT License. See LICENSE for details. */
 
+/*
+    The optional JIT (see z80_jit.inc.c) emits x86-64 code and needs mmap().
+    Build with -DZ80_NO_JIT to leave it out.
+*/
+#if defined(__x86_64__) && defined(__unix__) && !defined(Z80_NO_JIT)
+#define Z80_JIT
+#define _DEFAULT_SOURCE
+#endif
+
+#include <stddef.h>
+#include <string.h>
+
+#ifdef Z80_JIT
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "z80.h"
 #include "disassembler.h"
+#include "disassembler/sizes.h"
 #include "logging.h"
 #include "util.h"
 
@@ -16,6 +34,28 @@
 #define FLAG_ZERO      6
 #define FLAG_SIGN      7
 
+/* Kinds of pending flag computations (see z80_flags.inc.c) */
+#define LAZY_NONE 0
+#define LAZY_ADD8 1
+#define LAZY_SUB8 2
+#define LAZY_CP   3
+#define LAZY_AND  4
+#define LAZY_OR   5
+#define LAZY_INC  6
+#define LAZY_DEC  7
+
+/* Indices of the dispatch tables, as stored in decoded instructions */
+#define TABLE_MAIN       0
+#define TABLE_EXTENDED   1
+#define TABLE_BITS       2
+#define TABLE_INDEX      3
+#define TABLE_INDEX_BITS 4
+
+static void init_flag_tables();
+#ifdef Z80_JIT
+static void jit_stop(Z80*);
+#endif
+
 /*
     Initialize a Z80 object.
 
@@ -29,6 +69,23 @@ void z80_init(Z80 *z80, MMU *mmu, IO *io)
     z80->except = true;
     z80->exc_code = Z80_EXC_NOT_POWERED;
     z80->exc_data = 0;
+    init_flag_tables();
+    z80->cache.blocks = cr_malloc(sizeof(Z80Block) * Z80_CACHE_BLOCKS);
+    z80->jit.mode = Z80_JIT_OFF;
+    z80->jit.buffer = z80->jit.next = NULL;
+    z80->jit.perf_map = NULL;
+    z80->jit.snapshots = NULL;
+}
+
+/*
+    Free memory previously allocated by the Z80.
+*/
+void z80_free(Z80 *z80)
+{
+#ifdef Z80_JIT
+    jit_stop(z80);
+#endif
+    free(z80->cache.blocks);
 }
 
 /*
@@ -59,25 +116,46 @@ void z80_power(Z80 *z80)
 
     z80->regs.im_a = z80->regs.im_b = 0;
     z80->regs.iff1 = z80->regs.iff2 = 0;
+    z80->regs.flag_op = LAZY_NONE;
 
     z80->regs.ixy = NULL;
     z80->regs.ih = z80->regs.il = NULL;
 
     z80->except = false;
-    z80->pending_cycles = 0;
+    z80->clock = 0;
     z80->irq_wait = false;
+    z80->halted = false;
 
     z80->trace.fresh = true;
     z80->trace.last_addr = 0;
     z80->trace.counter = 0;
+
+    for (size_t i = 0; i < Z80_CACHE_BLOCKS; i++)
+        z80->cache.blocks[i].count = 0;
+    z80->cache.block = NULL;
+    z80->cache.instr = NULL;
 }
 
+static inline uint8_t resolve_flags(const Z80*);
+
 /*
     Return whether a particular flag is set in the F register.
+
+    If the flags are pending, the commonly tested ones (carry, zero, and sign)
+    come straight from the saved result, without working out the whole byte.
 */
 static inline bool get_flag(const Z80 *z80, uint8_t flag)
 {
-    return z80->regs.f & (1 << flag);
+    const Z80RegFile *rf = &z80->regs;
+
+    if (rf->flag_op != LAZY_NONE) {
+        switch (flag) {
+            case FLAG_CARRY: return rf->flag_res & 0x100;
+            case FLAG_ZERO:  return !(rf->flag_res & 0xFF);
+            case FLAG_SIGN:  return rf->flag_res & 0x80;
+        }
+    }
+    return resolve_flags(z80) & (1 << flag);
 }
 
 /*
@@ -89,13 +167,25 @@ static inline bool get_shadow_flag(const Z80 *z80, uint8_t flag)
 }
 
 /*
-    Update the F register flags according to the set bits in the mask.
+    Store any pending flag computation in the F register.
+
+    This must be done before anything reads or writes F directly.
 */
-static inline void set_flags(Z80 *z80,
-    bool c, bool n, bool pv, bool f3, bool h, bool f5, bool z, bool s,
-    uint8_t mask)
+static inline void update_flags(Z80 *z80)
+{
+    if (z80->regs.flag_op != LAZY_NONE) {
+        z80->regs.f = resolve_flags(z80);
+        z80->regs.flag_op = LAZY_NONE;
+    }
+}
+
+/*
+    Return the value of the F register with the given flags.
+*/
+static inline uint8_t pack_flags(
+    bool c, bool n, bool pv, bool f3, bool h, bool f5, bool z, bool s)
 {
-    uint8_t new = (
+    return (
         c  << FLAG_CARRY     |
         n  << FLAG_SUBTRACT  |
         pv << FLAG_PARITY    |
@@ -105,7 +195,20 @@ static inline void set_flags(Z80 *z80,
         z  << FLAG_ZERO      |
         s  << FLAG_SIGN
     );
+}
+
+/*
+    Update the F register flags according to the set bits in the mask.
+*/
+static inline void set_flags(Z80 *z80,
+    bool c, bool n, bool pv, bool f3, bool h, bool f5, bool z, bool s,
+    uint8_t mask)
+{
+    uint8_t new = pack_flags(c, n, pv, f3, h, f5, z, s);
+    if (mask != 0xFF)
+        update_flags(z80);
     z80->regs.f = (~mask & z80->regs.f) | (mask & new);
+    z80->regs.flag_op = LAZY_NONE;
 }
 
 #include "z80_flags.inc.c"
@@ -183,7 +286,7 @@ static inline uint16_t* extract_pair_qq(Z80 *z80, uint8_t opcode)
         case 0x00: return &z80->regs.bc;
         case 0x10: return &z80->regs.de;
         case 0x20: return &z80->regs.hl;
-        case 0x30: return &z80->regs.af;
+        case 0x30: update_flags(z80); return &z80->regs.af;
     }
     FATAL("invalid call: extract_pair_qq(z80, 0x%02X)", opcode)
 }
@@ -206,12 +309,32 @@ static inline bool extract_cond(const Z80 *z80, uint8_t opcode)
     FATAL("invalid call: extract_cond(z80, 0x%02X)", opcode)
 }
 
+/*
+    Read a byte of the current instruction from the given address.
+
+    Instruction bytes come from the decode cache, not the MMU, so handlers
+    must use this (instead of mmu_read_byte()) to read their operands.
+*/
+static inline uint8_t read_operand(const Z80 *z80, uint16_t addr)
+{
+    const Z80Instr *instr = z80->cache.instr;
+    return instr->bytes[(uint16_t) (addr - instr->pc) & 0x03];
+}
+
+/*
+    Read two bytes of the current instruction from the given address.
+*/
+static inline uint16_t read_operand_double(const Z80 *z80, uint16_t addr)
+{
+    return read_operand(z80, addr) + (read_operand(z80, addr + 1) << 8);
+}
+
 /*
     Return the address signified by a indirect index instruction.
 */
 static inline uint16_t get_index_addr(Z80 *z80, uint16_t offset_addr)
 {
-    return *z80->regs.ixy + ((int8_t) mmu_read_byte(z80->mmu, offset_addr));
+    return *z80->regs.ixy + ((int8_t) read_operand(z80, offset_addr));
 }
 
 /*
@@ -253,6 +376,138 @@ static inline void increment_refresh_counter(Z80 *z80)
     z80->regs.r = (z80->regs.r & 0x80) | ((z80->regs.r + 1) & 0x7F);
 }
 
+/*
+    Fast-forward a halted CPU through the given number of cycles.
+
+    While halted, the Z80 executes NOPs (refreshing memory) until it accepts
+    an interrupt. The VDP only raises its IRQ line between calls to
+    z80_run_until(), so if no interrupt was accepted at the start of the
+    budget, none can be until it runs out; we consume it all in one step
+    instead of spinning. Return the number of cycles consumed.
+*/
+static inline uint64_t skip_halted_cycles(Z80 *z80, uint64_t cycles)
+{
+    uint64_t nops = (cycles + 3) / 4;
+
+    z80->regs.r = (z80->regs.r & 0x80) | ((z80->regs.r + nops) & 0x7F);
+    return nops * 4;
+}
+
+/*
+    Decode the instruction at the given address.
+
+    Prefix bytes are resolved here, mirroring the Z80_PREFIX entries in the
+    dispatch tables: the result names the table and opcode of the handler to
+    run, and how far to advance PC (past the prefixes) before running it.
+    Return the length of the instruction in bytes.
+*/
+static size_t decode_instruction(const Z80 *z80, uint16_t pc, Z80Instr *instr)
+{
+    uint8_t *bytes = instr->bytes;
+    for (uint8_t i = 0; i < 4; i++)
+        bytes[i] = mmu_read_byte(z80->mmu, pc + i);
+
+    instr->pc = pc;
+    instr->prefix = 0;
+    instr->skip = 1;
+    instr->opcode = bytes[1];
+
+    switch (bytes[0]) {
+        case 0xED:
+            instr->table = TABLE_EXTENDED;
+            break;
+        case 0xCB:
+            instr->table = TABLE_BITS;
+            break;
+        case 0xDD:
+        case 0xFD:
+            instr->prefix = bytes[0];
+            if (bytes[1] == 0xCB) {
+                instr->table = TABLE_INDEX_BITS;
+                instr->opcode = bytes[3];
+                instr->skip = 3;
+            } else {
+                instr->table = TABLE_INDEX;
+            }
+            break;
+        default:
+            instr->table = TABLE_MAIN;
+            instr->opcode = bytes[0];
+            instr->skip = 0;
+    }
+    return get_instr_size(bytes);
+}
+
+/*
+    Decode a block of straight-line code starting at the given address.
+
+    Decoding stops after Z80_CACHE_BLOCK_INSTRS instructions, or before one
+    that would cross into the next 1 KB page (which may be mapped elsewhere).
+    It does not stop at branches: if one is taken, execution simply leaves
+    the block, and any instructions decoded past it are unused.
+*/
+static void decode_block(Z80 *z80, Z80Block *block, uint16_t pc)
+{
+    uint32_t addr = pc, end = (pc | 0x03FF) + 1;
+
+    block->pc = pc;
+    block->source = mmu_map_code(z80->mmu, pc);
+    block->ram = mmu_watch_code(z80->mmu, pc);
+    block->code_gen = z80->mmu->code_gen[pc >> MMU_PAGE_BITS];
+    block->map_gen = z80->mmu->map_gen;
+    block->count = 0;
+    block->native = NULL;
+    block->hits = 0;
+
+    while (block->count < Z80_CACHE_BLOCK_INSTRS) {
+        Z80Instr *instr = &block->instrs[block->count];
+        addr += decode_instruction(z80, addr, instr);
+        if (addr > end)
+            break;
+        block->count++;
+    }
+}
+
+/*
+    Return whether a cached block decoded from RAM has since been modified.
+
+    Blocks never cross a page, so only the generation of their own page
+    matters.
+*/
+static inline bool block_is_stale(const Z80 *z80, const Z80Block *block)
+{
+    return block->ram &&
+        block->code_gen != z80->mmu->code_gen[block->pc >> MMU_PAGE_BITS];
+}
+
+/*
+    Find the decoded instruction at the given address, decoding it if needed.
+
+    Blocks are cached by address, and are reused only if the address still
+    maps to the same memory (i.e., the same bank) and, for RAM, nothing has
+    been written to the block's page since it was decoded.
+*/
+static const Z80Instr* lookup_instruction(Z80 *z80, uint16_t pc)
+{
+    Z80DecodeCache *cache = &z80->cache;
+    Z80Block *block = &cache->blocks[pc & (Z80_CACHE_BLOCKS - 1)];
+
+    if (!block->count || block->pc != pc || block_is_stale(z80, block) ||
+            block->source != mmu_map_code(z80->mmu, pc))
+        decode_block(z80, block, pc);
+    else
+        block->map_gen = z80->mmu->map_gen;
+
+    if (!block->count) {  // Instruction crosses a page; don't cache it
+        cache->block = NULL;
+        decode_instruction(z80, pc, &cache->scratch);
+        return &cache->scratch;
+    }
+    cache->block = block;
+    cache->next = 1;
+    return &block->instrs[0];
+}
+
 #include "z80_ops.inc.c"
 
 /*
@@ -286,34 +541,184 @@ static inline void trace_instruction(Z80 *z80)
 }
 
 /*
-    Emulate the given number of cycles of the Z80, or until an exception.
+    Handle interrupts and the HALT state before the next instruction.
+
+    Return the number of cycles consumed. If this is nonzero, no instruction
+    should be fetched until the caller has checked its cycle budget again.
+*/
+static inline uint64_t service_cpu_state(Z80 *z80, uint64_t cycles)
+{
+    if (io_check_irq(z80->io) && z80->regs.iff1 && !z80->irq_wait) {
+        z80->halted = false;
+        return accept_interrupt(z80);
+    }
+    if (z80->irq_wait)
+        z80->irq_wait = false;
+    if (z80->halted)
+        return skip_halted_cycles(z80, cycles);
+    return 0;
+}
+
+/*
+    Fetch the next instruction and prepare to run its handler.
+
+    This follows the current cached block while PC stays inside it and the
+    memory map is unchanged, and falls back to a full lookup after a branch
+    (or a bank switch, or anything else unexpected). PC is
+    advanced past any prefix bytes, and the instruction becomes the source of
+    operands for read_operand().
+*/
+static inline const Z80Instr* fetch_instruction(Z80 *z80)
+{
+    Z80DecodeCache *cache = &z80->cache;
+    const Z80Block *block = cache->block;
+    const Z80Instr *instr;
+
+    if (block && cache->next < block->count &&
+            block->instrs[cache->next].pc == z80->regs.pc &&
+            block->map_gen == z80->mmu->map_gen && !block_is_stale(z80, block))
+        instr = &block->instrs[cache->next++];
+    else
+        instr = lookup_instruction(z80, z80->regs.pc);
+
+    increment_refresh_counter(z80);
+    if (TRACE_LEVEL)
+        trace_instruction(z80);
+
+    if (instr->prefix)
+        select_index_register(z80, instr->prefix);
+    z80->regs.pc += instr->skip;
+    cache->instr = instr;
+    return instr;
+}
+
+#ifdef Z80_JIT
+#include "z80_jit.inc.c"
+#endif
+
+/*
+    Set the JIT mode: Z80_JIT_OFF, Z80_JIT_ON, or Z80_JIT_VERIFY.
+
+    Return false if the JIT isn't supported on this platform or couldn't be
+    started, in which case the Z80 stays in the interpreter.
+*/
+bool z80_set_jit(Z80 *z80, uint8_t mode)
+{
+#ifdef Z80_JIT
+    if (mode != Z80_JIT_OFF) {
+        if (TRACE_LEVEL || !jit_start(z80))
+            return false;
+        if (mode == Z80_JIT_VERIFY && !z80->jit.snapshots)
+            z80->jit.snapshots = cr_malloc(2 * sizeof(JitSnapshot));
+    }
+    z80->jit.mode = mode;
+    return true;
+#else
+    (void) z80;
+    return mode == Z80_JIT_OFF;
+#endif
+}
+
+/*
+    Emulate the Z80 until its clock reaches the given cycle, or an exception.
 
     The return value indicates whether the exception flag is set. If it is,
-    then emulation must be stopped because further calls to z80_do_cycles()
+    then emulation must be stopped because further calls to z80_run_until()
     will have no effect. The exception flag can be reset with z80_power().
 */
-bool z80_do_cycles(Z80 *z80, double cycles)
+bool z80_run_until(Z80 *z80, uint64_t until)
 {
-    cycles += z80->pending_cycles;
-    while (cycles > 0 && !z80->except) {
-        if (io_check_irq(z80->io) && z80->regs.iff1 && !z80->irq_wait) {
-            cycles -= accept_interrupt(z80);
+    uint64_t clock = z80->clock;
+    while (clock < until && !z80->except) {
+        uint64_t spent = service_cpu_state(z80, until - clock);
+        if (spent) {
+            clock += spent;
+            continue;
+        }
+#ifdef Z80_JIT
+        if (z80->jit.mode && (spent = jit_try(z80, until - clock))) {
+            clock += spent;
             continue;
         }
-        if (z80->irq_wait)
-            z80->irq_wait = false;
-
-        uint8_t opcode = mmu_read_byte(z80->mmu, z80->regs.pc);
-        increment_refresh_counter(z80);
-        if (TRACE_LEVEL)
-            trace_instruction(z80);
-        cycles -= (*instruction_table[opcode])(z80, opcode);
+#endif
+
+        z80->clock = clock;  // For I/O, which reads it to time port writes
+        const Z80Instr *instr = fetch_instruction(z80);
+        clock += (*instruction_tables[instr->table])[instr->opcode](
+            z80, instr->opcode);
     }
 
-    z80->pending_cycles = cycles;
+    z80->clock = clock;
     return z80->except;
 }
 
+/*
+    Store the Z80's flags in the F register.
+
+    Flags are computed lazily, so this must be called before reading F (or
+    AF) from the register file directly.
+*/
+void z80_sync_flags(Z80 *z80)
+{
+    update_flags(z80);
+}
+
+/*
+    Save the Z80's state, for restoring later with z80_load_state().
+
+    Flags are synced first, so the state holds F itself rather than whatever
+    the lazy flags were in the middle of. The index register pointers are
+    saved as which register they point to, since their addresses won't mean
+    anything to the Z80 that loads the state.
+*/
+void z80_save_state(Z80 *z80, Z80State *state)
+{
+    update_flags(z80);
+    state->regs = z80->regs;
+    state->regs.ixy = NULL;
+    state->regs.ih = state->regs.il = NULL;
+    state->index = z80->regs.ixy == &z80->regs.iy ? Z80_INDEX_IY :
+                   z80->regs.ixy == &z80->regs.ix ? Z80_INDEX_IX :
+                   Z80_INDEX_NONE;
+    state->clock = z80->clock;
+    state->irq_wait = z80->irq_wait;
+    state->halted = z80->halted;
+}
+
+/*
+    Restore the Z80's state from one saved by z80_save_state().
+
+    The decode cache is kept: instructions decoded from RAM are checked
+    against their page's code generation before they're reused, which the MMU
+    bumps when it loads its own state.
+*/
+void z80_load_state(Z80 *z80, const Z80State *state)
+{
+    z80->regs = state->regs;
+    z80->regs.flag_op = LAZY_NONE;
+
+    if (state->index == Z80_INDEX_IY) {
+        z80->regs.ixy = &z80->regs.iy;
+        z80->regs.ih  = &z80->regs.iyh;
+        z80->regs.il  = &z80->regs.iyl;
+    } else if (state->index == Z80_INDEX_IX) {
+        z80->regs.ixy = &z80->regs.ix;
+        z80->regs.ih  = &z80->regs.ixh;
+        z80->regs.il  = &z80->regs.ixl;
+    } else {
+        z80->regs.ixy = NULL;
+        z80->regs.ih = z80->regs.il = NULL;
+    }
+
+    z80->except = false;
+    z80->clock = state->clock;
+    z80->irq_wait = state->irq_wait;
+    z80->halted = state->halted;
+    z80->trace.fresh = true;
+    z80->cache.block = NULL;
+    z80->cache.instr = NULL;
+}
+
 /*
     @DEBUG_LEVEL
     Print out all register values to stdout.
@@ -323,7 +728,9 @@ void z80_dump_registers(const Z80 *z80)
     const Z80RegFile *rf = &z80->regs;
     DEBUG("Dumping Z80 register values:")
 
-    DEBUG("- AF:   0x%04X (%03d, %03d)", rf->af, rf->a, rf->f)
+    uint8_t f = resolve_flags(z80);
+
+    DEBUG("- AF:   0x%04X (%03d, %03d)", rf->a << 8 | f, rf->a, f)
     DEBUG("- BC:   0x%04X (%03d, %03d)", rf->bc, rf->b, rf->c)
     DEBUG("- DE:   0x%04X (%03d, %03d)", rf->de, rf->d, rf->e)
     DEBUG("- HL:   0x%04X (%03d, %03d)", rf->hl, rf->h, rf->l)
@@ -342,7 +749,7 @@ void z80_dump_registers(const Z80 *z80)
     DEBUG("- R:    0x%2X (%03d)", rf->r, rf->r)
 
     DEBUG("- F:    "BINARY_FMT" (C: %u, N: %u, P/V: %u, H: %u, Z: %u, S: %u)",
-          BINARY_VAL(rf->f),
+          BINARY_VAL(f),
           get_flag(z80, FLAG_CARRY),
           get_flag(z80, FLAG_SUBTRACT),
           get_flag(z80, FLAG_PARITY),
@@ -5,12 +5,25 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 
 #include "io.h"
 #include "mmu.h"
 
 #define Z80_EXC_NOT_POWERED          0
 #define Z80_EXC_UNIMPLEMENTED_OPCODE 1
+#define Z80_EXC_JIT_MISMATCH         2
+
+#define Z80_CACHE_BLOCKS       4096
+#define Z80_CACHE_BLOCK_INSTRS 16
+
+#define Z80_JIT_OFF    0
+#define Z80_JIT_ON     1
+#define Z80_JIT_VERIFY 2
+
+#define Z80_INDEX_NONE 0
+#define Z80_INDEX_IX   1
+#define Z80_INDEX_IY   2
 
 /* Structs */
 
@@ -50,6 +63,9 @@ typedef struct {
     bool     im_a, im_b;
     bool     iff1, iff2;
 
+    uint8_t  flag_op, flag_lh;
+    uint16_t flag_rh, flag_res;
+
     uint16_t *ixy;
     uint8_t *ih, *il;
 } Z80RegFile;
@@ -60,17 +76,62 @@ typedef struct {
     uint64_t counter;
 } Z80TraceInfo;
 
+typedef struct {
+    uint16_t pc;
+    uint8_t bytes[4];
+    uint8_t table, opcode;
+    uint8_t prefix, skip;
+} Z80Instr;
+
+typedef struct {
+    const uint8_t *source;
+    uint32_t code_gen, map_gen;
+    uint16_t pc;
+    bool ram;
+    uint8_t count;
+    Z80Instr instrs[Z80_CACHE_BLOCK_INSTRS];
+    void *native;
+    uint16_t hits;
+    uint8_t native_count;
+} Z80Block;
+
+typedef struct {
+    Z80Block *blocks;
+    const Z80Block *block;
+    uint8_t next;
+    const Z80Instr *instr;
+    Z80Instr scratch;
+} Z80DecodeCache;
+
+typedef struct {
+    uint8_t mode;
+    uint8_t *buffer, *next;
+    FILE *perf_map;
+    void *snapshots;
+} Z80Jit;
+
 typedef struct {
     Z80RegFile regs;
     MMU *mmu;
     IO *io;
     bool except;
     uint8_t exc_code, exc_data;
-    double pending_cycles;
+    uint64_t clock;
     bool irq_wait;
+    bool halted;
     Z80TraceInfo trace;
+    Z80DecodeCache cache;
+    Z80Jit jit;
 } Z80;
 
+typedef struct {
+    Z80RegFile regs;
+    uint64_t clock;
+    bool irq_wait;
+    bool halted;
+    uint8_t index;
+} Z80State;
+
 #undef REG_PAIR
 #undef REG1
 #undef REG2
@@ -78,6 +139,11 @@ typedef struct {
 /* Functions */
 
 void z80_init(Z80*, MMU*, IO*);
+void z80_free(Z80*);
 void z80_power(Z80*);
-bool z80_do_cycles(Z80*, double);
+void z80_sync_flags(Z80*);
+void z80_save_state(Z80*, Z80State*);
+void z80_load_state(Z80*, const Z80State*);
+bool z80_set_jit(Z80*, uint8_t);
+bool z80_run_until(Z80*, uint64_t);
 void z80_dump_registers(const Z80*);
@@ -22,15 +22,179 @@
 #define F3(x) ((x) & 0x08)
 #define F5(x) ((x) & 0x20)
 
+/*
+    The F register values for the most common instructions are looked up in
+    tables, which init_flag_tables() fills in once from the formulas below.
+    Operands for ADD/ADC and SUB/SBC include the carry, so they go up to 0x100.
+*/
+static uint8_t flag_table_add[256][257];    // [A][operand]: ADD, ADC
+static uint8_t flag_table_sub[256][257];    // [A][operand]: SUB, SBC, CP
+static uint8_t flag_table_szp[256];         // [result]: AND, OR, XOR, etc
+static uint8_t flag_table_inc[256];         // [operand]: INC, except carry
+static uint8_t flag_table_dec[256];         // [operand]: DEC, except carry
+static uint16_t daa_table[0x800];           // [H, N, C, A]: AF after DAA
+
+/*
+    Return the flags for an 8-bit ADD or ADC instruction.
+*/
+static uint8_t compute_flags_add8(uint8_t lh, uint16_t rh)
+{
+    uint8_t res = lh + rh;
+    return pack_flags(CARRY(lh, +, rh), !SUB, OV_ADD(lh, rh, res), F3(res),
+        HALF(lh, +, rh), F5(res), ZERO(res), SIGN(res));
+}
+
+/*
+    Return the flags for an 8-bit SUB or SBC instruction.
+*/
+static uint8_t compute_flags_sub8(uint8_t lh, uint16_t rh)
+{
+    uint8_t res = lh - rh;
+    return pack_flags(CARRY(lh, -, rh), SUB, OV_SUB(lh, rh, res), F3(res),
+        HALF(lh, -, rh), F5(res), ZERO(res), SIGN(res));
+}
+
+/*
+    Return the sign, zero, parity, and undocumented flags for a result.
+*/
+static uint8_t compute_flags_szp(uint8_t res)
+{
+    return pack_flags(0, 0, PARITY(res), F3(res), 0, F5(res), ZERO(res),
+        SIGN(res));
+}
+
+/*
+    Return the flags (other than carry) for an 8-bit INC instruction.
+*/
+static uint8_t compute_flags_inc(uint8_t val)
+{
+    uint8_t res = val + 1;
+    return pack_flags(0, !SUB, OV_ADD(val, 1, res), F3(res), HALF(val, +, 1),
+        F5(res), ZERO(res), SIGN(res));
+}
+
+/*
+    Return the flags (other than carry) for an 8-bit DEC instruction.
+*/
+static uint8_t compute_flags_dec(uint8_t val)
+{
+    uint8_t res = val - 1;
+    return pack_flags(0, SUB, OV_SUB(val, 1, res), F3(res), HALF(val, -, 1),
+        F5(res), ZERO(res), SIGN(res));
+}
+
+/*
+    Return the new value of AF after a DAA instruction.
+*/
+static uint16_t compute_daa(uint8_t a, bool c, bool n, bool h)
+{
+    uint8_t adjust = 0x00;
+
+    if ((a & 0x0F) > 0x09 || h)
+        adjust += 0x06;
+
+    uint8_t temp = n ? (a - adjust) : (a + adjust);
+    if ((temp >> 4) > 0x09 || c)
+        adjust += 0x60;
+
+    uint8_t res = a + (n ? -adjust : adjust);
+    bool half = n ? (h && (a & 0x0F) < 0x06) : ((a & 0x0F) > 0x09);
+    uint8_t f = pack_flags(adjust >= 0x60, n, PARITY(res), F3(res), half,
+        F5(res), ZERO(res), SIGN(res));
+    return res << 8 | f;
+}
+
+/*
+    Fill in the flag lookup tables, if that hasn't been done already.
+*/
+static void init_flag_tables()
+{
+    static bool ready = false;
+    if (ready)
+        return;
+
+    for (unsigned lh = 0; lh < 0x100; lh++) {
+        for (unsigned rh = 0; rh <= 0x100; rh++) {
+            flag_table_add[lh][rh] = compute_flags_add8(lh, rh);
+            flag_table_sub[lh][rh] = compute_flags_sub8(lh, rh);
+        }
+        flag_table_szp[lh] = compute_flags_szp(lh);
+        flag_table_inc[lh] = compute_flags_inc(lh);
+        flag_table_dec[lh] = compute_flags_dec(lh);
+    }
+    for (unsigned i = 0; i < 0x800; i++)
+        daa_table[i] = compute_daa(i, i & 0x100, i & 0x200, i & 0x400);
+    ready = true;
+}
+
+/*
+    Replace the F register, and any pending flags, with the given value.
+*/
+static inline void store_flags(Z80 *z80, uint8_t f)
+{
+    z80->regs.f = f;
+    z80->regs.flag_op = LAZY_NONE;
+}
+
+/*
+    The most common arithmetic and logic instructions don't set their flags
+    right away, since they are usually overwritten by the next one before
+    anything reads them. Instead, they save the kind of operation, its
+    operands, and its result (with the carry in bit 8) in the register file,
+    and the F register is worked out only when it is needed: by get_flag(),
+    by an instruction that sets only some of the flags, or by update_flags()
+    before F is accessed directly (PUSH AF, EX AF, AF', etc).
+*/
+
+/*
+    Save a pending flag computation.
+*/
+static inline void defer_flags(Z80 *z80, uint8_t op, uint8_t lh, uint16_t rh,
+                               uint16_t res)
+{
+    z80->regs.flag_op = op;
+    z80->regs.flag_lh = lh;
+    z80->regs.flag_rh = rh;
+    z80->regs.flag_res = res;
+}
+
+/*
+    Return the value of the F register, including any pending computation.
+*/
+static inline uint8_t resolve_flags(const Z80 *z80)
+{
+    const Z80RegFile *rf = &z80->regs;
+    uint8_t lh = rf->flag_lh, c = rf->flag_res >> 8;
+    uint16_t rh = rf->flag_rh;
+
+    switch (rf->flag_op) {
+        case LAZY_ADD8:
+            return flag_table_add[lh][rh];
+        case LAZY_SUB8:
+            return flag_table_sub[lh][rh];
+        case LAZY_CP:  // Undocumented flags come from the operand, not result
+            return (flag_table_sub[lh][rh] & ~(F3(0xFF) | F5(0xFF))) |
+                F3(rh) | F5(rh);
+        case LAZY_AND:
+            return flag_table_szp[lh] | 1 << FLAG_HALFCARRY;
+        case LAZY_OR:
+            return flag_table_szp[lh];
+        case LAZY_INC:
+            return flag_table_inc[lh] | c;
+        case LAZY_DEC:
+            return flag_table_dec[lh] | c;
+        default:
+            return rf->f;
+    }
+}
+
 /*
     Set the flags for an 8-bit ADD or ADC instruction.
 */
 static inline void set_flags_add8(Z80 *z80, uint16_t rh)
 {
     uint8_t lh = z80->regs.a;
-    uint8_t res = lh + rh;
-    set_flags(z80, CARRY(lh, +, rh), !SUB, OV_ADD(lh, rh, res), F3(res),
-        HALF(lh, +, rh), F5(res), ZERO(res), SIGN(res), 0xFF);
+    defer_flags(z80, LAZY_ADD8, lh, rh, lh + rh);
 }
 
 /*
@@ -39,9 +203,7 @@ static inline void set_flags_add8(Z80 *z80, uint16_t rh)
 static inline void set_flags_sub8(Z80 *z80, uint16_t rh)
 {
     uint8_t lh = z80->regs.a;
-    uint8_t res = lh - rh;
-    set_flags(z80, CARRY(lh, -, rh), SUB, OV_SUB(lh, rh, res), F3(res),
-        HALF(lh, -, rh), F5(res), ZERO(res), SIGN(res), 0xFF);
+    defer_flags(z80, LAZY_SUB8, lh, rh, lh - rh);
 }
 
 /*
@@ -50,9 +212,7 @@ static inline void set_flags_sub8(Z80 *z80, uint16_t rh)
 static inline void set_flags_cp(Z80 *z80, uint16_t rh)
 {
     uint8_t lh = z80->regs.a;
-    uint8_t res = lh - rh;
-    set_flags(z80, CARRY(lh, -, rh), SUB, OV_SUB(lh, rh, res), F3(rh),
-        HALF(lh, -, rh), F5(rh), ZERO(res), SIGN(res), 0xFF);
+    defer_flags(z80, LAZY_CP, lh, rh, lh - rh);
 }
 
 /*
@@ -60,8 +220,7 @@ static inline void set_flags_cp(Z80 *z80, uint16_t rh)
 */
 static inline void set_flags_bitwise(Z80 *z80, uint8_t res, bool is_and)
 {
-    set_flags(z80, 0, 0, PARITY(res), F3(res), is_and, F5(res), ZERO(res),
-        SIGN(res), 0xFF);
+    defer_flags(z80, is_and ? LAZY_AND : LAZY_OR, res, 0, res);
 }
 
 /*
@@ -69,9 +228,8 @@ static inline void set_flags_bitwise(Z80 *z80, uint8_t res, bool is_and)
 */
 static inline void set_flags_inc(Z80 *z80, uint8_t val)
 {
-    uint8_t res = val + 1;
-    set_flags(z80, 0, !SUB, OV_ADD(val, 1, res), F3(res), HALF(val, +, 1),
-        F5(res), ZERO(res), SIGN(res), 0xFE);
+    uint16_t c = get_flag(z80, FLAG_CARRY);
+    defer_flags(z80, LAZY_INC, val, 1, (uint8_t) (val + 1) | c << 8);
 }
 
 /*
@@ -79,9 +237,8 @@ static inline void set_flags_inc(Z80 *z80, uint8_t val)
 */
 static inline void set_flags_dec(Z80 *z80, uint8_t val)
 {
-    uint8_t res = val - 1;
-    set_flags(z80, 0, SUB, OV_SUB(val, 1, res), F3(res), HALF(val, -, 1),
-        F5(res), ZERO(res), SIGN(res), 0xFE);
+    uint16_t c = get_flag(z80, FLAG_CARRY);
+    defer_flags(z80, LAZY_DEC, val, 1, (uint8_t) (val - 1) | c << 8);
 }
 
 /*
@@ -142,8 +299,7 @@ static inline void set_flags_bitrota(Z80 *z80, uint8_t bit)
 */
 static inline void set_flags_bitshift(Z80 *z80, uint8_t res, uint8_t bit)
 {
-    set_flags(z80, bit, 0, PARITY(res), F3(res), 0, F5(res), ZERO(res),
-        SIGN(res), 0xFF);
+    store_flags(z80, flag_table_szp[res] | bit);
 }
 
 /*
@@ -151,24 +307,8 @@ static inline void set_flags_bitshift(Z80 *z80, uint8_t res, uint8_t bit)
 */
 static inline void set_flags_rd(Z80 *z80)
 {
-    uint8_t a = z80->regs.a;
-    set_flags(z80, 0, 0, PARITY(a), F3(a), 0, F5(a), ZERO(a), SIGN(a), 0xFE);
-}
-
-/*
-    Set the flags for a DAA instruction.
-*/
-static inline void set_flags_daa(Z80 *z80, uint8_t old, uint8_t adjust)
-{
-    uint8_t res = z80->regs.a;
-
-    bool c = adjust >= 0x60;
-    bool h = get_flag(z80, FLAG_SUBTRACT) ?
-        (get_flag(z80, FLAG_HALFCARRY) && (old & 0x0F) < 0x06) :
-        ((old & 0x0F) > 0x09);
-
-    set_flags(z80, c, 0, PARITY(res), F3(res), h, F5(res), ZERO(res),
-        SIGN(res), 0xFD);
+    bool c = get_flag(z80, FLAG_CARRY);
+    store_flags(z80, flag_table_szp[z80->regs.a] | c);
 }
 
 /*
@@ -247,8 +387,8 @@ static inline void set_flags_blockcp(Z80 *z80, uint16_t rh)
 */
 static inline void set_flags_in(Z80 *z80, uint8_t val)
 {
-    set_flags(z80, 0, 0, PARITY(val), F3(val), 0, F5(val), ZERO(val),
-        SIGN(val), 0xFE);
+    bool c = get_flag(z80, FLAG_CARRY);
+    store_flags(z80, flag_table_szp[val] | c);
 }
 
 /*
@@ -0,0 +1,9429 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    This file is AUTO-GENERATED from 'z80_ops.inc.c' and 'z80_tables.inc.c'.
+
+    `make` should trigger a rebuild when either is modified; if not, use:
+    `python scripts/update_z80_handlers.py`.
+
+    It contains one handler for every opcode in the dispatch tables, named
+    <handler>__<opcode>. Handlers that decode operands from their opcode are
+    copied and specialized here, with registers and conditions fixed; the rest
+    are simply aliased to the original handler.
+
+    @AUTOGEN_DATE Fri Oct 16 09:44:37 2026 UTC
+*/
+
+/* @AUTOGEN_HANDLER_BLOCK_START */
+/*
+    ADC A, r (0x88):
+    Specialized from z80_inst_adc_a_r().
+*/
+static uint8_t z80_inst_adc_a_r__0x88(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t value = z80->regs.b;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADC A, r (0x89):
+    Specialized from z80_inst_adc_a_r().
+*/
+static uint8_t z80_inst_adc_a_r__0x89(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t value = z80->regs.c;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADC A, r (0x8A):
+    Specialized from z80_inst_adc_a_r().
+*/
+static uint8_t z80_inst_adc_a_r__0x8A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t value = z80->regs.d;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADC A, r (0x8B):
+    Specialized from z80_inst_adc_a_r().
+*/
+static uint8_t z80_inst_adc_a_r__0x8B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t value = z80->regs.e;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADC A, r (0x8C):
+    Specialized from z80_inst_adc_a_r().
+*/
+static uint8_t z80_inst_adc_a_r__0x8C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t value = z80->regs.h;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADC A, r (0x8D):
+    Specialized from z80_inst_adc_a_r().
+*/
+static uint8_t z80_inst_adc_a_r__0x8D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t value = z80->regs.l;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADC A, r (0x8F):
+    Specialized from z80_inst_adc_a_r().
+*/
+static uint8_t z80_inst_adc_a_r__0x8F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t value = z80->regs.a;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADC HL, ss (0xED4A):
+    Specialized from z80_inst_adc_hl_ss().
+*/
+static uint8_t z80_inst_adc_hl_ss__0x4A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.bc + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl += rh;
+
+    set_flags_adc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    ADC HL, ss (0xED5A):
+    Specialized from z80_inst_adc_hl_ss().
+*/
+static uint8_t z80_inst_adc_hl_ss__0x5A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.de + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl += rh;
+
+    set_flags_adc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    ADC HL, ss (0xED6A):
+    Specialized from z80_inst_adc_hl_ss().
+*/
+static uint8_t z80_inst_adc_hl_ss__0x6A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.hl + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl += rh;
+
+    set_flags_adc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    ADC HL, ss (0xED7A):
+    Specialized from z80_inst_adc_hl_ss().
+*/
+static uint8_t z80_inst_adc_hl_ss__0x7A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.sp + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl += rh;
+
+    set_flags_adc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    ADD A, r (0x80):
+    Specialized from z80_inst_add_a_r().
+*/
+static uint8_t z80_inst_add_a_r__0x80(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.b;
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADD A, r (0x81):
+    Specialized from z80_inst_add_a_r().
+*/
+static uint8_t z80_inst_add_a_r__0x81(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.c;
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADD A, r (0x82):
+    Specialized from z80_inst_add_a_r().
+*/
+static uint8_t z80_inst_add_a_r__0x82(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.d;
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADD A, r (0x83):
+    Specialized from z80_inst_add_a_r().
+*/
+static uint8_t z80_inst_add_a_r__0x83(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.e;
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADD A, r (0x84):
+    Specialized from z80_inst_add_a_r().
+*/
+static uint8_t z80_inst_add_a_r__0x84(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.h;
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADD A, r (0x85):
+    Specialized from z80_inst_add_a_r().
+*/
+static uint8_t z80_inst_add_a_r__0x85(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.l;
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADD A, r (0x87):
+    Specialized from z80_inst_add_a_r().
+*/
+static uint8_t z80_inst_add_a_r__0x87(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.a;
+
+    set_flags_add8(z80, value);
+    z80->regs.a += value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    ADD HL, ss (0x09):
+    Specialized from z80_inst_add_hl_ss().
+*/
+static uint8_t z80_inst_add_hl_ss__0x09(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl, rh = z80->regs.bc;
+    z80->regs.hl += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    ADD HL, ss (0x19):
+    Specialized from z80_inst_add_hl_ss().
+*/
+static uint8_t z80_inst_add_hl_ss__0x19(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl, rh = z80->regs.de;
+    z80->regs.hl += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    ADD HL, ss (0x29):
+    Specialized from z80_inst_add_hl_ss().
+*/
+static uint8_t z80_inst_add_hl_ss__0x29(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl, rh = z80->regs.hl;
+    z80->regs.hl += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    ADD HL, ss (0x39):
+    Specialized from z80_inst_add_hl_ss().
+*/
+static uint8_t z80_inst_add_hl_ss__0x39(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl, rh = z80->regs.sp;
+    z80->regs.hl += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    ADD IXY, pp (0xDD09, 0xFD09):
+    Specialized from z80_inst_add_ixy_pp().
+*/
+static uint8_t z80_inst_add_ixy_pp__0x09(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = *z80->regs.ixy, rh = z80->regs.bc;
+    *z80->regs.ixy += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    ADD IXY, pp (0xDD19, 0xFD19):
+    Specialized from z80_inst_add_ixy_pp().
+*/
+static uint8_t z80_inst_add_ixy_pp__0x19(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = *z80->regs.ixy, rh = z80->regs.de;
+    *z80->regs.ixy += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    ADD IXY, pp (0xDD29, 0xFD29):
+    Specialized from z80_inst_add_ixy_pp().
+*/
+static uint8_t z80_inst_add_ixy_pp__0x29(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = *z80->regs.ixy, rh = *z80->regs.ixy;
+    *z80->regs.ixy += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    ADD IXY, pp (0xDD39, 0xFD39):
+    Specialized from z80_inst_add_ixy_pp().
+*/
+static uint8_t z80_inst_add_ixy_pp__0x39(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = *z80->regs.ixy, rh = z80->regs.sp;
+    *z80->regs.ixy += rh;
+
+    set_flags_add16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    AND r (0xA0):
+    Specialized from z80_inst_and_r().
+*/
+static uint8_t z80_inst_and_r__0xA0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.b;
+    uint8_t res = z80->regs.a &= value;
+
+    set_flags_bitwise(z80, res, true);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    AND r (0xA1):
+    Specialized from z80_inst_and_r().
+*/
+static uint8_t z80_inst_and_r__0xA1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.c;
+    uint8_t res = z80->regs.a &= value;
+
+    set_flags_bitwise(z80, res, true);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    AND r (0xA2):
+    Specialized from z80_inst_and_r().
+*/
+static uint8_t z80_inst_and_r__0xA2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.d;
+    uint8_t res = z80->regs.a &= value;
+
+    set_flags_bitwise(z80, res, true);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    AND r (0xA3):
+    Specialized from z80_inst_and_r().
+*/
+static uint8_t z80_inst_and_r__0xA3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.e;
+    uint8_t res = z80->regs.a &= value;
+
+    set_flags_bitwise(z80, res, true);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    AND r (0xA4):
+    Specialized from z80_inst_and_r().
+*/
+static uint8_t z80_inst_and_r__0xA4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.h;
+    uint8_t res = z80->regs.a &= value;
+
+    set_flags_bitwise(z80, res, true);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    AND r (0xA5):
+    Specialized from z80_inst_and_r().
+*/
+static uint8_t z80_inst_and_r__0xA5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.l;
+    uint8_t res = z80->regs.a &= value;
+
+    set_flags_bitwise(z80, res, true);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    AND r (0xA7):
+    Specialized from z80_inst_and_r().
+*/
+static uint8_t z80_inst_and_r__0xA7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.a;
+    uint8_t res = z80->regs.a &= value;
+
+    set_flags_bitwise(z80, res, true);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    BIT b, (HL) (0xCB46):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x46(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x46 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (HL) (0xCB4E):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x4E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x4E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (HL) (0xCB56):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x56(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x56 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (HL) (0xCB5E):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x5E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x5E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (HL) (0xCB66):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x66(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x66 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (HL) (0xCB6E):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x6E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x6E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (HL) (0xCB76):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x76(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x76 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (HL) (0xCB7E):
+    Specialized from z80_inst_bit_b_hl().
+*/
+static uint8_t z80_inst_bit_b_hl__0x7E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x7E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB40, 0xFDCB40):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x40(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x40 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB41, 0xFDCB41):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x41(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x41 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB42, 0xFDCB42):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x42(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x42 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB43, 0xFDCB43):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x43(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x43 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB44, 0xFDCB44):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x44(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x44 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB45, 0xFDCB45):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x45(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x45 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB46, 0xFDCB46):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x46(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x46 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB47, 0xFDCB47):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x47(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x47 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB48, 0xFDCB48):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x48(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x48 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB49, 0xFDCB49):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x49(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x49 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB4A, 0xFDCB4A):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x4A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x4A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB4B, 0xFDCB4B):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x4B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x4B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB4C, 0xFDCB4C):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x4C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x4C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB4D, 0xFDCB4D):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x4D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x4D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB4E, 0xFDCB4E):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x4E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x4E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB4F, 0xFDCB4F):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x4F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x4F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB50, 0xFDCB50):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x50(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x50 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB51, 0xFDCB51):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x51(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x51 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB52, 0xFDCB52):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x52(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x52 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB53, 0xFDCB53):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x53(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x53 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB54, 0xFDCB54):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x54(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x54 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB55, 0xFDCB55):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x55(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x55 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB56, 0xFDCB56):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x56(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x56 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB57, 0xFDCB57):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x57(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x57 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB58, 0xFDCB58):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x58(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x58 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB59, 0xFDCB59):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x59(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x59 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB5A, 0xFDCB5A):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x5A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x5A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB5B, 0xFDCB5B):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x5B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x5B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB5C, 0xFDCB5C):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x5C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x5C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB5D, 0xFDCB5D):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x5D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x5D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB5E, 0xFDCB5E):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x5E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x5E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB5F, 0xFDCB5F):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x5F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x5F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB60, 0xFDCB60):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x60(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x60 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB61, 0xFDCB61):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x61(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x61 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB62, 0xFDCB62):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x62(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x62 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB63, 0xFDCB63):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x63(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x63 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB64, 0xFDCB64):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x64(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x64 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB65, 0xFDCB65):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x65(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x65 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB66, 0xFDCB66):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x66(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x66 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB67, 0xFDCB67):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x67(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x67 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB68, 0xFDCB68):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x68(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x68 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB69, 0xFDCB69):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x69(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x69 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB6A, 0xFDCB6A):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x6A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x6A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB6B, 0xFDCB6B):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x6B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x6B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB6C, 0xFDCB6C):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x6C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x6C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB6D, 0xFDCB6D):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x6D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x6D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB6E, 0xFDCB6E):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x6E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x6E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB6F, 0xFDCB6F):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x6F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x6F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB70, 0xFDCB70):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x70(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x70 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB71, 0xFDCB71):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x71(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x71 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB72, 0xFDCB72):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x72(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x72 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB73, 0xFDCB73):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x73(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x73 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB74, 0xFDCB74):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x74(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x74 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB75, 0xFDCB75):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x75(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x75 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB76, 0xFDCB76):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x76(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x76 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB77, 0xFDCB77):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x77(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x77 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB78, 0xFDCB78):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x78(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x78 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB79, 0xFDCB79):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x79(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x79 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB7A, 0xFDCB7A):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x7A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x7A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB7B, 0xFDCB7B):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x7B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x7B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB7C, 0xFDCB7C):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x7C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x7C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB7D, 0xFDCB7D):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x7D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x7D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB7E, 0xFDCB7E):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x7E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x7E >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, (IXY+d) (0xDDCB7F, 0xFDCB7F):
+    Specialized from z80_inst_bit_b_ixy().
+*/
+static uint8_t z80_inst_bit_b_ixy__0x7F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x7F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 20;
+}
+
+/*
+    BIT b, r (0xCB40):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x40(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x40 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB41):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x41(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x41 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB42):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x42(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x42 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB43):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x43(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x43 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB44):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x44(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x44 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB45):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x45(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x45 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB47):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x47(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x47 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB48):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x48(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x48 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB49):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x49(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x49 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB4A):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x4A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x4A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB4B):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x4B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x4B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB4C):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x4C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x4C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB4D):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x4D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x4D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB4F):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x4F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x4F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB50):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x50(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x50 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB51):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x51(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x51 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB52):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x52(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x52 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB53):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x53(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x53 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB54):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x54(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x54 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB55):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x55(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x55 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB57):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x57(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x57 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB58):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x58(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x58 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB59):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x59(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x59 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB5A):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x5A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x5A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB5B):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x5B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x5B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB5C):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x5C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x5C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB5D):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x5D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x5D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB5F):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x5F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x5F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB60):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x60(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x60 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB61):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x61(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x61 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB62):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x62(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x62 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB63):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x63(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x63 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB64):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x64(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x64 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB65):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x65(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x65 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB67):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x67(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x67 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB68):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x68(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x68 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB69):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x69(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x69 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB6A):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x6A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x6A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB6B):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x6B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x6B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB6C):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x6C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x6C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB6D):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x6D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x6D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB6F):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x6F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x6F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB70):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x70(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x70 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB71):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x71(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x71 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB72):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x72(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x72 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB73):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x73(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x73 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB74):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x74(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x74 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB75):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x75(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x75 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB77):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x77(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x77 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB78):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x78(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.b;
+    uint8_t bit = (0x78 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB79):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x79(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.c;
+    uint8_t bit = (0x79 >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB7A):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x7A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.d;
+    uint8_t bit = (0x7A >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB7B):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x7B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.e;
+    uint8_t bit = (0x7B >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB7C):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x7C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.h;
+    uint8_t bit = (0x7C >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB7D):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x7D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.l;
+    uint8_t bit = (0x7D >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    BIT b, r (0xCB7F):
+    Specialized from z80_inst_bit_b_r().
+*/
+static uint8_t z80_inst_bit_b_r__0x7F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = z80->regs.a;
+    uint8_t bit = (0x7F >> 3) & 0x07;
+
+    set_flags_bit(z80, val, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    CALL cc, nn (0xC4):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xC4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_ZERO)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CALL cc, nn (0xCC):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xCC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_ZERO)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CALL cc, nn (0xD4):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xD4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_CARRY)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CALL cc, nn (0xDC):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xDC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_CARRY)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CALL cc, nn (0xE4):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xE4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_PARITY)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CALL cc, nn (0xEC):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xEC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_PARITY)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CALL cc, nn (0xF4):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xF4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_SIGN)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CALL cc, nn (0xFC):
+    Specialized from z80_inst_call_cc_nn().
+*/
+static uint8_t z80_inst_call_cc_nn__0xFC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_SIGN)) {
+        stack_push(z80, z80->regs.pc + 3);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+        return 17;
+    } else {
+        z80->regs.pc += 3;
+        return 10;
+    }
+}
+
+/*
+    CP r (0xB8):
+    Specialized from z80_inst_cp_r().
+*/
+static uint8_t z80_inst_cp_r__0xB8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.b;
+
+    set_flags_cp(z80, value);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    CP r (0xB9):
+    Specialized from z80_inst_cp_r().
+*/
+static uint8_t z80_inst_cp_r__0xB9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.c;
+
+    set_flags_cp(z80, value);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    CP r (0xBA):
+    Specialized from z80_inst_cp_r().
+*/
+static uint8_t z80_inst_cp_r__0xBA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.d;
+
+    set_flags_cp(z80, value);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    CP r (0xBB):
+    Specialized from z80_inst_cp_r().
+*/
+static uint8_t z80_inst_cp_r__0xBB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.e;
+
+    set_flags_cp(z80, value);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    CP r (0xBC):
+    Specialized from z80_inst_cp_r().
+*/
+static uint8_t z80_inst_cp_r__0xBC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.h;
+
+    set_flags_cp(z80, value);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    CP r (0xBD):
+    Specialized from z80_inst_cp_r().
+*/
+static uint8_t z80_inst_cp_r__0xBD(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.l;
+
+    set_flags_cp(z80, value);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    CP r (0xBF):
+    Specialized from z80_inst_cp_r().
+*/
+static uint8_t z80_inst_cp_r__0xBF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.a;
+
+    set_flags_cp(z80, value);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC r (0x05):
+    Specialized from z80_inst_dec_r().
+*/
+static uint8_t z80_inst_dec_r__0x05(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+
+    set_flags_dec(z80, *reg);
+    (*reg)--;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC r (0x0D):
+    Specialized from z80_inst_dec_r().
+*/
+static uint8_t z80_inst_dec_r__0x0D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+
+    set_flags_dec(z80, *reg);
+    (*reg)--;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC r (0x15):
+    Specialized from z80_inst_dec_r().
+*/
+static uint8_t z80_inst_dec_r__0x15(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+
+    set_flags_dec(z80, *reg);
+    (*reg)--;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC r (0x1D):
+    Specialized from z80_inst_dec_r().
+*/
+static uint8_t z80_inst_dec_r__0x1D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+
+    set_flags_dec(z80, *reg);
+    (*reg)--;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC r (0x25):
+    Specialized from z80_inst_dec_r().
+*/
+static uint8_t z80_inst_dec_r__0x25(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+
+    set_flags_dec(z80, *reg);
+    (*reg)--;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC r (0x2D):
+    Specialized from z80_inst_dec_r().
+*/
+static uint8_t z80_inst_dec_r__0x2D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+
+    set_flags_dec(z80, *reg);
+    (*reg)--;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC r (0x3D):
+    Specialized from z80_inst_dec_r().
+*/
+static uint8_t z80_inst_dec_r__0x3D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+
+    set_flags_dec(z80, *reg);
+    (*reg)--;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    DEC ss (0x0B):
+    Specialized from z80_inst_dec_ss().
+*/
+static uint8_t z80_inst_dec_ss__0x0B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.bc)--;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    DEC ss (0x1B):
+    Specialized from z80_inst_dec_ss().
+*/
+static uint8_t z80_inst_dec_ss__0x1B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.de)--;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    DEC ss (0x2B):
+    Specialized from z80_inst_dec_ss().
+*/
+static uint8_t z80_inst_dec_ss__0x2B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.hl)--;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    DEC ss (0x3B):
+    Specialized from z80_inst_dec_ss().
+*/
+static uint8_t z80_inst_dec_ss__0x3B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.sp)--;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    IM (0xED46):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x46(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x46) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IM (0xED4E):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x4E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x4E) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IM (0xED56):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x56(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x56) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IM (0xED5E):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x5E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x5E) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IM (0xED66):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x66(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x66) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IM (0xED6E):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x6E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x6E) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IM (0xED76):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x76(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x76) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IM (0xED7E):
+    Specialized from z80_inst_im().
+*/
+static uint8_t z80_inst_im__0x7E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    switch (0x7E) {
+        case 0x46:
+        case 0x4E:
+        case 0x66:
+        case 0x6E:
+            z80->regs.im_a = false;  // Interrupt mode 0
+            z80->regs.im_b = false;
+            break;
+        case 0x56:
+        case 0x76:
+            z80->regs.im_a = true;  // Interrupt mode 1
+            z80->regs.im_b = false;
+            break;
+        case 0x5E:
+        case 0x7E:
+            z80->regs.im_a = true;  // Interrupt mode 2
+            z80->regs.im_b = true;
+            break;
+    }
+
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    IN r, (C) (0xED40):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x40(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x40 != 0x70)
+        z80->regs.b = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    IN r, (C) (0xED48):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x48(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x48 != 0x70)
+        z80->regs.c = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    IN r, (C) (0xED50):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x50(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x50 != 0x70)
+        z80->regs.d = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    IN r, (C) (0xED58):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x58(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x58 != 0x70)
+        z80->regs.e = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    IN r, (C) (0xED60):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x60(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x60 != 0x70)
+        z80->regs.h = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    IN r, (C) (0xED68):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x68(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x68 != 0x70)
+        z80->regs.l = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    IN r, (C) (0xED70):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x70(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x70 != 0x70)
+        *extract_reg(z80, 0x70) = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    IN r, (C) (0xED78):
+    Specialized from z80_inst_in_r_c().
+*/
+static uint8_t z80_inst_in_r_c__0x78(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t data = io_port_read(z80->io, z80->regs.c);
+    if (0x78 != 0x70)
+        z80->regs.a = data;
+
+    set_flags_in(z80, data);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    INC r (0x04):
+    Specialized from z80_inst_inc_r().
+*/
+static uint8_t z80_inst_inc_r__0x04(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+
+    set_flags_inc(z80, *reg);
+    (*reg)++;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    INC r (0x0C):
+    Specialized from z80_inst_inc_r().
+*/
+static uint8_t z80_inst_inc_r__0x0C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+
+    set_flags_inc(z80, *reg);
+    (*reg)++;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    INC r (0x14):
+    Specialized from z80_inst_inc_r().
+*/
+static uint8_t z80_inst_inc_r__0x14(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+
+    set_flags_inc(z80, *reg);
+    (*reg)++;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    INC r (0x1C):
+    Specialized from z80_inst_inc_r().
+*/
+static uint8_t z80_inst_inc_r__0x1C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+
+    set_flags_inc(z80, *reg);
+    (*reg)++;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    INC r (0x24):
+    Specialized from z80_inst_inc_r().
+*/
+static uint8_t z80_inst_inc_r__0x24(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+
+    set_flags_inc(z80, *reg);
+    (*reg)++;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    INC r (0x2C):
+    Specialized from z80_inst_inc_r().
+*/
+static uint8_t z80_inst_inc_r__0x2C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+
+    set_flags_inc(z80, *reg);
+    (*reg)++;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    INC r (0x3C):
+    Specialized from z80_inst_inc_r().
+*/
+static uint8_t z80_inst_inc_r__0x3C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+
+    set_flags_inc(z80, *reg);
+    (*reg)++;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    INC ss (0x03):
+    Specialized from z80_inst_inc_ss().
+*/
+static uint8_t z80_inst_inc_ss__0x03(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.bc)++;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    INC ss (0x13):
+    Specialized from z80_inst_inc_ss().
+*/
+static uint8_t z80_inst_inc_ss__0x13(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.de)++;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    INC ss (0x23):
+    Specialized from z80_inst_inc_ss().
+*/
+static uint8_t z80_inst_inc_ss__0x23(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.hl)++;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    INC ss (0x33):
+    Specialized from z80_inst_inc_ss().
+*/
+static uint8_t z80_inst_inc_ss__0x33(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    (z80->regs.sp)++;
+    z80->regs.pc++;
+    return 6;
+}
+
+/*
+    JP cc, nn (0xC2):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xC2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_ZERO))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JP cc, nn (0xCA):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xCA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_ZERO))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JP cc, nn (0xD2):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xD2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_CARRY))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JP cc, nn (0xDA):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xDA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_CARRY))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JP cc, nn (0xE2):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xE2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_PARITY))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JP cc, nn (0xEA):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xEA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_PARITY))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JP cc, nn (0xF2):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xF2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_SIGN))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JP cc, nn (0xFA):
+    Specialized from z80_inst_jp_cc_nn().
+*/
+static uint8_t z80_inst_jp_cc_nn__0xFA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_SIGN))
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
+    else
+        z80->regs.pc += 3;
+    return 10;
+}
+
+/*
+    JR cc, e (0x20):
+    Specialized from z80_inst_jr_cc_e().
+*/
+static uint8_t z80_inst_jr_cc_e__0x20(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_ZERO)) {
+        int8_t jump = read_operand(z80, z80->regs.pc + 1);
+        z80->regs.pc += jump + 2;
+        return 12;
+    } else {
+        z80->regs.pc += 2;
+        return 7;
+    }
+}
+
+/*
+    JR cc, e (0x28):
+    Specialized from z80_inst_jr_cc_e().
+*/
+static uint8_t z80_inst_jr_cc_e__0x28(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_ZERO)) {
+        int8_t jump = read_operand(z80, z80->regs.pc + 1);
+        z80->regs.pc += jump + 2;
+        return 12;
+    } else {
+        z80->regs.pc += 2;
+        return 7;
+    }
+}
+
+/*
+    JR cc, e (0x30):
+    Specialized from z80_inst_jr_cc_e().
+*/
+static uint8_t z80_inst_jr_cc_e__0x30(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_CARRY)) {
+        int8_t jump = read_operand(z80, z80->regs.pc + 1);
+        z80->regs.pc += jump + 2;
+        return 12;
+    } else {
+        z80->regs.pc += 2;
+        return 7;
+    }
+}
+
+/*
+    JR cc, e (0x38):
+    Specialized from z80_inst_jr_cc_e().
+*/
+static uint8_t z80_inst_jr_cc_e__0x38(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_CARRY)) {
+        int8_t jump = read_operand(z80, z80->regs.pc + 1);
+        z80->regs.pc += jump + 2;
+        return 12;
+    } else {
+        z80->regs.pc += 2;
+        return 7;
+    }
+}
+
+/*
+    LD A, (BC/DE) (0x0A):
+    Specialized from z80_inst_ld_a_bcde().
+*/
+static uint8_t z80_inst_ld_a_bcde__0x0A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = z80->regs.bc;
+    z80->regs.a = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD A, (BC/DE) (0x1A):
+    Specialized from z80_inst_ld_a_bcde().
+*/
+static uint8_t z80_inst_ld_a_bcde__0x1A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = z80->regs.de;
+    z80->regs.a = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (BC/DE), A (0x02):
+    Specialized from z80_inst_ld_bcde_a().
+*/
+static uint8_t z80_inst_ld_bcde_a__0x02(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = z80->regs.bc;
+    mmu_write_byte(z80->mmu, addr, z80->regs.a);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (BC/DE), A (0x12):
+    Specialized from z80_inst_ld_bcde_a().
+*/
+static uint8_t z80_inst_ld_bcde_a__0x12(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = z80->regs.de;
+    mmu_write_byte(z80->mmu, addr, z80->regs.a);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD dd, (nn) (0xED4B):
+    Specialized from z80_inst_ld_dd_inn().
+*/
+static uint8_t z80_inst_ld_dd_inn__0x4B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.bc = mmu_read_double(z80->mmu, addr);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD dd, (nn) (0xED5B):
+    Specialized from z80_inst_ld_dd_inn().
+*/
+static uint8_t z80_inst_ld_dd_inn__0x5B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.de = mmu_read_double(z80->mmu, addr);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD dd, (nn) (0xED6B):
+    Specialized from z80_inst_ld_dd_inn().
+*/
+static uint8_t z80_inst_ld_dd_inn__0x6B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.hl = mmu_read_double(z80->mmu, addr);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD dd, (nn) (0xED7B):
+    Specialized from z80_inst_ld_dd_inn().
+*/
+static uint8_t z80_inst_ld_dd_inn__0x7B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.sp = mmu_read_double(z80->mmu, addr);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD dd, nn (0x01):
+    Specialized from z80_inst_ld_dd_nn().
+*/
+static uint8_t z80_inst_ld_dd_nn__0x01(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    z80->regs.bc = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.pc += 2;
+    return 10;
+}
+
+/*
+    LD dd, nn (0x11):
+    Specialized from z80_inst_ld_dd_nn().
+*/
+static uint8_t z80_inst_ld_dd_nn__0x11(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    z80->regs.de = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.pc += 2;
+    return 10;
+}
+
+/*
+    LD dd, nn (0x21):
+    Specialized from z80_inst_ld_dd_nn().
+*/
+static uint8_t z80_inst_ld_dd_nn__0x21(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    z80->regs.hl = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.pc += 2;
+    return 10;
+}
+
+/*
+    LD dd, nn (0x31):
+    Specialized from z80_inst_ld_dd_nn().
+*/
+static uint8_t z80_inst_ld_dd_nn__0x31(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    z80->regs.sp = read_operand_double(z80, ++z80->regs.pc);
+    z80->regs.pc += 2;
+    return 10;
+}
+
+/*
+    LD (HL), r (0x70):
+    Specialized from z80_inst_ld_hl_r().
+*/
+static uint8_t z80_inst_ld_hl_r__0x70(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (HL), r (0x71):
+    Specialized from z80_inst_ld_hl_r().
+*/
+static uint8_t z80_inst_ld_hl_r__0x71(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (HL), r (0x72):
+    Specialized from z80_inst_ld_hl_r().
+*/
+static uint8_t z80_inst_ld_hl_r__0x72(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (HL), r (0x73):
+    Specialized from z80_inst_ld_hl_r().
+*/
+static uint8_t z80_inst_ld_hl_r__0x73(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (HL), r (0x74):
+    Specialized from z80_inst_ld_hl_r().
+*/
+static uint8_t z80_inst_ld_hl_r__0x74(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (HL), r (0x75):
+    Specialized from z80_inst_ld_hl_r().
+*/
+static uint8_t z80_inst_ld_hl_r__0x75(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (HL), r (0x77):
+    Specialized from z80_inst_ld_hl_r().
+*/
+static uint8_t z80_inst_ld_hl_r__0x77(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD (nn), dd (0xED43):
+    Specialized from z80_inst_ld_inn_dd().
+*/
+static uint8_t z80_inst_ld_inn_dd__0x43(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    mmu_write_double(z80->mmu, addr, z80->regs.bc);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD (nn), dd (0xED53):
+    Specialized from z80_inst_ld_inn_dd().
+*/
+static uint8_t z80_inst_ld_inn_dd__0x53(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    mmu_write_double(z80->mmu, addr, z80->regs.de);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD (nn), dd (0xED63):
+    Specialized from z80_inst_ld_inn_dd().
+*/
+static uint8_t z80_inst_ld_inn_dd__0x63(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    mmu_write_double(z80->mmu, addr, z80->regs.hl);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD (nn), dd (0xED73):
+    Specialized from z80_inst_ld_inn_dd().
+*/
+static uint8_t z80_inst_ld_inn_dd__0x73(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
+    mmu_write_double(z80->mmu, addr, z80->regs.sp);
+    z80->regs.pc += 2;
+    return 20;
+}
+
+/*
+    LD (IXY+d), r (0xDD70, 0xFD70):
+    Specialized from z80_inst_ld_ixy_r().
+*/
+static uint8_t z80_inst_ld_ixy_r__0x70(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    mmu_write_byte(z80->mmu, addr, *reg);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD (IXY+d), r (0xDD71, 0xFD71):
+    Specialized from z80_inst_ld_ixy_r().
+*/
+static uint8_t z80_inst_ld_ixy_r__0x71(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    mmu_write_byte(z80->mmu, addr, *reg);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD (IXY+d), r (0xDD72, 0xFD72):
+    Specialized from z80_inst_ld_ixy_r().
+*/
+static uint8_t z80_inst_ld_ixy_r__0x72(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    mmu_write_byte(z80->mmu, addr, *reg);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD (IXY+d), r (0xDD73, 0xFD73):
+    Specialized from z80_inst_ld_ixy_r().
+*/
+static uint8_t z80_inst_ld_ixy_r__0x73(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    mmu_write_byte(z80->mmu, addr, *reg);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD (IXY+d), r (0xDD74, 0xFD74):
+    Specialized from z80_inst_ld_ixy_r().
+*/
+static uint8_t z80_inst_ld_ixy_r__0x74(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    mmu_write_byte(z80->mmu, addr, *reg);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD (IXY+d), r (0xDD75, 0xFD75):
+    Specialized from z80_inst_ld_ixy_r().
+*/
+static uint8_t z80_inst_ld_ixy_r__0x75(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    mmu_write_byte(z80->mmu, addr, *reg);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD (IXY+d), r (0xDD77, 0xFD77):
+    Specialized from z80_inst_ld_ixy_r().
+*/
+static uint8_t z80_inst_ld_ixy_r__0x77(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    mmu_write_byte(z80->mmu, addr, *reg);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, (HL) (0x46):
+    Specialized from z80_inst_ld_r_hl().
+*/
+static uint8_t z80_inst_ld_r_hl__0x46(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, (HL) (0x4E):
+    Specialized from z80_inst_ld_r_hl().
+*/
+static uint8_t z80_inst_ld_r_hl__0x4E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, (HL) (0x56):
+    Specialized from z80_inst_ld_r_hl().
+*/
+static uint8_t z80_inst_ld_r_hl__0x56(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, (HL) (0x5E):
+    Specialized from z80_inst_ld_r_hl().
+*/
+static uint8_t z80_inst_ld_r_hl__0x5E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, (HL) (0x66):
+    Specialized from z80_inst_ld_r_hl().
+*/
+static uint8_t z80_inst_ld_r_hl__0x66(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, (HL) (0x6E):
+    Specialized from z80_inst_ld_r_hl().
+*/
+static uint8_t z80_inst_ld_r_hl__0x6E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, (HL) (0x7E):
+    Specialized from z80_inst_ld_r_hl().
+*/
+static uint8_t z80_inst_ld_r_hl__0x7E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, (IXY+d) (0xDD46, 0xFD46):
+    Specialized from z80_inst_ld_r_ixy().
+*/
+static uint8_t z80_inst_ld_r_ixy__0x46(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    *reg = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, (IXY+d) (0xDD4E, 0xFD4E):
+    Specialized from z80_inst_ld_r_ixy().
+*/
+static uint8_t z80_inst_ld_r_ixy__0x4E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    *reg = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, (IXY+d) (0xDD56, 0xFD56):
+    Specialized from z80_inst_ld_r_ixy().
+*/
+static uint8_t z80_inst_ld_r_ixy__0x56(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    *reg = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, (IXY+d) (0xDD5E, 0xFD5E):
+    Specialized from z80_inst_ld_r_ixy().
+*/
+static uint8_t z80_inst_ld_r_ixy__0x5E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    *reg = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, (IXY+d) (0xDD66, 0xFD66):
+    Specialized from z80_inst_ld_r_ixy().
+*/
+static uint8_t z80_inst_ld_r_ixy__0x66(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    *reg = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, (IXY+d) (0xDD6E, 0xFD6E):
+    Specialized from z80_inst_ld_r_ixy().
+*/
+static uint8_t z80_inst_ld_r_ixy__0x6E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    *reg = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, (IXY+d) (0xDD7E, 0xFD7E):
+    Specialized from z80_inst_ld_r_ixy().
+*/
+static uint8_t z80_inst_ld_r_ixy__0x7E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
+    *reg = mmu_read_byte(z80->mmu, addr);
+    z80->regs.pc++;
+    return 19;
+}
+
+/*
+    LD r, n (0x06):
+    Specialized from z80_inst_ld_r_n().
+*/
+static uint8_t z80_inst_ld_r_n__0x06(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    *reg = read_operand(z80, ++z80->regs.pc);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, n (0x0E):
+    Specialized from z80_inst_ld_r_n().
+*/
+static uint8_t z80_inst_ld_r_n__0x0E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    *reg = read_operand(z80, ++z80->regs.pc);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, n (0x16):
+    Specialized from z80_inst_ld_r_n().
+*/
+static uint8_t z80_inst_ld_r_n__0x16(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    *reg = read_operand(z80, ++z80->regs.pc);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, n (0x1E):
+    Specialized from z80_inst_ld_r_n().
+*/
+static uint8_t z80_inst_ld_r_n__0x1E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    *reg = read_operand(z80, ++z80->regs.pc);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, n (0x26):
+    Specialized from z80_inst_ld_r_n().
+*/
+static uint8_t z80_inst_ld_r_n__0x26(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    *reg = read_operand(z80, ++z80->regs.pc);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, n (0x2E):
+    Specialized from z80_inst_ld_r_n().
+*/
+static uint8_t z80_inst_ld_r_n__0x2E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    *reg = read_operand(z80, ++z80->regs.pc);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, n (0x3E):
+    Specialized from z80_inst_ld_r_n().
+*/
+static uint8_t z80_inst_ld_r_n__0x3E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    *reg = read_operand(z80, ++z80->regs.pc);
+    z80->regs.pc++;
+    return 7;
+}
+
+/*
+    LD r, r' (0x40):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x40(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.b,
+            *src = &z80->regs.b;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x41):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x41(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.b,
+            *src = &z80->regs.c;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x42):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x42(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.b,
+            *src = &z80->regs.d;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x43):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x43(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.b,
+            *src = &z80->regs.e;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x44):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x44(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.b,
+            *src = &z80->regs.h;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x45):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x45(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.b,
+            *src = &z80->regs.l;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x47):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x47(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.b,
+            *src = &z80->regs.a;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x48):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x48(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.c,
+            *src = &z80->regs.b;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x49):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x49(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.c,
+            *src = &z80->regs.c;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x4A):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x4A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.c,
+            *src = &z80->regs.d;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x4B):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x4B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.c,
+            *src = &z80->regs.e;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x4C):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x4C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.c,
+            *src = &z80->regs.h;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x4D):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x4D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.c,
+            *src = &z80->regs.l;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x4F):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x4F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.c,
+            *src = &z80->regs.a;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x50):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x50(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.d,
+            *src = &z80->regs.b;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x51):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x51(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.d,
+            *src = &z80->regs.c;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x52):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x52(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.d,
+            *src = &z80->regs.d;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x53):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x53(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.d,
+            *src = &z80->regs.e;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x54):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x54(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.d,
+            *src = &z80->regs.h;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x55):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x55(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.d,
+            *src = &z80->regs.l;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x57):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x57(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.d,
+            *src = &z80->regs.a;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x58):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x58(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.e,
+            *src = &z80->regs.b;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x59):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x59(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.e,
+            *src = &z80->regs.c;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x5A):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x5A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.e,
+            *src = &z80->regs.d;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x5B):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x5B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.e,
+            *src = &z80->regs.e;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x5C):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x5C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.e,
+            *src = &z80->regs.h;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x5D):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x5D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.e,
+            *src = &z80->regs.l;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x5F):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x5F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.e,
+            *src = &z80->regs.a;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x60):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x60(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.h,
+            *src = &z80->regs.b;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x61):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x61(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.h,
+            *src = &z80->regs.c;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x62):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x62(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.h,
+            *src = &z80->regs.d;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x63):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x63(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.h,
+            *src = &z80->regs.e;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x64):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x64(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.h,
+            *src = &z80->regs.h;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x65):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x65(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.h,
+            *src = &z80->regs.l;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x67):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x67(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.h,
+            *src = &z80->regs.a;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x68):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x68(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.l,
+            *src = &z80->regs.b;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x69):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x69(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.l,
+            *src = &z80->regs.c;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x6A):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x6A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.l,
+            *src = &z80->regs.d;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x6B):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x6B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.l,
+            *src = &z80->regs.e;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x6C):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x6C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.l,
+            *src = &z80->regs.h;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x6D):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x6D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.l,
+            *src = &z80->regs.l;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x6F):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x6F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.l,
+            *src = &z80->regs.a;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x78):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x78(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.a,
+            *src = &z80->regs.b;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x79):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x79(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.a,
+            *src = &z80->regs.c;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x7A):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x7A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.a,
+            *src = &z80->regs.d;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x7B):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x7B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.a,
+            *src = &z80->regs.e;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x7C):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x7C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.a,
+            *src = &z80->regs.h;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x7D):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x7D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.a,
+            *src = &z80->regs.l;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    LD r, r' (0x7F):
+    Specialized from z80_inst_ld_r_r().
+*/
+static uint8_t z80_inst_ld_r_r__0x7F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *dst = &z80->regs.a,
+            *src = &z80->regs.a;
+    *dst = *src;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OR r (0xB0):
+    Specialized from z80_inst_or_r().
+*/
+static uint8_t z80_inst_or_r__0xB0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.b;
+    uint8_t res = z80->regs.a |= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OR r (0xB1):
+    Specialized from z80_inst_or_r().
+*/
+static uint8_t z80_inst_or_r__0xB1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.c;
+    uint8_t res = z80->regs.a |= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OR r (0xB2):
+    Specialized from z80_inst_or_r().
+*/
+static uint8_t z80_inst_or_r__0xB2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.d;
+    uint8_t res = z80->regs.a |= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OR r (0xB3):
+    Specialized from z80_inst_or_r().
+*/
+static uint8_t z80_inst_or_r__0xB3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.e;
+    uint8_t res = z80->regs.a |= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OR r (0xB4):
+    Specialized from z80_inst_or_r().
+*/
+static uint8_t z80_inst_or_r__0xB4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.h;
+    uint8_t res = z80->regs.a |= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OR r (0xB5):
+    Specialized from z80_inst_or_r().
+*/
+static uint8_t z80_inst_or_r__0xB5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.l;
+    uint8_t res = z80->regs.a |= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OR r (0xB7):
+    Specialized from z80_inst_or_r().
+*/
+static uint8_t z80_inst_or_r__0xB7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.a;
+    uint8_t res = z80->regs.a |= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    OUT (C), r (0xED41):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x41(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x41 != 0x71 ? z80->regs.b : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    OUT (C), r (0xED49):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x49(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x49 != 0x71 ? z80->regs.c : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    OUT (C), r (0xED51):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x51(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x51 != 0x71 ? z80->regs.d : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    OUT (C), r (0xED59):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x59(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x59 != 0x71 ? z80->regs.e : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    OUT (C), r (0xED61):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x61(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x61 != 0x71 ? z80->regs.h : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    OUT (C), r (0xED69):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x69(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x69 != 0x71 ? z80->regs.l : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    OUT (C), r (0xED71):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x71(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x71 != 0x71 ? *extract_reg(z80, 0x71) : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    OUT (C), r (0xED79):
+    Specialized from z80_inst_out_c_r().
+*/
+static uint8_t z80_inst_out_c_r__0x79(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = 0x79 != 0x71 ? z80->regs.a : 0;
+    io_port_write(z80->io, z80->regs.c, value);
+    z80->regs.pc++;
+    return 12;
+}
+
+/*
+    POP qq (0xC1):
+    Specialized from z80_inst_pop_qq().
+*/
+static uint8_t z80_inst_pop_qq__0xC1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    z80->regs.bc = stack_pop(z80);
+    z80->regs.pc++;
+    return 10;
+}
+
+/*
+    POP qq (0xD1):
+    Specialized from z80_inst_pop_qq().
+*/
+static uint8_t z80_inst_pop_qq__0xD1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    z80->regs.de = stack_pop(z80);
+    z80->regs.pc++;
+    return 10;
+}
+
+/*
+    POP qq (0xE1):
+    Specialized from z80_inst_pop_qq().
+*/
+static uint8_t z80_inst_pop_qq__0xE1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    z80->regs.hl = stack_pop(z80);
+    z80->regs.pc++;
+    return 10;
+}
+
+/*
+    POP qq (0xF1):
+    Specialized from z80_inst_pop_qq().
+*/
+static uint8_t z80_inst_pop_qq__0xF1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    *extract_pair_qq(z80, 0xF1) = stack_pop(z80);
+    z80->regs.pc++;
+    return 10;
+}
+
+/*
+    PUSH qq (0xC5):
+    Specialized from z80_inst_push_qq().
+*/
+static uint8_t z80_inst_push_qq__0xC5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.bc);
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    PUSH qq (0xD5):
+    Specialized from z80_inst_push_qq().
+*/
+static uint8_t z80_inst_push_qq__0xD5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.de);
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    PUSH qq (0xE5):
+    Specialized from z80_inst_push_qq().
+*/
+static uint8_t z80_inst_push_qq__0xE5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.hl);
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    PUSH qq (0xF5):
+    Specialized from z80_inst_push_qq().
+*/
+static uint8_t z80_inst_push_qq__0xF5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, *extract_pair_qq(z80, 0xF5));
+    z80->regs.pc++;
+    return 11;
+}
+
+/*
+    RES b, (HL) (0xCB86):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0x86(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x86 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (HL) (0xCB8E):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0x8E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x8E >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (HL) (0xCB96):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0x96(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x96 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (HL) (0xCB9E):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0x9E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0x9E >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (HL) (0xCBA6):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0xA6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xA6 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (HL) (0xCBAE):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0xAE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xAE >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (HL) (0xCBB6):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0xB6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xB6 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (HL) (0xCBBE):
+    Specialized from z80_inst_res_b_hl().
+*/
+static uint8_t z80_inst_res_b_hl__0xBE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xBE >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCB86, 0xFDCB86):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0x86(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x86 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCB8E, 0xFDCB8E):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0x8E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x8E >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCB96, 0xFDCB96):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0x96(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x96 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCB9E, 0xFDCB9E):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0x9E(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0x9E >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCBA6, 0xFDCBA6):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0xA6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xA6 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCBAE, 0xFDCBAE):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0xAE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xAE >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCBB6, 0xFDCBB6):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0xB6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xB6 >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, (IXY+d) (0xDDCBBE, 0xFDCBBE):
+    Specialized from z80_inst_res_b_ixy().
+*/
+static uint8_t z80_inst_res_b_ixy__0xBE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xBE >> 3) & 0x07;
+    val &= ~(1 << bit);
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    RES b, r (0xCB80):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x80(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0x80 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB81):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x81(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0x81 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB82):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x82(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0x82 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB83):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x83(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0x83 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB84):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x84(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0x84 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB85):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x85(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0x85 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB87):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x87(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0x87 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB88):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x88(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0x88 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB89):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x89(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0x89 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB8A):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x8A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0x8A >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB8B):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x8B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0x8B >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB8C):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x8C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0x8C >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB8D):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x8D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0x8D >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB8F):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x8F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0x8F >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB90):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x90(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0x90 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB91):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x91(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0x91 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB92):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x92(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0x92 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB93):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x93(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0x93 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB94):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x94(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0x94 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB95):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x95(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0x95 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB97):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x97(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0x97 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB98):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x98(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0x98 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB99):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x99(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0x99 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB9A):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x9A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0x9A >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB9B):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x9B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0x9B >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB9C):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x9C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0x9C >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB9D):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x9D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0x9D >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCB9F):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0x9F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0x9F >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA0):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xA0 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA1):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xA1 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA2):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xA2 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA3):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xA3 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA4):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xA4 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA5):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xA5 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA7):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xA7 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA8):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xA8 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBA9):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xA9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xA9 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBAA):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xAA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xAA >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBAB):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xAB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xAB >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBAC):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xAC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xAC >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBAD):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xAD(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xAD >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBAF):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xAF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xAF >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB0):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xB0 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB1):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xB1 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB2):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xB2 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB3):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xB3 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB4):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xB4 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB5):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xB5 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB7):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xB7 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB8):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xB8 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBB9):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xB9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xB9 >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBBA):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xBA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xBA >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBBB):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xBB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xBB >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBBC):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xBC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xBC >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBBD):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xBD(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xBD >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RES b, r (0xCBBF):
+    Specialized from z80_inst_res_b_r().
+*/
+static uint8_t z80_inst_res_b_r__0xBF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xBF >> 3) & 0x07;
+    *reg &= ~(1 << bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RET cc (0xC0):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xC0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_ZERO)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RET cc (0xC8):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xC8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_ZERO)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RET cc (0xD0):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xD0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_CARRY)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RET cc (0xD8):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xD8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_CARRY)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RET cc (0xE0):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xE0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_PARITY)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RET cc (0xE8):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xE8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_PARITY)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RET cc (0xF0):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xF0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (!get_flag(z80, FLAG_SIGN)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RET cc (0xF8):
+    Specialized from z80_inst_ret_cc().
+*/
+static uint8_t z80_inst_ret_cc__0xF8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    if (get_flag(z80, FLAG_SIGN)) {
+        z80->regs.pc = stack_pop(z80);
+        return 11;
+    } else {
+        z80->regs.pc++;
+        return 5;
+    }
+}
+
+/*
+    RLC (IXY+d) (0xCB10):
+    Specialized from z80_inst_rl_r().
+*/
+static uint8_t z80_inst_rl_r__0x10(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= carry;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC (IXY+d) (0xCB11):
+    Specialized from z80_inst_rl_r().
+*/
+static uint8_t z80_inst_rl_r__0x11(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= carry;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC (IXY+d) (0xCB12):
+    Specialized from z80_inst_rl_r().
+*/
+static uint8_t z80_inst_rl_r__0x12(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= carry;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC (IXY+d) (0xCB13):
+    Specialized from z80_inst_rl_r().
+*/
+static uint8_t z80_inst_rl_r__0x13(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= carry;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC (IXY+d) (0xCB14):
+    Specialized from z80_inst_rl_r().
+*/
+static uint8_t z80_inst_rl_r__0x14(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= carry;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC (IXY+d) (0xCB15):
+    Specialized from z80_inst_rl_r().
+*/
+static uint8_t z80_inst_rl_r__0x15(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= carry;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC (IXY+d) (0xCB17):
+    Specialized from z80_inst_rl_r().
+*/
+static uint8_t z80_inst_rl_r__0x17(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= carry;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC r (0xCB00):
+    Specialized from z80_inst_rlc_r().
+*/
+static uint8_t z80_inst_rlc_r__0x00(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= bit;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC r (0xCB01):
+    Specialized from z80_inst_rlc_r().
+*/
+static uint8_t z80_inst_rlc_r__0x01(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= bit;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC r (0xCB02):
+    Specialized from z80_inst_rlc_r().
+*/
+static uint8_t z80_inst_rlc_r__0x02(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= bit;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC r (0xCB03):
+    Specialized from z80_inst_rlc_r().
+*/
+static uint8_t z80_inst_rlc_r__0x03(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= bit;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC r (0xCB04):
+    Specialized from z80_inst_rlc_r().
+*/
+static uint8_t z80_inst_rlc_r__0x04(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= bit;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC r (0xCB05):
+    Specialized from z80_inst_rlc_r().
+*/
+static uint8_t z80_inst_rlc_r__0x05(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= bit;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RLC r (0xCB07):
+    Specialized from z80_inst_rlc_r().
+*/
+static uint8_t z80_inst_rlc_r__0x07(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= bit;
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RRC (IXY+d) (0xCB18):
+    Specialized from z80_inst_rr_r().
+*/
+static uint8_t z80_inst_rr_r__0x18(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (carry << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RRC (IXY+d) (0xCB19):
+    Specialized from z80_inst_rr_r().
+*/
+static uint8_t z80_inst_rr_r__0x19(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (carry << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RRC (IXY+d) (0xCB1A):
+    Specialized from z80_inst_rr_r().
+*/
+static uint8_t z80_inst_rr_r__0x1A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (carry << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RRC (IXY+d) (0xCB1B):
+    Specialized from z80_inst_rr_r().
+*/
+static uint8_t z80_inst_rr_r__0x1B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (carry << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RRC (IXY+d) (0xCB1C):
+    Specialized from z80_inst_rr_r().
+*/
+static uint8_t z80_inst_rr_r__0x1C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (carry << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RRC (IXY+d) (0xCB1D):
+    Specialized from z80_inst_rr_r().
+*/
+static uint8_t z80_inst_rr_r__0x1D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (carry << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RRC (IXY+d) (0xCB1F):
+    Specialized from z80_inst_rr_r().
+*/
+static uint8_t z80_inst_rr_r__0x1F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t carry = get_flag(z80, FLAG_CARRY);
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (carry << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RL (IXY+d) (0xCB08):
+    Specialized from z80_inst_rrc_r().
+*/
+static uint8_t z80_inst_rrc_r__0x08(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (bit << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RL (IXY+d) (0xCB09):
+    Specialized from z80_inst_rrc_r().
+*/
+static uint8_t z80_inst_rrc_r__0x09(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (bit << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RL (IXY+d) (0xCB0A):
+    Specialized from z80_inst_rrc_r().
+*/
+static uint8_t z80_inst_rrc_r__0x0A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (bit << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RL (IXY+d) (0xCB0B):
+    Specialized from z80_inst_rrc_r().
+*/
+static uint8_t z80_inst_rrc_r__0x0B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (bit << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RL (IXY+d) (0xCB0C):
+    Specialized from z80_inst_rrc_r().
+*/
+static uint8_t z80_inst_rrc_r__0x0C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (bit << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RL (IXY+d) (0xCB0D):
+    Specialized from z80_inst_rrc_r().
+*/
+static uint8_t z80_inst_rrc_r__0x0D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (bit << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RL (IXY+d) (0xCB0F):
+    Specialized from z80_inst_rrc_r().
+*/
+static uint8_t z80_inst_rrc_r__0x0F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= (bit << 7);
+
+    set_flags_bitshift(z80, *reg, bit);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RST p (0xC7):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xC7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xC7 & 0x38;
+    return 11;
+}
+
+/*
+    RST p (0xCF):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xCF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xCF & 0x38;
+    return 11;
+}
+
+/*
+    RST p (0xD7):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xD7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xD7 & 0x38;
+    return 11;
+}
+
+/*
+    RST p (0xDF):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xDF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xDF & 0x38;
+    return 11;
+}
+
+/*
+    RST p (0xE7):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xE7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xE7 & 0x38;
+    return 11;
+}
+
+/*
+    RST p (0xEF):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xEF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xEF & 0x38;
+    return 11;
+}
+
+/*
+    RST p (0xF7):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xF7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xF7 & 0x38;
+    return 11;
+}
+
+/*
+    RST p (0xFF):
+    Specialized from z80_inst_rst_p().
+*/
+static uint8_t z80_inst_rst_p__0xFF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    stack_push(z80, z80->regs.pc + 1);
+    z80->regs.pc = 0xFF & 0x38;
+    return 11;
+}
+
+/*
+    SBC A, r (0x98):
+    Specialized from z80_inst_sbc_a_r().
+*/
+static uint8_t z80_inst_sbc_a_r__0x98(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.b;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SBC A, r (0x99):
+    Specialized from z80_inst_sbc_a_r().
+*/
+static uint8_t z80_inst_sbc_a_r__0x99(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.c;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SBC A, r (0x9A):
+    Specialized from z80_inst_sbc_a_r().
+*/
+static uint8_t z80_inst_sbc_a_r__0x9A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.d;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SBC A, r (0x9B):
+    Specialized from z80_inst_sbc_a_r().
+*/
+static uint8_t z80_inst_sbc_a_r__0x9B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.e;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SBC A, r (0x9C):
+    Specialized from z80_inst_sbc_a_r().
+*/
+static uint8_t z80_inst_sbc_a_r__0x9C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.h;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SBC A, r (0x9D):
+    Specialized from z80_inst_sbc_a_r().
+*/
+static uint8_t z80_inst_sbc_a_r__0x9D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.l;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SBC A, r (0x9F):
+    Specialized from z80_inst_sbc_a_r().
+*/
+static uint8_t z80_inst_sbc_a_r__0x9F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.a;
+    value += get_flag(z80, FLAG_CARRY);
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SBC HL, ss (0xED42):
+    Specialized from z80_inst_sbc_hl_ss().
+*/
+static uint8_t z80_inst_sbc_hl_ss__0x42(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.bc + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl -= rh;
+
+    set_flags_sbc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SBC HL, ss (0xED52):
+    Specialized from z80_inst_sbc_hl_ss().
+*/
+static uint8_t z80_inst_sbc_hl_ss__0x52(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.de + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl -= rh;
+
+    set_flags_sbc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SBC HL, ss (0xED62):
+    Specialized from z80_inst_sbc_hl_ss().
+*/
+static uint8_t z80_inst_sbc_hl_ss__0x62(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.hl + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl -= rh;
+
+    set_flags_sbc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SBC HL, ss (0xED72):
+    Specialized from z80_inst_sbc_hl_ss().
+*/
+static uint8_t z80_inst_sbc_hl_ss__0x72(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t lh = z80->regs.hl;
+    uint32_t rh = z80->regs.sp + get_flag(z80, FLAG_CARRY);
+    z80->regs.hl -= rh;
+
+    set_flags_sbc16(z80, lh, rh);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBC6):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xC6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xC6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBCE):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xCE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xCE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBD6):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xD6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xD6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBDE):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xDE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xDE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBE6):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xE6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xE6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBEE):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xEE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xEE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBF6):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xF6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xF6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (HL) (0xCBFE):
+    Specialized from z80_inst_set_b_hl().
+*/
+static uint8_t z80_inst_set_b_hl__0xFE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
+    uint8_t bit = (0xFE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, z80->regs.hl, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBC6, 0xFDCBC6):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xC6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xC6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBCE, 0xFDCBCE):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xCE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xCE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBD6, 0xFDCBD6):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xD6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xD6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBDE, 0xFDCBDE):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xDE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xDE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBE6, 0xFDCBE6):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xE6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xE6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBEE, 0xFDCBEE):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xEE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xEE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBF6, 0xFDCBF6):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xF6(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xF6 >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, (IXY+d) (0xDDCBFE, 0xFDCBFE):
+    Specialized from z80_inst_set_b_ixy().
+*/
+static uint8_t z80_inst_set_b_ixy__0xFE(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
+    uint8_t val = mmu_read_byte(z80->mmu, addr);
+    uint8_t bit = (0xFE >> 3) & 0x07;
+    val |= 1 << bit;
+    mmu_write_byte(z80->mmu, addr, val);
+    z80->regs.pc++;
+    return 15;
+}
+
+/*
+    SET b, r (0xCBC0):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xC0 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC1):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xC1 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC2):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xC2 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC3):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xC3 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC4):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xC4 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC5):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xC5 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC7):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xC7 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC8):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xC8 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBC9):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xC9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xC9 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBCA):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xCA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xCA >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBCB):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xCB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xCB >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBCC):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xCC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xCC >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBCD):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xCD(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xCD >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBCF):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xCF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xCF >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD0):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xD0 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD1):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xD1 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD2):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xD2 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD3):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xD3 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD4):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xD4 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD5):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xD5 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD7):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xD7 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD8):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xD8 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBD9):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xD9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xD9 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBDA):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xDA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xDA >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBDB):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xDB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xDB >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBDC):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xDC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xDC >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBDD):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xDD(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xDD >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBDF):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xDF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xDF >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE0):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xE0 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE1):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xE1 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE2):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xE2 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE3):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xE3 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE4):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xE4 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE5):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xE5 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE7):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xE7 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE8):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xE8 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBE9):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xE9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xE9 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBEA):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xEA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xEA >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBEB):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xEB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xEB >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBEC):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xEC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xEC >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBED):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xED(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xED >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBEF):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xEF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xEF >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF0):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF0(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xF0 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF1):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF1(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xF1 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF2):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF2(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xF2 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF3):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF3(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xF3 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF4):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF4(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xF4 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF5):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF5(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xF5 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF7):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF7(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xF7 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF8):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t bit = (0xF8 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBF9):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xF9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t bit = (0xF9 >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBFA):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xFA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t bit = (0xFA >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBFB):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xFB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t bit = (0xFB >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBFC):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xFC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t bit = (0xFC >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBFD):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xFD(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t bit = (0xFD >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SET b, r (0xCBFF):
+    Specialized from z80_inst_set_b_r().
+*/
+static uint8_t z80_inst_set_b_r__0xFF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t bit = (0xFF >> 3) & 0x07;
+    *reg |= 1 << bit;
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SRA (IXY+d) (0xCB30):
+    Specialized from z80_inst_sl1_r().
+*/
+static uint8_t z80_inst_sl1_r__0x30(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SRA (IXY+d) (0xCB31):
+    Specialized from z80_inst_sl1_r().
+*/
+static uint8_t z80_inst_sl1_r__0x31(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SRA (IXY+d) (0xCB32):
+    Specialized from z80_inst_sl1_r().
+*/
+static uint8_t z80_inst_sl1_r__0x32(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SRA (IXY+d) (0xCB33):
+    Specialized from z80_inst_sl1_r().
+*/
+static uint8_t z80_inst_sl1_r__0x33(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SRA (IXY+d) (0xCB34):
+    Specialized from z80_inst_sl1_r().
+*/
+static uint8_t z80_inst_sl1_r__0x34(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SRA (IXY+d) (0xCB35):
+    Specialized from z80_inst_sl1_r().
+*/
+static uint8_t z80_inst_sl1_r__0x35(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SRA (IXY+d) (0xCB37):
+    Specialized from z80_inst_sl1_r().
+*/
+static uint8_t z80_inst_sl1_r__0x37(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+    (*reg) |= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RR (IXY+d) (0xCB20):
+    Specialized from z80_inst_sla_r().
+*/
+static uint8_t z80_inst_sla_r__0x20(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RR (IXY+d) (0xCB21):
+    Specialized from z80_inst_sla_r().
+*/
+static uint8_t z80_inst_sla_r__0x21(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RR (IXY+d) (0xCB22):
+    Specialized from z80_inst_sla_r().
+*/
+static uint8_t z80_inst_sla_r__0x22(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RR (IXY+d) (0xCB23):
+    Specialized from z80_inst_sla_r().
+*/
+static uint8_t z80_inst_sla_r__0x23(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RR (IXY+d) (0xCB24):
+    Specialized from z80_inst_sla_r().
+*/
+static uint8_t z80_inst_sla_r__0x24(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RR (IXY+d) (0xCB25):
+    Specialized from z80_inst_sla_r().
+*/
+static uint8_t z80_inst_sla_r__0x25(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    RR (IXY+d) (0xCB27):
+    Specialized from z80_inst_sla_r().
+*/
+static uint8_t z80_inst_sla_r__0x27(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t msb = ((*reg) & 0x80) >> 7;
+    (*reg) <<= 1;
+
+    set_flags_bitshift(z80, *reg, msb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SLA (IXY+d) (0xCB28):
+    Specialized from z80_inst_sra_r().
+*/
+static uint8_t z80_inst_sra_r__0x28(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= msb;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SLA (IXY+d) (0xCB29):
+    Specialized from z80_inst_sra_r().
+*/
+static uint8_t z80_inst_sra_r__0x29(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= msb;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SLA (IXY+d) (0xCB2A):
+    Specialized from z80_inst_sra_r().
+*/
+static uint8_t z80_inst_sra_r__0x2A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= msb;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SLA (IXY+d) (0xCB2B):
+    Specialized from z80_inst_sra_r().
+*/
+static uint8_t z80_inst_sra_r__0x2B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= msb;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SLA (IXY+d) (0xCB2C):
+    Specialized from z80_inst_sra_r().
+*/
+static uint8_t z80_inst_sra_r__0x2C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= msb;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SLA (IXY+d) (0xCB2D):
+    Specialized from z80_inst_sra_r().
+*/
+static uint8_t z80_inst_sra_r__0x2D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= msb;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SLA (IXY+d) (0xCB2F):
+    Specialized from z80_inst_sra_r().
+*/
+static uint8_t z80_inst_sra_r__0x2F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+    (*reg) |= msb;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SL1 (IXY+d) (0xCB38):
+    Specialized from z80_inst_srl_r().
+*/
+static uint8_t z80_inst_srl_r__0x38(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.b;
+    uint8_t lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SL1 (IXY+d) (0xCB39):
+    Specialized from z80_inst_srl_r().
+*/
+static uint8_t z80_inst_srl_r__0x39(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.c;
+    uint8_t lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SL1 (IXY+d) (0xCB3A):
+    Specialized from z80_inst_srl_r().
+*/
+static uint8_t z80_inst_srl_r__0x3A(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.d;
+    uint8_t lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SL1 (IXY+d) (0xCB3B):
+    Specialized from z80_inst_srl_r().
+*/
+static uint8_t z80_inst_srl_r__0x3B(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.e;
+    uint8_t lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SL1 (IXY+d) (0xCB3C):
+    Specialized from z80_inst_srl_r().
+*/
+static uint8_t z80_inst_srl_r__0x3C(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.h;
+    uint8_t lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SL1 (IXY+d) (0xCB3D):
+    Specialized from z80_inst_srl_r().
+*/
+static uint8_t z80_inst_srl_r__0x3D(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.l;
+    uint8_t lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SL1 (IXY+d) (0xCB3F):
+    Specialized from z80_inst_srl_r().
+*/
+static uint8_t z80_inst_srl_r__0x3F(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t *reg = &z80->regs.a;
+    uint8_t lsb = (*reg) & 0x01;
+    (*reg) >>= 1;
+
+    set_flags_bitshift(z80, *reg, lsb);
+    z80->regs.pc++;
+    return 8;
+}
+
+/*
+    SUB r (0x90):
+    Specialized from z80_inst_sub_r().
+*/
+static uint8_t z80_inst_sub_r__0x90(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.b;
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SUB r (0x91):
+    Specialized from z80_inst_sub_r().
+*/
+static uint8_t z80_inst_sub_r__0x91(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.c;
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SUB r (0x92):
+    Specialized from z80_inst_sub_r().
+*/
+static uint8_t z80_inst_sub_r__0x92(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.d;
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SUB r (0x93):
+    Specialized from z80_inst_sub_r().
+*/
+static uint8_t z80_inst_sub_r__0x93(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.e;
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SUB r (0x94):
+    Specialized from z80_inst_sub_r().
+*/
+static uint8_t z80_inst_sub_r__0x94(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.h;
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SUB r (0x95):
+    Specialized from z80_inst_sub_r().
+*/
+static uint8_t z80_inst_sub_r__0x95(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.l;
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    SUB r (0x97):
+    Specialized from z80_inst_sub_r().
+*/
+static uint8_t z80_inst_sub_r__0x97(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.a;
+
+    set_flags_sub8(z80, value);
+    z80->regs.a -= value;
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    XOR r (0xA8):
+    Specialized from z80_inst_xor_r().
+*/
+static uint8_t z80_inst_xor_r__0xA8(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.b;
+    uint8_t res = z80->regs.a ^= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    XOR r (0xA9):
+    Specialized from z80_inst_xor_r().
+*/
+static uint8_t z80_inst_xor_r__0xA9(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.c;
+    uint8_t res = z80->regs.a ^= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    XOR r (0xAA):
+    Specialized from z80_inst_xor_r().
+*/
+static uint8_t z80_inst_xor_r__0xAA(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.d;
+    uint8_t res = z80->regs.a ^= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    XOR r (0xAB):
+    Specialized from z80_inst_xor_r().
+*/
+static uint8_t z80_inst_xor_r__0xAB(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.e;
+    uint8_t res = z80->regs.a ^= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    XOR r (0xAC):
+    Specialized from z80_inst_xor_r().
+*/
+static uint8_t z80_inst_xor_r__0xAC(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.h;
+    uint8_t res = z80->regs.a ^= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    XOR r (0xAD):
+    Specialized from z80_inst_xor_r().
+*/
+static uint8_t z80_inst_xor_r__0xAD(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.l;
+    uint8_t res = z80->regs.a ^= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}
+
+/*
+    XOR r (0xAF):
+    Specialized from z80_inst_xor_r().
+*/
+static uint8_t z80_inst_xor_r__0xAF(Z80 *z80, uint8_t opcode)
+{
+    (void) opcode;
+    uint8_t value = z80->regs.a;
+    uint8_t res = z80->regs.a ^= value;
+
+    set_flags_bitwise(z80, res, false);
+    z80->regs.pc++;
+    return 4;
+}/* @AUTOGEN_HANDLER_BLOCK_END */
+
+/* @AUTOGEN_ALIAS_BLOCK_START */
+#define z80_inst_adc_a_hl__0x8E z80_inst_adc_a_hl
+#define z80_inst_adc_a_ixy__0x8E z80_inst_adc_a_ixy
+#define z80_inst_adc_a_n__0xCE z80_inst_adc_a_n
+#define z80_inst_add_a_hl__0x86 z80_inst_add_a_hl
+#define z80_inst_add_a_ixy__0x86 z80_inst_add_a_ixy
+#define z80_inst_add_a_n__0xC6 z80_inst_add_a_n
+#define z80_inst_and_hl__0xA6 z80_inst_and_hl
+#define z80_inst_and_ixy__0xA6 z80_inst_and_ixy
+#define z80_inst_and_n__0xE6 z80_inst_and_n
+#define z80_inst_call_nn__0xCD z80_inst_call_nn
+#define z80_inst_ccf__0x3F z80_inst_ccf
+#define z80_inst_cp_hl__0xBE z80_inst_cp_hl
+#define z80_inst_cp_ixy__0xBE z80_inst_cp_ixy
+#define z80_inst_cp_n__0xFE z80_inst_cp_n
+#define z80_inst_cpd__0xA9 z80_inst_cpd
+#define z80_inst_cpdr__0xB9 z80_inst_cpdr
+#define z80_inst_cpi__0xA1 z80_inst_cpi
+#define z80_inst_cpir__0xB1 z80_inst_cpir
+#define z80_inst_cpl__0x2F z80_inst_cpl
+#define z80_inst_daa__0x27 z80_inst_daa
+#define z80_inst_dec_hl__0x35 z80_inst_dec_hl
+#define z80_inst_dec_ixy__0x35 z80_inst_dec_ixy
+#define z80_inst_dec_xy__0x2B z80_inst_dec_xy
+#define z80_inst_di__0xF3 z80_inst_di
+#define z80_inst_djnz_e__0x10 z80_inst_djnz_e
+#define z80_inst_ei__0xFB z80_inst_ei
+#define z80_inst_ex_af_af__0x08 z80_inst_ex_af_af
+#define z80_inst_ex_de_hl__0xEB z80_inst_ex_de_hl
+#define z80_inst_ex_sp_hl__0xE3 z80_inst_ex_sp_hl
+#define z80_inst_ex_sp_ixy__0xE3 z80_inst_ex_sp_ixy
+#define z80_inst_exx__0xD9 z80_inst_exx
+#define z80_inst_halt__0x76 z80_inst_halt
+#define z80_inst_in_a_n__0xDB z80_inst_in_a_n
+#define z80_inst_inc_hl__0x34 z80_inst_inc_hl
+#define z80_inst_inc_ixy__0x34 z80_inst_inc_ixy
+#define z80_inst_inc_xy__0x23 z80_inst_inc_xy
+#define z80_inst_ind__0xAA z80_inst_ind
+#define z80_inst_indr__0xBA z80_inst_indr
+#define z80_inst_ini__0xA2 z80_inst_ini
+#define z80_inst_inir__0xB2 z80_inst_inir
+#define z80_inst_jp_hl__0xE9 z80_inst_jp_hl
+#define z80_inst_jp_ixy__0xE9 z80_inst_jp_ixy
+#define z80_inst_jp_nn__0xC3 z80_inst_jp_nn
+#define z80_inst_jr_e__0x18 z80_inst_jr_e
+#define z80_inst_ld_a_i__0x57 z80_inst_ld_a_i
+#define z80_inst_ld_a_nn__0x3A z80_inst_ld_a_nn
+#define z80_inst_ld_a_r__0x5F z80_inst_ld_a_r
+#define z80_inst_ld_hl_inn__0x2A z80_inst_ld_hl_inn
+#define z80_inst_ld_hl_n__0x36 z80_inst_ld_hl_n
+#define z80_inst_ld_i_a__0x47 z80_inst_ld_i_a
+#define z80_inst_ld_inn_hl__0x22 z80_inst_ld_inn_hl
+#define z80_inst_ld_inn_ixy__0x22 z80_inst_ld_inn_ixy
+#define z80_inst_ld_ixy_inn__0x2A z80_inst_ld_ixy_inn
+#define z80_inst_ld_ixy_n__0x36 z80_inst_ld_ixy_n
+#define z80_inst_ld_ixy_nn__0x21 z80_inst_ld_ixy_nn
+#define z80_inst_ld_nn_a__0x32 z80_inst_ld_nn_a
+#define z80_inst_ld_r_a__0x4F z80_inst_ld_r_a
+#define z80_inst_ld_sp_hl__0xF9 z80_inst_ld_sp_hl
+#define z80_inst_ld_sp_ixy__0xF9 z80_inst_ld_sp_ixy
+#define z80_inst_ldd__0xA8 z80_inst_ldd
+#define z80_inst_lddr__0xB8 z80_inst_lddr
+#define z80_inst_ldi__0xA0 z80_inst_ldi
+#define z80_inst_ldir__0xB0 z80_inst_ldir
+#define z80_inst_neg__0x44 z80_inst_neg
+#define z80_inst_neg__0x4C z80_inst_neg
+#define z80_inst_neg__0x54 z80_inst_neg
+#define z80_inst_neg__0x5C z80_inst_neg
+#define z80_inst_neg__0x64 z80_inst_neg
+#define z80_inst_neg__0x6C z80_inst_neg
+#define z80_inst_neg__0x74 z80_inst_neg
+#define z80_inst_neg__0x7C z80_inst_neg
+#define z80_inst_nop2__0x00 z80_inst_nop2
+#define z80_inst_nop2__0x01 z80_inst_nop2
+#define z80_inst_nop2__0x02 z80_inst_nop2
+#define z80_inst_nop2__0x03 z80_inst_nop2
+#define z80_inst_nop2__0x04 z80_inst_nop2
+#define z80_inst_nop2__0x05 z80_inst_nop2
+#define z80_inst_nop2__0x06 z80_inst_nop2
+#define z80_inst_nop2__0x07 z80_inst_nop2
+#define z80_inst_nop2__0x08 z80_inst_nop2
+#define z80_inst_nop2__0x09 z80_inst_nop2
+#define z80_inst_nop2__0x0A z80_inst_nop2
+#define z80_inst_nop2__0x0B z80_inst_nop2
+#define z80_inst_nop2__0x0C z80_inst_nop2
+#define z80_inst_nop2__0x0D z80_inst_nop2
+#define z80_inst_nop2__0x0E z80_inst_nop2
+#define z80_inst_nop2__0x0F z80_inst_nop2
+#define z80_inst_nop2__0x10 z80_inst_nop2
+#define z80_inst_nop2__0x11 z80_inst_nop2
+#define z80_inst_nop2__0x12 z80_inst_nop2
+#define z80_inst_nop2__0x13 z80_inst_nop2
+#define z80_inst_nop2__0x14 z80_inst_nop2
+#define z80_inst_nop2__0x15 z80_inst_nop2
+#define z80_inst_nop2__0x16 z80_inst_nop2
+#define z80_inst_nop2__0x17 z80_inst_nop2
+#define z80_inst_nop2__0x18 z80_inst_nop2
+#define z80_inst_nop2__0x19 z80_inst_nop2
+#define z80_inst_nop2__0x1A z80_inst_nop2
+#define z80_inst_nop2__0x1B z80_inst_nop2
+#define z80_inst_nop2__0x1C z80_inst_nop2
+#define z80_inst_nop2__0x1D z80_inst_nop2
+#define z80_inst_nop2__0x1E z80_inst_nop2
+#define z80_inst_nop2__0x1F z80_inst_nop2
+#define z80_inst_nop2__0x20 z80_inst_nop2
+#define z80_inst_nop2__0x21 z80_inst_nop2
+#define z80_inst_nop2__0x22 z80_inst_nop2
+#define z80_inst_nop2__0x23 z80_inst_nop2
+#define z80_inst_nop2__0x24 z80_inst_nop2
+#define z80_inst_nop2__0x25 z80_inst_nop2
+#define z80_inst_nop2__0x26 z80_inst_nop2
+#define z80_inst_nop2__0x27 z80_inst_nop2
+#define z80_inst_nop2__0x28 z80_inst_nop2
+#define z80_inst_nop2__0x29 z80_inst_nop2
+#define z80_inst_nop2__0x2A z80_inst_nop2
+#define z80_inst_nop2__0x2B z80_inst_nop2
+#define z80_inst_nop2__0x2C z80_inst_nop2
+#define z80_inst_nop2__0x2D z80_inst_nop2
+#define z80_inst_nop2__0x2E z80_inst_nop2
+#define z80_inst_nop2__0x2F z80_inst_nop2
+#define z80_inst_nop2__0x30 z80_inst_nop2
+#define z80_inst_nop2__0x31 z80_inst_nop2
+#define z80_inst_nop2__0x32 z80_inst_nop2
+#define z80_inst_nop2__0x33 z80_inst_nop2
+#define z80_inst_nop2__0x34 z80_inst_nop2
+#define z80_inst_nop2__0x35 z80_inst_nop2
+#define z80_inst_nop2__0x36 z80_inst_nop2
+#define z80_inst_nop2__0x37 z80_inst_nop2
+#define z80_inst_nop2__0x38 z80_inst_nop2
+#define z80_inst_nop2__0x39 z80_inst_nop2
+#define z80_inst_nop2__0x3A z80_inst_nop2
+#define z80_inst_nop2__0x3B z80_inst_nop2
+#define z80_inst_nop2__0x3C z80_inst_nop2
+#define z80_inst_nop2__0x3D z80_inst_nop2
+#define z80_inst_nop2__0x3E z80_inst_nop2
+#define z80_inst_nop2__0x3F z80_inst_nop2
+#define z80_inst_nop2__0x40 z80_inst_nop2
+#define z80_inst_nop2__0x41 z80_inst_nop2
+#define z80_inst_nop2__0x42 z80_inst_nop2
+#define z80_inst_nop2__0x43 z80_inst_nop2
+#define z80_inst_nop2__0x47 z80_inst_nop2
+#define z80_inst_nop2__0x48 z80_inst_nop2
+#define z80_inst_nop2__0x49 z80_inst_nop2
+#define z80_inst_nop2__0x4A z80_inst_nop2
+#define z80_inst_nop2__0x4B z80_inst_nop2
+#define z80_inst_nop2__0x4F z80_inst_nop2
+#define z80_inst_nop2__0x50 z80_inst_nop2
+#define z80_inst_nop2__0x51 z80_inst_nop2
+#define z80_inst_nop2__0x52 z80_inst_nop2
+#define z80_inst_nop2__0x53 z80_inst_nop2
+#define z80_inst_nop2__0x57 z80_inst_nop2
+#define z80_inst_nop2__0x58 z80_inst_nop2
+#define z80_inst_nop2__0x59 z80_inst_nop2
+#define z80_inst_nop2__0x5A z80_inst_nop2
+#define z80_inst_nop2__0x5B z80_inst_nop2
+#define z80_inst_nop2__0x5F z80_inst_nop2
+#define z80_inst_nop2__0x76 z80_inst_nop2
+#define z80_inst_nop2__0x77 z80_inst_nop2
+#define z80_inst_nop2__0x78 z80_inst_nop2
+#define z80_inst_nop2__0x79 z80_inst_nop2
+#define z80_inst_nop2__0x7A z80_inst_nop2
+#define z80_inst_nop2__0x7B z80_inst_nop2
+#define z80_inst_nop2__0x7F z80_inst_nop2
+#define z80_inst_nop2__0x80 z80_inst_nop2
+#define z80_inst_nop2__0x81 z80_inst_nop2
+#define z80_inst_nop2__0x82 z80_inst_nop2
+#define z80_inst_nop2__0x83 z80_inst_nop2
+#define z80_inst_nop2__0x84 z80_inst_nop2
+#define z80_inst_nop2__0x85 z80_inst_nop2
+#define z80_inst_nop2__0x86 z80_inst_nop2
+#define z80_inst_nop2__0x87 z80_inst_nop2
+#define z80_inst_nop2__0x88 z80_inst_nop2
+#define z80_inst_nop2__0x89 z80_inst_nop2
+#define z80_inst_nop2__0x8A z80_inst_nop2
+#define z80_inst_nop2__0x8B z80_inst_nop2
+#define z80_inst_nop2__0x8C z80_inst_nop2
+#define z80_inst_nop2__0x8D z80_inst_nop2
+#define z80_inst_nop2__0x8E z80_inst_nop2
+#define z80_inst_nop2__0x8F z80_inst_nop2
+#define z80_inst_nop2__0x90 z80_inst_nop2
+#define z80_inst_nop2__0x91 z80_inst_nop2
+#define z80_inst_nop2__0x92 z80_inst_nop2
+#define z80_inst_nop2__0x93 z80_inst_nop2
+#define z80_inst_nop2__0x94 z80_inst_nop2
+#define z80_inst_nop2__0x95 z80_inst_nop2
+#define z80_inst_nop2__0x96 z80_inst_nop2
+#define z80_inst_nop2__0x97 z80_inst_nop2
+#define z80_inst_nop2__0x98 z80_inst_nop2
+#define z80_inst_nop2__0x99 z80_inst_nop2
+#define z80_inst_nop2__0x9A z80_inst_nop2
+#define z80_inst_nop2__0x9B z80_inst_nop2
+#define z80_inst_nop2__0x9C z80_inst_nop2
+#define z80_inst_nop2__0x9D z80_inst_nop2
+#define z80_inst_nop2__0x9E z80_inst_nop2
+#define z80_inst_nop2__0x9F z80_inst_nop2
+#define z80_inst_nop2__0xA0 z80_inst_nop2
+#define z80_inst_nop2__0xA1 z80_inst_nop2
+#define z80_inst_nop2__0xA2 z80_inst_nop2
+#define z80_inst_nop2__0xA3 z80_inst_nop2
+#define z80_inst_nop2__0xA4 z80_inst_nop2
+#define z80_inst_nop2__0xA5 z80_inst_nop2
+#define z80_inst_nop2__0xA6 z80_inst_nop2
+#define z80_inst_nop2__0xA7 z80_inst_nop2
+#define z80_inst_nop2__0xA8 z80_inst_nop2
+#define z80_inst_nop2__0xA9 z80_inst_nop2
+#define z80_inst_nop2__0xAA z80_inst_nop2
+#define z80_inst_nop2__0xAB z80_inst_nop2
+#define z80_inst_nop2__0xAC z80_inst_nop2
+#define z80_inst_nop2__0xAD z80_inst_nop2
+#define z80_inst_nop2__0xAE z80_inst_nop2
+#define z80_inst_nop2__0xAF z80_inst_nop2
+#define z80_inst_nop2__0xB0 z80_inst_nop2
+#define z80_inst_nop2__0xB1 z80_inst_nop2
+#define z80_inst_nop2__0xB2 z80_inst_nop2
+#define z80_inst_nop2__0xB3 z80_inst_nop2
+#define z80_inst_nop2__0xB4 z80_inst_nop2
+#define z80_inst_nop2__0xB5 z80_inst_nop2
+#define z80_inst_nop2__0xB6 z80_inst_nop2
+#define z80_inst_nop2__0xB7 z80_inst_nop2
+#define z80_inst_nop2__0xB8 z80_inst_nop2
+#define z80_inst_nop2__0xB9 z80_inst_nop2
+#define z80_inst_nop2__0xBA z80_inst_nop2
+#define z80_inst_nop2__0xBB z80_inst_nop2
+#define z80_inst_nop2__0xBC z80_inst_nop2
+#define z80_inst_nop2__0xBD z80_inst_nop2
+#define z80_inst_nop2__0xBE z80_inst_nop2
+#define z80_inst_nop2__0xBF z80_inst_nop2
+#define z80_inst_nop2__0xC0 z80_inst_nop2
+#define z80_inst_nop2__0xC1 z80_inst_nop2
+#define z80_inst_nop2__0xC2 z80_inst_nop2
+#define z80_inst_nop2__0xC3 z80_inst_nop2
+#define z80_inst_nop2__0xC4 z80_inst_nop2
+#define z80_inst_nop2__0xC5 z80_inst_nop2
+#define z80_inst_nop2__0xC6 z80_inst_nop2
+#define z80_inst_nop2__0xC7 z80_inst_nop2
+#define z80_inst_nop2__0xC8 z80_inst_nop2
+#define z80_inst_nop2__0xC9 z80_inst_nop2
+#define z80_inst_nop2__0xCA z80_inst_nop2
+#define z80_inst_nop2__0xCB z80_inst_nop2
+#define z80_inst_nop2__0xCC z80_inst_nop2
+#define z80_inst_nop2__0xCD z80_inst_nop2
+#define z80_inst_nop2__0xCE z80_inst_nop2
+#define z80_inst_nop2__0xCF z80_inst_nop2
+#define z80_inst_nop2__0xD0 z80_inst_nop2
+#define z80_inst_nop2__0xD1 z80_inst_nop2
+#define z80_inst_nop2__0xD2 z80_inst_nop2
+#define z80_inst_nop2__0xD3 z80_inst_nop2
+#define z80_inst_nop2__0xD4 z80_inst_nop2
+#define z80_inst_nop2__0xD5 z80_inst_nop2
+#define z80_inst_nop2__0xD6 z80_inst_nop2
+#define z80_inst_nop2__0xD7 z80_inst_nop2
+#define z80_inst_nop2__0xD8 z80_inst_nop2
+#define z80_inst_nop2__0xD9 z80_inst_nop2
+#define z80_inst_nop2__0xDA z80_inst_nop2
+#define z80_inst_nop2__0xDB z80_inst_nop2
+#define z80_inst_nop2__0xDC z80_inst_nop2
+#define z80_inst_nop2__0xDD z80_inst_nop2
+#define z80_inst_nop2__0xDE z80_inst_nop2
+#define z80_inst_nop2__0xDF z80_inst_nop2
+#define z80_inst_nop2__0xE0 z80_inst_nop2
+#define z80_inst_nop2__0xE1 z80_inst_nop2
+#define z80_inst_nop2__0xE2 z80_inst_nop2
+#define z80_inst_nop2__0xE3 z80_inst_nop2
+#define z80_inst_nop2__0xE4 z80_inst_nop2
+#define z80_inst_nop2__0xE5 z80_inst_nop2
+#define z80_inst_nop2__0xE6 z80_inst_nop2
+#define z80_inst_nop2__0xE7 z80_inst_nop2
+#define z80_inst_nop2__0xE8 z80_inst_nop2
+#define z80_inst_nop2__0xE9 z80_inst_nop2
+#define z80_inst_nop2__0xEA z80_inst_nop2
+#define z80_inst_nop2__0xEB z80_inst_nop2
+#define z80_inst_nop2__0xEC z80_inst_nop2
+#define z80_inst_nop2__0xED z80_inst_nop2
+#define z80_inst_nop2__0xEE z80_inst_nop2
+#define z80_inst_nop2__0xEF z80_inst_nop2
+#define z80_inst_nop2__0xF0 z80_inst_nop2
+#define z80_inst_nop2__0xF1 z80_inst_nop2
+#define z80_inst_nop2__0xF2 z80_inst_nop2
+#define z80_inst_nop2__0xF3 z80_inst_nop2
+#define z80_inst_nop2__0xF4 z80_inst_nop2
+#define z80_inst_nop2__0xF5 z80_inst_nop2
+#define z80_inst_nop2__0xF6 z80_inst_nop2
+#define z80_inst_nop2__0xF7 z80_inst_nop2
+#define z80_inst_nop2__0xF8 z80_inst_nop2
+#define z80_inst_nop2__0xF9 z80_inst_nop2
+#define z80_inst_nop2__0xFA z80_inst_nop2
+#define z80_inst_nop2__0xFB z80_inst_nop2
+#define z80_inst_nop2__0xFC z80_inst_nop2
+#define z80_inst_nop2__0xFD z80_inst_nop2
+#define z80_inst_nop2__0xFE z80_inst_nop2
+#define z80_inst_nop2__0xFF z80_inst_nop2
+#define z80_inst_nop__0x00 z80_inst_nop
+#define z80_inst_or_hl__0xB6 z80_inst_or_hl
+#define z80_inst_or_ixy__0xB6 z80_inst_or_ixy
+#define z80_inst_or_n__0xF6 z80_inst_or_n
+#define z80_inst_otdr__0xBB z80_inst_otdr
+#define z80_inst_otir__0xB3 z80_inst_otir
+#define z80_inst_out_n_a__0xD3 z80_inst_out_n_a
+#define z80_inst_outd__0xAB z80_inst_outd
+#define z80_inst_outi__0xA3 z80_inst_outi
+#define z80_inst_pop_ixy__0xE1 z80_inst_pop_ixy
+#define z80_inst_push_ixy__0xE5 z80_inst_push_ixy
+#define z80_inst_ret__0xC9 z80_inst_ret
+#define z80_inst_reti__0x4D z80_inst_reti
+#define z80_inst_retn__0x45 z80_inst_retn
+#define z80_inst_retn__0x55 z80_inst_retn
+#define z80_inst_retn__0x5D z80_inst_retn
+#define z80_inst_retn__0x65 z80_inst_retn
+#define z80_inst_retn__0x6D z80_inst_retn
+#define z80_inst_retn__0x75 z80_inst_retn
+#define z80_inst_retn__0x7D z80_inst_retn
+#define z80_inst_rl_hl__0x16 z80_inst_rl_hl
+#define z80_inst_rla__0x17 z80_inst_rla
+#define z80_inst_rlc_hl__0x06 z80_inst_rlc_hl
+#define z80_inst_rlca__0x07 z80_inst_rlca
+#define z80_inst_rld__0x6F z80_inst_rld
+#define z80_inst_rr_hl__0x1E z80_inst_rr_hl
+#define z80_inst_rra__0x1F z80_inst_rra
+#define z80_inst_rrc_hl__0x0E z80_inst_rrc_hl
+#define z80_inst_rrca__0x0F z80_inst_rrca
+#define z80_inst_rrd__0x67 z80_inst_rrd
+#define z80_inst_sbc_a_hl__0x9E z80_inst_sbc_a_hl
+#define z80_inst_sbc_a_ixy__0x9E z80_inst_sbc_a_ixy
+#define z80_inst_sbc_a_n__0xDE z80_inst_sbc_a_n
+#define z80_inst_scf__0x37 z80_inst_scf
+#define z80_inst_sl1_hl__0x36 z80_inst_sl1_hl
+#define z80_inst_sla_hl__0x26 z80_inst_sla_hl
+#define z80_inst_sra_hl__0x2E z80_inst_sra_hl
+#define z80_inst_srl_hl__0x3E z80_inst_srl_hl
+#define z80_inst_sub_hl__0x96 z80_inst_sub_hl
+#define z80_inst_sub_ixy__0x96 z80_inst_sub_ixy
+#define z80_inst_sub_n__0xD6 z80_inst_sub_n
+#define z80_inst_unimplemented__0x00 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x01 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x02 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x03 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x04 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x05 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x06 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x07 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x08 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x09 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x0A z80_inst_unimplemented
+#define z80_inst_unimplemented__0x0B z80_inst_unimplemented
+#define z80_inst_unimplemented__0x0C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x0D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x0E z80_inst_unimplemented
+#define z80_inst_unimplemented__0x0F z80_inst_unimplemented
+#define z80_inst_unimplemented__0x10 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x11 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x12 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x13 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x14 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x15 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x16 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x17 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x18 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x19 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x1A z80_inst_unimplemented
+#define z80_inst_unimplemented__0x1B z80_inst_unimplemented
+#define z80_inst_unimplemented__0x1C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x1D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x1E z80_inst_unimplemented
+#define z80_inst_unimplemented__0x1F z80_inst_unimplemented
+#define z80_inst_unimplemented__0x20 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x21 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x22 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x23 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x24 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x25 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x26 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x27 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x28 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x29 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x2A z80_inst_unimplemented
+#define z80_inst_unimplemented__0x2B z80_inst_unimplemented
+#define z80_inst_unimplemented__0x2C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x2D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x2E z80_inst_unimplemented
+#define z80_inst_unimplemented__0x2F z80_inst_unimplemented
+#define z80_inst_unimplemented__0x30 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x31 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x32 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x33 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x34 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x35 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x36 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x37 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x38 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x39 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x3A z80_inst_unimplemented
+#define z80_inst_unimplemented__0x3B z80_inst_unimplemented
+#define z80_inst_unimplemented__0x3C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x3D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x3E z80_inst_unimplemented
+#define z80_inst_unimplemented__0x3F z80_inst_unimplemented
+#define z80_inst_unimplemented__0x44 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x45 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x4C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x4D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x54 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x55 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x5C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x5D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x60 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x61 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x62 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x63 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x64 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x65 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x67 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x68 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x69 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x6A z80_inst_unimplemented
+#define z80_inst_unimplemented__0x6B z80_inst_unimplemented
+#define z80_inst_unimplemented__0x6C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x6D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x6F z80_inst_unimplemented
+#define z80_inst_unimplemented__0x7C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x7D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x80 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x81 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x82 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x83 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x84 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x85 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x87 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x88 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x89 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x8A z80_inst_unimplemented
+#define z80_inst_unimplemented__0x8B z80_inst_unimplemented
+#define z80_inst_unimplemented__0x8C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x8D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x8F z80_inst_unimplemented
+#define z80_inst_unimplemented__0x90 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x91 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x92 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x93 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x94 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x95 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x97 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x98 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x99 z80_inst_unimplemented
+#define z80_inst_unimplemented__0x9A z80_inst_unimplemented
+#define z80_inst_unimplemented__0x9B z80_inst_unimplemented
+#define z80_inst_unimplemented__0x9C z80_inst_unimplemented
+#define z80_inst_unimplemented__0x9D z80_inst_unimplemented
+#define z80_inst_unimplemented__0x9F z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA0 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA1 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA2 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA3 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA4 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA5 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA7 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA8 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xA9 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xAA z80_inst_unimplemented
+#define z80_inst_unimplemented__0xAB z80_inst_unimplemented
+#define z80_inst_unimplemented__0xAC z80_inst_unimplemented
+#define z80_inst_unimplemented__0xAD z80_inst_unimplemented
+#define z80_inst_unimplemented__0xAF z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB0 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB1 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB2 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB3 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB4 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB5 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB7 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB8 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xB9 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xBA z80_inst_unimplemented
+#define z80_inst_unimplemented__0xBB z80_inst_unimplemented
+#define z80_inst_unimplemented__0xBC z80_inst_unimplemented
+#define z80_inst_unimplemented__0xBD z80_inst_unimplemented
+#define z80_inst_unimplemented__0xBF z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC0 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC1 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC2 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC3 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC4 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC5 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC7 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC8 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xC9 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xCA z80_inst_unimplemented
+#define z80_inst_unimplemented__0xCB z80_inst_unimplemented
+#define z80_inst_unimplemented__0xCC z80_inst_unimplemented
+#define z80_inst_unimplemented__0xCD z80_inst_unimplemented
+#define z80_inst_unimplemented__0xCF z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD0 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD1 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD2 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD3 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD4 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD5 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD7 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD8 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xD9 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xDA z80_inst_unimplemented
+#define z80_inst_unimplemented__0xDB z80_inst_unimplemented
+#define z80_inst_unimplemented__0xDC z80_inst_unimplemented
+#define z80_inst_unimplemented__0xDD z80_inst_unimplemented
+#define z80_inst_unimplemented__0xDF z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE0 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE1 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE2 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE3 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE4 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE5 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE7 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE8 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xE9 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xEA z80_inst_unimplemented
+#define z80_inst_unimplemented__0xEB z80_inst_unimplemented
+#define z80_inst_unimplemented__0xEC z80_inst_unimplemented
+#define z80_inst_unimplemented__0xED z80_inst_unimplemented
+#define z80_inst_unimplemented__0xEF z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF0 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF1 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF2 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF3 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF4 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF5 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF7 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF8 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xF9 z80_inst_unimplemented
+#define z80_inst_unimplemented__0xFA z80_inst_unimplemented
+#define z80_inst_unimplemented__0xFB z80_inst_unimplemented
+#define z80_inst_unimplemented__0xFC z80_inst_unimplemented
+#define z80_inst_unimplemented__0xFD z80_inst_unimplemented
+#define z80_inst_unimplemented__0xFF z80_inst_unimplemented
+#define z80_inst_xor_hl__0xAE z80_inst_xor_hl
+#define z80_inst_xor_ixy__0xAE z80_inst_xor_ixy
+#define z80_inst_xor_n__0xEE z80_inst_xor_n/* @AUTOGEN_ALIAS_BLOCK_END */
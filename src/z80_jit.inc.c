@@ -0,0 +1,507 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    This file contains an optional x86-64 JIT for the Z80 core. It is included
+    near the end of z80.c and should not be compiled separately.
+
+    Despite the name, no instruction is actually compiled: this is a
+    call-threading translator. Blocks from the decode cache that run often
+    enough are turned into native code that calls each instruction's
+    interpreter handler in turn, doing the fetch bookkeeping (R, prefixes, PC)
+    inline and checking after every instruction whether the block should be
+    left: because the cycle budget ran out, a branch was taken, or the memory
+    map changed. This removes the dispatch loop and cache lookups from hot
+    code without duplicating any instruction semantics.
+
+    Only code from ROM is translated, and only up to the first instruction
+    that could affect interrupts (I/O, EI/DI, RETI/RETN, IM, HALT), so an
+    interrupt can never become due in the middle of a native block; the
+    interpreter handles everything else.
+
+    The code buffer is only ever writable or executable, never both. Generated
+    code is listed in /tmp/perf-<pid>.map for Linux's perf tool.
+*/
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+#define JIT_BUFFER_SIZE   (4 * 1024 * 1024)
+#define JIT_HOT_THRESHOLD 32
+
+/* Upper bounds on the bytes of native code we emit */
+#define JIT_MAX_INSTR_CODE 192
+#define JIT_MAX_BLOCK_SIZE                                                    \
+    (Z80_CACHE_BLOCK_INSTRS * (JIT_MAX_INSTR_CODE + sizeof(Z80Instr)) + 64)
+
+#define OFFSET(member) ((uint32_t) offsetof(Z80, member))
+
+typedef uint32_t (*JitBlock)(Z80*, uint32_t);
+
+typedef struct {
+    Z80RegFile regs;
+    MMU mmu;
+    uint32_t spent;
+    uint8_t system_ram[MMU_SYSTEM_RAM_SIZE];
+    uint8_t cart_ram[MMU_CART_RAM_SIZE];
+} JitSnapshot;
+
+/*
+    Append raw bytes to the native code buffer.
+*/
+static inline void emit(Z80Jit *jit, const uint8_t *bytes, size_t size)
+{
+    memcpy(jit->next, bytes, size);
+    jit->next += size;
+}
+
+#define EMIT(...)                                                             \
+    emit(jit, (const uint8_t[]) {__VA_ARGS__},                                \
+         sizeof((const uint8_t[]) {__VA_ARGS__}));
+
+/*
+    Append a little-endian 16-bit value to the native code buffer.
+*/
+static inline void emit16(Z80Jit *jit, uint16_t value)
+{
+    EMIT(value, value >> 8)
+}
+
+/*
+    Append a little-endian 32-bit value to the native code buffer.
+*/
+static inline void emit32(Z80Jit *jit, uint32_t value)
+{
+    EMIT(value, value >> 8, value >> 16, value >> 24)
+}
+
+/*
+    Append a little-endian 64-bit value to the native code buffer.
+*/
+static inline void emit64(Z80Jit *jit, uint64_t value)
+{
+    emit32(jit, value);
+    emit32(jit, value >> 32);
+}
+
+/*
+    Emit a conditional jump (0x0F 0x8?) to the block's exit, to be patched.
+
+    Return the location of the 32-bit displacement.
+*/
+static uint8_t* emit_exit_jump(Z80Jit *jit, uint8_t condition)
+{
+    EMIT(0x0F, condition)
+    uint8_t *disp = jit->next;
+    emit32(jit, 0);
+    return disp;
+}
+
+/*
+    Return whether the JIT is able to translate the given instruction.
+*/
+static bool jit_can_compile(const Z80Instr *instr)
+{
+    uint8_t op = instr->opcode;
+
+    if ((*instruction_tables[instr->table])[op] == z80_inst_unimplemented)
+        return false;
+
+    switch (instr->table) {
+        case TABLE_MAIN:  // HALT, OUT (n), A, IN A, (n), DI, EI
+            return op != 0x76 && op != 0xD3 && op != 0xDB &&
+                   op != 0xF3 && op != 0xFB;
+        case TABLE_EXTENDED:
+            if (op >= 0x40 && op < 0x80) {  // IN, OUT, RETN, RETI, IM
+                uint8_t low = op & 0x07;
+                return low >= 0x02 && low != 0x05 && low != 0x06;
+            }
+            return (op & 0x03) < 0x02;  // INI, OUTI, etc.
+        default:
+            return true;
+    }
+}
+
+/*
+    Emit native code that fetches and runs one instruction.
+
+    This mirrors fetch_instruction() and the dispatch in z80_run_until().
+    While it runs, RBX holds the Z80 pointer and R13D the cycles spent.
+*/
+static void emit_instruction(Z80Jit *jit, const Z80Instr *instr)
+{
+    // movzx eax, byte [rbx+r]; lea ecx, [rax+1]; and eax, 0x80;
+    // and ecx, 0x7F; or eax, ecx; mov [rbx+r], al
+    EMIT(0x0F, 0xB6, 0x83) emit32(jit, OFFSET(regs.r));
+    EMIT(0x8D, 0x48, 0x01, 0x25, 0x80, 0x00, 0x00, 0x00,
+         0x83, 0xE1, 0x7F, 0x09, 0xC8, 0x88, 0x83) emit32(jit, OFFSET(regs.r));
+
+    if (instr->prefix) {
+        bool ix = instr->prefix == 0xDD;
+        uint32_t regs[3][2] = {
+            {OFFSET(regs.ixy), ix ? OFFSET(regs.ix)  : OFFSET(regs.iy)},
+            {OFFSET(regs.ih),  ix ? OFFSET(regs.ixh) : OFFSET(regs.iyh)},
+            {OFFSET(regs.il),  ix ? OFFSET(regs.ixl) : OFFSET(regs.iyl)}
+        };
+        for (size_t i = 0; i < 3; i++) {
+            // lea rax, [rbx+reg]; mov [rbx+alias], rax
+            EMIT(0x48, 0x8D, 0x83) emit32(jit, regs[i][1]);
+            EMIT(0x48, 0x89, 0x83) emit32(jit, regs[i][0]);
+        }
+    }
+
+    if (instr->skip) {
+        // add word [rbx+pc], skip
+        EMIT(0x66, 0x83, 0x83) emit32(jit, OFFSET(regs.pc));
+        EMIT(instr->skip)
+    }
+
+    // mov rax, instr; mov [rbx+cache.instr], rax
+    EMIT(0x48, 0xB8) emit64(jit, (uintptr_t) instr);
+    EMIT(0x48, 0x89, 0x83) emit32(jit, OFFSET(cache.instr));
+
+    // mov rdi, rbx; mov esi, opcode; mov rax, handler; call rax
+    EMIT(0x48, 0x89, 0xDF, 0xBE) emit32(jit, instr->opcode);
+    EMIT(0x48, 0xB8)
+    emit64(jit, (uintptr_t) (*instruction_tables[instr->table])[instr->opcode]);
+    EMIT(0xFF, 0xD0)
+
+    // movzx eax, al; add r13d, eax
+    EMIT(0x0F, 0xB6, 0xC0, 0x41, 0x01, 0xC5)
+}
+
+/*
+    Write an entry for a newly compiled block to the perf map file.
+*/
+static void jit_write_perf_map(Z80 *z80, const Z80Block *block,
+                               const uint8_t *code, size_t size)
+{
+    const MMU *mmu = z80->mmu;
+    const uint8_t *rom = mmu->rom_banks[0];
+    size_t span = MMU_NUM_ROM_BANKS * MMU_ROM_BANK_SIZE;
+
+    if (rom && block->source >= rom && block->source < rom + span)
+        fprintf(z80->jit.perf_map, "%lx %zx z80_0x%04X_rom_0x%05zX\n",
+                (unsigned long) (uintptr_t) code, size, block->pc,
+                (size_t) (block->source - rom));
+    else
+        fprintf(z80->jit.perf_map, "%lx %zx z80_0x%04X\n",
+                (unsigned long) (uintptr_t) code, size, block->pc);
+    fflush(z80->jit.perf_map);
+}
+
+/*
+    Change the protection of the pages covering part of the native code buffer.
+
+    The buffer is never writable and executable at once: pages are made
+    writable only while a block is emitted into them. If this fails, the JIT
+    is turned off, and the interpreter runs everything from then on.
+*/
+static bool jit_protect(Z80 *z80, const uint8_t *start, const uint8_t *end,
+                        int prot)
+{
+    uintptr_t page = sysconf(_SC_PAGESIZE);
+    uintptr_t first = (uintptr_t) start & ~(page - 1);
+    uintptr_t last = ((uintptr_t) end + page - 1) & ~(page - 1);
+
+    if (mprotect((void*) first, last - first, prot)) {
+        ERROR_ERRNO("Z80 JIT: couldn't change protection of native code")
+        z80->jit.mode = Z80_JIT_OFF;
+        return false;
+    }
+    return true;
+}
+
+/*
+    Discard all compiled code, making room in the buffer.
+*/
+static void jit_flush(Z80 *z80)
+{
+    DEBUG("Z80 JIT: buffer full, discarding compiled code")
+    for (size_t i = 0; i < Z80_CACHE_BLOCKS; i++) {
+        z80->cache.blocks[i].native = NULL;
+        z80->cache.blocks[i].hits = 0;
+    }
+    z80->jit.next = z80->jit.buffer;
+}
+
+/*
+    Translate a cached block into native code.
+
+    The translation stops before the first instruction we can't handle; if
+    that is the first one, the block is left to the interpreter.
+*/
+static void jit_compile(Z80 *z80, Z80Block *block)
+{
+    Z80Jit *jit = &z80->jit;
+    uint8_t *exits[Z80_CACHE_BLOCK_INSTRS * 3];
+    size_t count = 0, num_exits = 0;
+
+    while (count < block->count && jit_can_compile(&block->instrs[count]))
+        count++;
+    block->hits = 0;
+    if (!count)
+        return;
+
+    if (jit->next + JIT_MAX_BLOCK_SIZE > jit->buffer + JIT_BUFFER_SIZE)
+        jit_flush(z80);
+
+    uint8_t *start = jit->next;
+    if (!jit_protect(z80, start, start + JIT_MAX_BLOCK_SIZE,
+                     PROT_READ | PROT_WRITE))
+        return;
+
+    // Handlers read operands from the instruction, so it must outlive the
+    // cache block, which may be re-decoded while this code still exists
+    Z80Instr *instrs = (Z80Instr*) jit->next;
+    memcpy(instrs, block->instrs, count * sizeof(Z80Instr));
+    jit->next += count * sizeof(Z80Instr);
+    jit->next += -(uintptr_t) jit->next & 0x0F;
+
+    uint8_t *code = jit->next;
+
+    // push rbx; push r12; push r13; push r14; push r15
+    // mov rbx, rdi; mov r12d, esi; xor r13d, r13d
+    EMIT(0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57,
+         0x48, 0x89, 0xFB, 0x41, 0x89, 0xF4, 0x45, 0x31, 0xED)
+    // mov r14, &mmu->map_gen; mov r15d, [r14]
+    EMIT(0x49, 0xBE) emit64(jit, (uintptr_t) &z80->mmu->map_gen);
+    EMIT(0x45, 0x8B, 0x3E)
+
+    for (size_t i = 0; i < count; i++) {
+        emit_instruction(jit, &instrs[i]);
+        if (i == count - 1)
+            break;
+
+        // cmp r13d, r12d; jae exit
+        EMIT(0x45, 0x39, 0xE5)
+        exits[num_exits++] = emit_exit_jump(jit, 0x83);
+        // mov eax, [r14]; cmp eax, r15d; jne exit
+        EMIT(0x41, 0x8B, 0x06, 0x44, 0x39, 0xF8)
+        exits[num_exits++] = emit_exit_jump(jit, 0x85);
+        // cmp word [rbx+pc], next_pc; jne exit
+        EMIT(0x66, 0x81, 0xBB) emit32(jit, OFFSET(regs.pc));
+        emit16(jit, instrs[i + 1].pc);
+        exits[num_exits++] = emit_exit_jump(jit, 0x85);
+    }
+
+    for (size_t i = 0; i < num_exits; i++) {
+        uint32_t disp = jit->next - (exits[i] + 4);
+        memcpy(exits[i], &disp, sizeof(disp));
+    }
+
+    // mov eax, r13d; pop r15; pop r14; pop r13; pop r12; pop rbx; ret
+    EMIT(0x44, 0x89, 0xE8, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C,
+         0x5B, 0xC3)
+
+    if (!jit_protect(z80, start, jit->next, PROT_READ | PROT_EXEC))
+        return;
+    block->native = code;
+    block->native_count = count;
+    if (jit->perf_map)
+        jit_write_perf_map(z80, block, code, jit->next - code);
+}
+
+/*
+    Save the state that a block can modify.
+*/
+static void jit_save_state(const Z80 *z80, JitSnapshot *snap)
+{
+    const MMU *mmu = z80->mmu;
+
+    snap->regs = z80->regs;
+    snap->mmu = *mmu;
+    memcpy(snap->system_ram, mmu->system_ram, MMU_SYSTEM_RAM_SIZE);
+    if (mmu->cart_ram)
+        memcpy(snap->cart_ram, mmu->cart_ram, MMU_CART_RAM_SIZE);
+}
+
+/*
+    Restore the state saved by jit_save_state().
+*/
+static void jit_restore_state(Z80 *z80, const JitSnapshot *snap)
+{
+    MMU *mmu = z80->mmu;
+
+    z80->regs = snap->regs;
+    *mmu = snap->mmu;
+    memcpy(mmu->system_ram, snap->system_ram, MMU_SYSTEM_RAM_SIZE);
+    if (mmu->cart_ram)
+        memcpy(mmu->cart_ram, snap->cart_ram, MMU_CART_RAM_SIZE);
+}
+
+/*
+    Return the name of the first register that differs between two files, or
+    NULL if they match.
+*/
+static const char* jit_compare_regs(const Z80RegFile *a, const Z80RegFile *b)
+{
+    #define CHECK(reg) if (a->reg != b->reg) return #reg;
+    CHECK(af) CHECK(bc) CHECK(de) CHECK(hl)
+    CHECK(af_) CHECK(bc_) CHECK(de_) CHECK(hl_)
+    CHECK(ix) CHECK(iy) CHECK(sp) CHECK(pc) CHECK(i) CHECK(r)
+    CHECK(im_a) CHECK(im_b) CHECK(iff1) CHECK(iff2)
+    CHECK(flag_op) CHECK(flag_lh) CHECK(flag_rh) CHECK(flag_res)
+    CHECK(ixy) CHECK(ih) CHECK(il)
+    #undef CHECK
+    return NULL;
+}
+
+/*
+    Run the instructions of a compiled block through the interpreter.
+
+    This is the reference for the lockstep mode: it follows the same exit
+    rules as the native code, but fetches each instruction normally.
+*/
+static uint32_t jit_interpret_block(Z80 *z80, Z80Block *block, uint32_t limit)
+{
+    uint32_t spent = 0, map_gen = z80->mmu->map_gen;
+
+    z80->cache.block = block;
+    z80->cache.next = 0;
+    for (size_t i = 0; i < block->native_count; i++) {
+        if (i && (spent >= limit || z80->mmu->map_gen != map_gen ||
+                  z80->regs.pc != block->instrs[i].pc))
+            break;
+        const Z80Instr *instr = fetch_instruction(z80);
+        spent += (*instruction_tables[instr->table])[instr->opcode](
+            z80, instr->opcode);
+    }
+    return spent;
+}
+
+/*
+    Run a compiled block both ways and check that the results agree.
+
+    The interpreter runs first, from a snapshot of the CPU and memory; then
+    we rewind and run the native code. If the registers, memory, or cycle
+    count differ, we stop emulation with Z80_EXC_JIT_MISMATCH.
+*/
+static uint32_t jit_run_verified(Z80 *z80, Z80Block *block, uint32_t limit)
+{
+    JitSnapshot *before = z80->jit.snapshots, *after = before + 1;
+    const MMU *mmu = z80->mmu;
+    const char *diff = NULL;
+
+    jit_save_state(z80, before);
+    after->spent = jit_interpret_block(z80, block, limit);
+    jit_save_state(z80, after);
+    jit_restore_state(z80, before);
+
+    uint32_t spent = ((JitBlock) block->native)(z80, limit);
+
+    if (spent != after->spent)
+        diff = "cycles";
+    else if (!(diff = jit_compare_regs(&after->regs, &z80->regs))) {
+        if (memcmp(after->system_ram, mmu->system_ram, MMU_SYSTEM_RAM_SIZE) ||
+                (mmu->cart_ram && memcmp(after->cart_ram, mmu->cart_ram,
+                                         MMU_CART_RAM_SIZE)))
+            diff = "memory";
+    }
+
+    if (diff) {
+        ERROR("Z80 JIT: block at 0x%04X disagrees with the interpreter "
+              "(first difference: %s)", block->pc, diff)
+        z80->except = true;
+        z80->exc_code = Z80_EXC_JIT_MISMATCH;
+        z80->exc_data = 0;
+    }
+    return spent;
+}
+
+/*
+    Run compiled code for the instruction at PC, if possible.
+
+    Return the number of cycles consumed, or zero if the interpreter should
+    handle the next instruction itself. The cycle budget must be positive.
+*/
+static uint32_t jit_try(Z80 *z80, uint64_t cycles)
+{
+    Z80DecodeCache *cache = &z80->cache;
+    const Z80Block *current = cache->block;
+    uint16_t pc = z80->regs.pc;
+
+    if (current && cache->next < current->count &&
+            current->instrs[cache->next].pc == pc)
+        return 0;  // In the middle of an interpreted block
+
+    Z80Block *block = &cache->blocks[pc & (Z80_CACHE_BLOCKS - 1)];
+    if (!block->count || block->pc != pc || block->ram)
+        return 0;
+    if (block->map_gen != z80->mmu->map_gen) {
+        if (block->source != mmu_map_code(z80->mmu, pc))
+            return 0;
+        block->map_gen = z80->mmu->map_gen;
+    }
+
+    if (!block->native) {
+        if (++block->hits < JIT_HOT_THRESHOLD)
+            return 0;
+        jit_compile(z80, block);
+        if (!block->native)
+            return 0;
+    }
+
+    // If interrupts were just enabled, one may be accepted after the next
+    // instruction, so leave it to the interpreter
+    if (z80->regs.iff1 && io_check_irq(z80->io))
+        return 0;
+
+    uint32_t limit = cycles > UINT32_MAX ? UINT32_MAX : cycles;
+
+    cache->block = NULL;
+    if (z80->jit.mode == Z80_JIT_VERIFY)
+        return jit_run_verified(z80, block, limit);
+    return ((JitBlock) block->native)(z80, limit);
+}
+
+/*
+    Allocate the native code buffer and open the perf map, if needed.
+*/
+static bool jit_start(Z80 *z80)
+{
+    Z80Jit *jit = &z80->jit;
+    char path[64];
+
+    if (jit->buffer)
+        return true;
+
+    void *buffer = mmap(NULL, JIT_BUFFER_SIZE, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED) {
+        ERROR_ERRNO("Z80 JIT: couldn't allocate memory for native code")
+        return false;
+    }
+    jit->buffer = jit->next = buffer;
+
+    snprintf(path, sizeof(path), "/tmp/perf-%ld.map", (long) getpid());
+    if (!(jit->perf_map = fopen(path, "w")))
+        WARN_ERRNO("Z80 JIT: couldn't open %s", path)
+
+    for (size_t i = 0; i < Z80_CACHE_BLOCKS; i++)
+        z80->cache.blocks[i].native = NULL;
+    return true;
+}
+
+/*
+    Free memory used by the JIT.
+*/
+static void jit_stop(Z80 *z80)
+{
+    Z80Jit *jit = &z80->jit;
+
+    if (jit->buffer)
+        munmap(jit->buffer, JIT_BUFFER_SIZE);
+    if (jit->perf_map)
+        fclose(jit->perf_map);
+    free(jit->snapshots);
+
+    jit->buffer = jit->next = NULL;
+    jit->perf_map = NULL;
+    jit->snapshots = NULL;
+}
+
+#undef OFFSET
+#undef EMIT
+
+#pragma GCC diagnostic pop
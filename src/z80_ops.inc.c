@@ -13,14 +13,6 @@
     - http://www.z80.info/z80sflag.htm
 */
 
-typedef uint8_t (*DispatchTable[256])(Z80*, uint8_t);
-
-static DispatchTable instruction_table;
-static DispatchTable instruction_table_extended;
-static DispatchTable instruction_table_bits;
-static DispatchTable instruction_table_index;
-static DispatchTable instruction_table_index_bits;
-
 /*
     Unimplemented opcode handler.
 */
@@ -40,7 +32,7 @@ static uint8_t z80_inst_unimplemented(Z80 *z80, uint8_t opcode)
         0x7D, 0x7F):
     Load r' (8-bit register) into r (8-bit register).
 */
-static uint8_t z80_inst_ld_r_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_r_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *dst = extract_reg(z80, opcode),
             *src = extract_reg(z80, opcode << 3);
@@ -53,10 +45,10 @@ static uint8_t z80_inst_ld_r_r(Z80 *z80, uint8_t opcode)
     LD r, n (0x06, 0x0E, 0x16, 0x1E, 0x26, 0x2E, 0x3E):
     Load n (8-bit immediate) into r (8-bit register).
 */
-static uint8_t z80_inst_ld_r_n(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_r_n(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode);
-    *reg = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    *reg = read_operand(z80, ++z80->regs.pc);
     z80->regs.pc++;
     return 7;
 }
@@ -65,7 +57,7 @@ static uint8_t z80_inst_ld_r_n(Z80 *z80, uint8_t opcode)
     LD r, (HL) (0x46, 0x4E, 0x56, 0x5E, 0x66, 0x6E, 0x7E):
     Load the memory pointed to by HL into r (8-bit register).
 */
-static uint8_t z80_inst_ld_r_hl(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_r_hl(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode);
     *reg = mmu_read_byte(z80->mmu, z80->regs.hl);
@@ -78,7 +70,7 @@ static uint8_t z80_inst_ld_r_hl(Z80 *z80, uint8_t opcode)
                    0xFD46, 0xFD4E, 0xFD56, 0xFD5E, 0xFD66, 0xFD6E, 0xFD7E):
     Load (IX+d) or (IY+d) into r (8-bit register).
 */
-static uint8_t z80_inst_ld_r_ixy(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_r_ixy(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode);
     uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
@@ -91,7 +83,7 @@ static uint8_t z80_inst_ld_r_ixy(Z80 *z80, uint8_t opcode)
     LD (HL), r (0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x77):
     Load r (8-bit register) into the memory pointed to by HL.
 */
-static uint8_t z80_inst_ld_hl_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_hl_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     mmu_write_byte(z80->mmu, z80->regs.hl, *reg);
@@ -104,7 +96,7 @@ static uint8_t z80_inst_ld_hl_r(Z80 *z80, uint8_t opcode)
                    0xFD70, 0xFD71, 0xFD72, 0xFD73, 0xFD74, 0xFD75, 0xFD77):
     Load r (8-bit register) into (IX+d) or (IY+d).
 */
-static uint8_t z80_inst_ld_ixy_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_ixy_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
@@ -120,7 +112,7 @@ static uint8_t z80_inst_ld_ixy_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_hl_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t byte = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t byte = read_operand(z80, ++z80->regs.pc);
     mmu_write_byte(z80->mmu, z80->regs.hl, byte);
     z80->regs.pc++;
     return 10;
@@ -134,7 +126,7 @@ static uint8_t z80_inst_ld_ixy_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
     uint16_t addr = get_index_addr(z80, ++z80->regs.pc);
-    uint8_t byte = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t byte = read_operand(z80, ++z80->regs.pc);
     mmu_write_byte(z80->mmu, addr, byte);
     z80->regs.pc++;
     return 19;
@@ -144,7 +136,7 @@ static uint8_t z80_inst_ld_ixy_n(Z80 *z80, uint8_t opcode)
     LD A, (BC/DE) (0x0A, 0x1A):
     Load the memory pointed to BC or DE into A.
 */
-static uint8_t z80_inst_ld_a_bcde(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_a_bcde(Z80 *z80, uint8_t opcode)
 {
     uint16_t addr = *extract_pair(z80, opcode);
     z80->regs.a = mmu_read_byte(z80->mmu, addr);
@@ -159,7 +151,7 @@ static uint8_t z80_inst_ld_a_bcde(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_a_nn(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     z80->regs.a = mmu_read_byte(z80->mmu, addr);
     z80->regs.pc += 2;
     return 13;
@@ -169,7 +161,7 @@ static uint8_t z80_inst_ld_a_nn(Z80 *z80, uint8_t opcode)
     LD (BC/DE), A (0x02, 0x12):
     Load A into the memory address pointed to by BC or DE.
 */
-static uint8_t z80_inst_ld_bcde_a(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_bcde_a(Z80 *z80, uint8_t opcode)
 {
     uint16_t addr = *extract_pair(z80, opcode);
     mmu_write_byte(z80->mmu, addr, z80->regs.a);
@@ -184,7 +176,7 @@ static uint8_t z80_inst_ld_bcde_a(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_nn_a(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     mmu_write_byte(z80->mmu, addr, z80->regs.a);
     z80->regs.pc += 2;
     return 13;
@@ -244,9 +236,9 @@ static uint8_t z80_inst_ld_r_a(Z80 *z80, uint8_t opcode)
     LD dd, nn (0x01, 0x11, 0x21, 0x31):
     Load nn (16-bit immediate) into dd (16-bit register).
 */
-static uint8_t z80_inst_ld_dd_nn(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_dd_nn(Z80 *z80, uint8_t opcode)
 {
-    *extract_pair(z80, opcode) = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    *extract_pair(z80, opcode) = read_operand_double(z80, ++z80->regs.pc);
     z80->regs.pc += 2;
     return 10;
 }
@@ -258,7 +250,7 @@ static uint8_t z80_inst_ld_dd_nn(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_ixy_nn(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    *z80->regs.ixy = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    *z80->regs.ixy = read_operand_double(z80, ++z80->regs.pc);
     z80->regs.pc += 2;
     return 14;
 }
@@ -270,7 +262,7 @@ static uint8_t z80_inst_ld_ixy_nn(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_hl_inn(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     z80->regs.hl = mmu_read_double(z80->mmu, addr);
     z80->regs.pc += 2;
     return 16;
@@ -280,9 +272,9 @@ static uint8_t z80_inst_ld_hl_inn(Z80 *z80, uint8_t opcode)
     LD dd, (nn) (0xED4B, 0xED5B, 0xED6B, 0xED7B):
     Load memory at address nn into dd (16-bit register).
 */
-static uint8_t z80_inst_ld_dd_inn(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_dd_inn(Z80 *z80, uint8_t opcode)
 {
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     *extract_pair(z80, opcode) = mmu_read_double(z80->mmu, addr);
     z80->regs.pc += 2;
     return 20;
@@ -295,7 +287,7 @@ static uint8_t z80_inst_ld_dd_inn(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_ixy_inn(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     *z80->regs.ixy = mmu_read_double(z80->mmu, addr);
     z80->regs.pc += 2;
     return 20;
@@ -308,7 +300,7 @@ static uint8_t z80_inst_ld_ixy_inn(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_inn_hl(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     mmu_write_double(z80->mmu, addr, z80->regs.hl);
     z80->regs.pc += 2;
     return 16;
@@ -318,9 +310,9 @@ static uint8_t z80_inst_ld_inn_hl(Z80 *z80, uint8_t opcode)
     LD (nn), dd (0xED43, 0xED53, 0xED63, 0xED73);
     Load dd (16-bit register) into memory address nn.
 */
-static uint8_t z80_inst_ld_inn_dd(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ld_inn_dd(Z80 *z80, uint8_t opcode)
 {
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     mmu_write_double(z80->mmu, addr, *extract_pair(z80, opcode));
     z80->regs.pc += 2;
     return 20;
@@ -333,7 +325,7 @@ static uint8_t z80_inst_ld_inn_dd(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ld_inn_ixy(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint16_t addr = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    uint16_t addr = read_operand_double(z80, ++z80->regs.pc);
     mmu_write_double(z80->mmu, addr, *z80->regs.ixy);
     z80->regs.pc += 2;
     return 20;
@@ -367,7 +359,7 @@ static uint8_t z80_inst_ld_sp_ixy(Z80 *z80, uint8_t opcode)
     PUSH qq (0xC5, 0xD5, 0xE5, 0xF5):
     Push qq onto the stack, and decrement SP by two.
 */
-static uint8_t z80_inst_push_qq(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_push_qq(Z80 *z80, uint8_t opcode)
 {
     stack_push(z80, *extract_pair_qq(z80, opcode));
     z80->regs.pc++;
@@ -390,7 +382,7 @@ static uint8_t z80_inst_push_ixy(Z80 *z80, uint8_t opcode)
     POP qq (0xC1, 0xD1, 0xE1, 0xF1):
     Pop qq from the stack, and increment SP by two.
 */
-static uint8_t z80_inst_pop_qq(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_pop_qq(Z80 *z80, uint8_t opcode)
 {
     *extract_pair_qq(z80, opcode) = stack_pop(z80);
     z80->regs.pc++;
@@ -430,6 +422,7 @@ static uint8_t z80_inst_ex_de_hl(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_ex_af_af(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
+    update_flags(z80);
     uint16_t temp = z80->regs.af;
     z80->regs.af = z80->regs.af_;
     z80->regs.af_ = temp;
@@ -612,7 +605,7 @@ static uint8_t z80_inst_cpdr(Z80 *z80, uint8_t opcode)
     ADD A, r (0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x87):
     Add r (8-bit register) to A.
 */
-static uint8_t z80_inst_add_a_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_add_a_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = *extract_reg(z80, opcode << 3);
 
@@ -629,7 +622,7 @@ static uint8_t z80_inst_add_a_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_add_a_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t value = read_operand(z80, ++z80->regs.pc);
 
     set_flags_add8(z80, value);
     z80->regs.a += value;
@@ -672,7 +665,7 @@ static uint8_t z80_inst_add_a_ixy(Z80 *z80, uint8_t opcode)
     ADC A, r (0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8F):
     Add r (8-bit register) plus the carry flag to A.
 */
-static uint8_t z80_inst_adc_a_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_adc_a_r(Z80 *z80, uint8_t opcode)
 {
     uint16_t value = *extract_reg(z80, opcode << 3);
     value += get_flag(z80, FLAG_CARRY);
@@ -690,7 +683,7 @@ static uint8_t z80_inst_adc_a_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_adc_a_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint16_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint16_t value = read_operand(z80, ++z80->regs.pc);
     value += get_flag(z80, FLAG_CARRY);
 
     set_flags_add8(z80, value);
@@ -736,7 +729,7 @@ static uint8_t z80_inst_adc_a_ixy(Z80 *z80, uint8_t opcode)
     SUB r (0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x97):
     Subtract r (8-bit register) from A.
 */
-static uint8_t z80_inst_sub_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_sub_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = *extract_reg(z80, opcode << 3);
 
@@ -753,7 +746,7 @@ static uint8_t z80_inst_sub_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_sub_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t value = read_operand(z80, ++z80->regs.pc);
 
     set_flags_sub8(z80, value);
     z80->regs.a -= value;
@@ -796,7 +789,7 @@ static uint8_t z80_inst_sub_ixy(Z80 *z80, uint8_t opcode)
     SBC A, r (0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9F):
     Subtract r (8-bit register) plus the carry flag from A.
 */
-static uint8_t z80_inst_sbc_a_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_sbc_a_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = *extract_reg(z80, opcode << 3);
     value += get_flag(z80, FLAG_CARRY);
@@ -814,7 +807,7 @@ static uint8_t z80_inst_sbc_a_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_sbc_a_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t value = read_operand(z80, ++z80->regs.pc);
     value += get_flag(z80, FLAG_CARRY);
 
     set_flags_sub8(z80, value);
@@ -860,7 +853,7 @@ static uint8_t z80_inst_sbc_a_ixy(Z80 *z80, uint8_t opcode)
     AND r (0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA7):
     Bitwise AND A with r (8-bit register).
 */
-static uint8_t z80_inst_and_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_and_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = *extract_reg(z80, opcode << 3);
     uint8_t res = z80->regs.a &= value;
@@ -877,7 +870,7 @@ static uint8_t z80_inst_and_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_and_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t value = read_operand(z80, ++z80->regs.pc);
     uint8_t res = z80->regs.a &= value;
 
     set_flags_bitwise(z80, res, true);
@@ -920,7 +913,7 @@ static uint8_t z80_inst_and_ixy(Z80 *z80, uint8_t opcode)
     OR r (0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB7):
     Bitwise OR A with r (8-bit register).
 */
-static uint8_t z80_inst_or_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_or_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = *extract_reg(z80, opcode << 3);
     uint8_t res = z80->regs.a |= value;
@@ -937,7 +930,7 @@ static uint8_t z80_inst_or_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_or_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t value = read_operand(z80, ++z80->regs.pc);
     uint8_t res = z80->regs.a |= value;
 
     set_flags_bitwise(z80, res, false);
@@ -980,7 +973,7 @@ static uint8_t z80_inst_or_ixy(Z80 *z80, uint8_t opcode)
     XOR r (0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAF):
     Bitwise XOR A with r (8-bit register).
 */
-static uint8_t z80_inst_xor_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_xor_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = *extract_reg(z80, opcode << 3);
     uint8_t res = z80->regs.a ^= value;
@@ -997,7 +990,7 @@ static uint8_t z80_inst_xor_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_xor_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t value = read_operand(z80, ++z80->regs.pc);
     uint8_t res = z80->regs.a ^= value;
 
     set_flags_bitwise(z80, res, false);
@@ -1040,7 +1033,7 @@ static uint8_t z80_inst_xor_ixy(Z80 *z80, uint8_t opcode)
     CP r (0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBF):
     Set flags as if r (8-bit register) had been subtracted from A.
 */
-static uint8_t z80_inst_cp_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_cp_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = *extract_reg(z80, opcode << 3);
 
@@ -1056,7 +1049,7 @@ static uint8_t z80_inst_cp_r(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_cp_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t value = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t value = read_operand(z80, ++z80->regs.pc);
 
     set_flags_cp(z80, value);
     z80->regs.pc++;
@@ -1096,7 +1089,7 @@ static uint8_t z80_inst_cp_ixy(Z80 *z80, uint8_t opcode)
     INC r (0x04, 0x0C, 0x14, 0x1C, 0x24, 0x2C, 0x3C):
     Increment r (8-bit register).
 */
-static uint8_t z80_inst_inc_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_inc_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode);
 
@@ -1141,7 +1134,7 @@ static uint8_t z80_inst_inc_ixy(Z80 *z80, uint8_t opcode)
     DEC r (0x05, 0x0D, 0x15, 0x1D, 0x25, 0x2D, 0x3D):
     Decrement r (8-bit register).
 */
-static uint8_t z80_inst_dec_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_dec_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode);
 
@@ -1189,18 +1182,9 @@ static uint8_t z80_inst_dec_ixy(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_daa(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t a = z80->regs.a, adjust = 0x00;
-    bool n = get_flag(z80, FLAG_SUBTRACT);
-
-    if ((a & 0x0F) > 0x09 || get_flag(z80, FLAG_HALFCARRY))
-        adjust += 0x06;
-
-    uint8_t temp = n ? (a - adjust) : (a + adjust);
-    if ((temp >> 4) > 0x09 || get_flag(z80, FLAG_CARRY))
-        adjust += 0x60;
-
-    z80->regs.a += n ? -adjust : adjust;
-    set_flags_daa(z80, a, adjust);
+    uint8_t f = resolve_flags(z80);
+    z80->regs.af = daa_table[(f & 0x03) << 8 | (f & 0x10) << 6 | z80->regs.a];
+    z80->regs.flag_op = LAZY_NONE;
     z80->regs.pc++;
     return 4;
 }
@@ -1269,11 +1253,15 @@ static uint8_t z80_inst_nop(Z80 *z80, uint8_t opcode)
 /*
     HALT (0x76):
     Suspend CPU operation: execute NOPs until an interrupt or reset.
+
+    PC is advanced past the HALT so that the interrupt handler returns to the
+    next instruction. The NOPs themselves are handled by z80_run_until().
 */
 static uint8_t z80_inst_halt(Z80 *z80, uint8_t opcode)
 {
-    (void) z80;
     (void) opcode;
+    z80->halted = true;
+    z80->regs.pc++;
     return 4;
 }
 
@@ -1308,7 +1296,7 @@ static uint8_t z80_inst_ei(Z80 *z80, uint8_t opcode)
     IM (0xED46, 0xED4E, 0xED56, 0xED5E, 0xED66, 0xED6E, 0xED76, 0xED7E):
     Set the interrupt mode.
 */
-static uint8_t z80_inst_im(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_im(Z80 *z80, uint8_t opcode)
 {
     switch (opcode) {
         case 0x46:
@@ -1338,7 +1326,7 @@ static uint8_t z80_inst_im(Z80 *z80, uint8_t opcode)
     ADD HL, ss (0x09, 0x19, 0x29, 0x39):
     Add ss to HL.
 */
-static uint8_t z80_inst_add_hl_ss(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_add_hl_ss(Z80 *z80, uint8_t opcode)
 {
     uint16_t lh = z80->regs.hl, rh = *extract_pair(z80, opcode);
     z80->regs.hl += rh;
@@ -1352,7 +1340,7 @@ static uint8_t z80_inst_add_hl_ss(Z80 *z80, uint8_t opcode)
     ADC HL, ss (0xED4A, 0xED5A, 0xED6A, 0xED7A):
     Add ss plus the carry flag to HL.
 */
-static uint8_t z80_inst_adc_hl_ss(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_adc_hl_ss(Z80 *z80, uint8_t opcode)
 {
     uint16_t lh = z80->regs.hl;
     uint32_t rh = *extract_pair(z80, opcode) + get_flag(z80, FLAG_CARRY);
@@ -1367,7 +1355,7 @@ static uint8_t z80_inst_adc_hl_ss(Z80 *z80, uint8_t opcode)
     SBC HL, ss (0xED42, 0xED52, 0xED62, 0xED72):
     Subtract ss with carry from HL.
 */
-static uint8_t z80_inst_sbc_hl_ss(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_sbc_hl_ss(Z80 *z80, uint8_t opcode)
 {
     uint16_t lh = z80->regs.hl;
     uint32_t rh = *extract_pair(z80, opcode) + get_flag(z80, FLAG_CARRY);
@@ -1383,7 +1371,7 @@ static uint8_t z80_inst_sbc_hl_ss(Z80 *z80, uint8_t opcode)
         0xFD39):
     Add pp to IX or IY.
 */
-static uint8_t z80_inst_add_ixy_pp(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_add_ixy_pp(Z80 *z80, uint8_t opcode)
 {
     uint16_t lh = *z80->regs.ixy, rh = *extract_pair_pp(z80, opcode);
     *z80->regs.ixy += rh;
@@ -1397,7 +1385,7 @@ static uint8_t z80_inst_add_ixy_pp(Z80 *z80, uint8_t opcode)
     INC ss (0x03, 0x13, 0x23, 0x33):
     Increment ss (16-bit register).
 */
-static uint8_t z80_inst_inc_ss(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_inc_ss(Z80 *z80, uint8_t opcode)
 {
     (*extract_pair(z80, opcode))++;
     z80->regs.pc++;
@@ -1420,7 +1408,7 @@ static uint8_t z80_inst_inc_xy(Z80 *z80, uint8_t opcode)
     DEC ss (0x0B, 0x1B, 0x2B, 0x3B):
     Decrement ss (16-bit register).
 */
-static uint8_t z80_inst_dec_ss(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_dec_ss(Z80 *z80, uint8_t opcode)
 {
     (*extract_pair(z80, opcode))--;
     z80->regs.pc++;
@@ -1511,7 +1499,7 @@ static uint8_t z80_inst_rra(Z80 *z80, uint8_t opcode)
     RLC r (0xCB00, 0xCB01, 0xCB02, 0xCB03, 0xCB04, 0xCB05, 0xCB07):
     Rotate r left one bit. Bit 7 is copied to bit 0 and the carry flag.
 */
-static uint8_t z80_inst_rlc_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_rlc_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t bit = ((*reg) & 0x80) >> 7;
@@ -1551,7 +1539,7 @@ static uint8_t z80_inst_rlc_hl(Z80 *z80, uint8_t opcode)
     Rotate r left one bit. Carry flag is copied to bit 0, and bit 7 is copied
     to the carry flag.
 */
-static uint8_t z80_inst_rl_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_rl_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t carry = get_flag(z80, FLAG_CARRY);
@@ -1593,7 +1581,7 @@ static uint8_t z80_inst_rl_hl(Z80 *z80, uint8_t opcode)
     RRC r (0xCB08, 0xCB09, 0xCB0A, 0xCB0B, 0xCB0C, 0xCB0D, 0xCB0F):
     Rotate r right one bit. Bit 0 is copied to bit 7 and the carry flag.
 */
-static uint8_t z80_inst_rrc_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_rrc_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t bit = (*reg) & 0x01;
@@ -1633,7 +1621,7 @@ static uint8_t z80_inst_rrc_hl(Z80 *z80, uint8_t opcode)
     Rotate r right one bit. Carry flag is copied to bit 7, and bit 0 is copied
     to the carry flag.
 */
-static uint8_t z80_inst_rr_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_rr_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t carry = get_flag(z80, FLAG_CARRY);
@@ -1676,7 +1664,7 @@ static uint8_t z80_inst_rr_hl(Z80 *z80, uint8_t opcode)
     Shift r left one bit. 0 is copied to bit 0, and bit 7 is copied to the
     carry flag.
 */
-static uint8_t z80_inst_sla_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_sla_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t msb = ((*reg) & 0x80) >> 7;
@@ -1715,7 +1703,7 @@ static uint8_t z80_inst_sla_hl(Z80 *z80, uint8_t opcode)
     Arithmetic shift r right one bit. The previous bit 7 is copied to the new
     bit 7, and bit 0 is copied to the carry flag.
 */
-static uint8_t z80_inst_sra_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_sra_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t msb = (*reg) & 0x80, lsb = (*reg) & 0x01;
@@ -1756,7 +1744,7 @@ static uint8_t z80_inst_sra_hl(Z80 *z80, uint8_t opcode)
     Shift r left one bit. 1 is copied to bit 0, and bit 7 is copied to the
     carry flag.
 */
-static uint8_t z80_inst_sl1_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_sl1_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t msb = ((*reg) & 0x80) >> 7;
@@ -1797,7 +1785,7 @@ static uint8_t z80_inst_sl1_hl(Z80 *z80, uint8_t opcode)
     Logical shift r right one bit. 0 is copied to bit 7, and bit 0 is copied to
     the carry flag.
 */
-static uint8_t z80_inst_srl_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_srl_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t lsb = (*reg) & 0x01;
@@ -1875,7 +1863,7 @@ static uint8_t z80_inst_rrd(Z80 *z80, uint8_t opcode)
         0xCB7C, 0xCB7D, 0xCB7F):
     Test bit b of r (8-bit register).
 */
-static uint8_t z80_inst_bit_b_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_bit_b_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t val = *extract_reg(z80, opcode << 3);
     uint8_t bit = (opcode >> 3) & 0x07;
@@ -1890,7 +1878,7 @@ static uint8_t z80_inst_bit_b_r(Z80 *z80, uint8_t opcode)
         0xCB7E):
     Test bit b of (HL).
 */
-static uint8_t z80_inst_bit_b_hl(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_bit_b_hl(Z80 *z80, uint8_t opcode)
 {
     uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
     uint8_t bit = (opcode >> 3) & 0x07;
@@ -1904,7 +1892,7 @@ static uint8_t z80_inst_bit_b_hl(Z80 *z80, uint8_t opcode)
     BIT b, (IXY+d) (0xDDCB40-0xDDCB7F, 0xFDCB40-0xFDCB7F):
     Test bit b of (IX+d) or (IY+d).
 */
-static uint8_t z80_inst_bit_b_ixy(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_bit_b_ixy(Z80 *z80, uint8_t opcode)
 {
     uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
     uint8_t val = mmu_read_byte(z80->mmu, addr);
@@ -1925,7 +1913,7 @@ static uint8_t z80_inst_bit_b_ixy(Z80 *z80, uint8_t opcode)
         0xCBFC, 0xCBFD, 0xCBFF):
     Set bit b of r.
 */
-static uint8_t z80_inst_set_b_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_set_b_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t bit = (opcode >> 3) & 0x07;
@@ -1939,7 +1927,7 @@ static uint8_t z80_inst_set_b_r(Z80 *z80, uint8_t opcode)
         0xCBFE):
     Reset bit b of (HL).
 */
-static uint8_t z80_inst_set_b_hl(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_set_b_hl(Z80 *z80, uint8_t opcode)
 {
     uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
     uint8_t bit = (opcode >> 3) & 0x07;
@@ -1955,7 +1943,7 @@ static uint8_t z80_inst_set_b_hl(Z80 *z80, uint8_t opcode)
           0xFDCBEE, 0xFDCBF6, 0xFDCBFE):
     Set bit b of (IX+d) or (IY+d).
 */
-static uint8_t z80_inst_set_b_ixy(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_set_b_ixy(Z80 *z80, uint8_t opcode)
 {
     uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
     uint8_t val = mmu_read_byte(z80->mmu, addr);
@@ -1976,7 +1964,7 @@ static uint8_t z80_inst_set_b_ixy(Z80 *z80, uint8_t opcode)
         0xCBBC, 0xCBBD, 0xCBBF):
     Reset bit b of r.
 */
-static uint8_t z80_inst_res_b_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_res_b_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t *reg = extract_reg(z80, opcode << 3);
     uint8_t bit = (opcode >> 3) & 0x07;
@@ -1990,7 +1978,7 @@ static uint8_t z80_inst_res_b_r(Z80 *z80, uint8_t opcode)
         0xCBBE):
     Reset bit b of (HL).
 */
-static uint8_t z80_inst_res_b_hl(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_res_b_hl(Z80 *z80, uint8_t opcode)
 {
     uint8_t val = mmu_read_byte(z80->mmu, z80->regs.hl);
     uint8_t bit = (opcode >> 3) & 0x07;
@@ -2006,7 +1994,7 @@ static uint8_t z80_inst_res_b_hl(Z80 *z80, uint8_t opcode)
           0xFDCBBE, 0xFDCBC6, 0xFDCBCE):
     Set bit b of (IX+d) or (IY+d).
 */
-static uint8_t z80_inst_res_b_ixy(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_res_b_ixy(Z80 *z80, uint8_t opcode)
 {
     uint16_t addr = get_index_addr(z80, z80->regs.pc - 1);
     uint8_t val = mmu_read_byte(z80->mmu, addr);
@@ -2024,7 +2012,7 @@ static uint8_t z80_inst_res_b_ixy(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_jp_nn(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    z80->regs.pc = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
     return 10;
 }
 
@@ -2032,10 +2020,10 @@ static uint8_t z80_inst_jp_nn(Z80 *z80, uint8_t opcode)
     JP cc, nn (0xC2, 0xCA, 0xD2, 0xDA, 0xE2, 0xEA, 0xF2, 0xFA):
     Jump to nn (16-bit immediate) if cc (condition) is true.
 */
-static uint8_t z80_inst_jp_cc_nn(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_jp_cc_nn(Z80 *z80, uint8_t opcode)
 {
     if (extract_cond(z80, opcode))
-        z80->regs.pc = mmu_read_double(z80->mmu, ++z80->regs.pc);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
     else
         z80->regs.pc += 3;
     return 10;
@@ -2048,7 +2036,7 @@ static uint8_t z80_inst_jp_cc_nn(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_jr_e(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    int8_t jump = mmu_read_byte(z80->mmu, z80->regs.pc + 1);
+    int8_t jump = read_operand(z80, z80->regs.pc + 1);
     z80->regs.pc += jump + 2;
     return 12;
 }
@@ -2058,10 +2046,10 @@ static uint8_t z80_inst_jr_e(Z80 *z80, uint8_t opcode)
     JR cc, e (0x20, 0x28, 0x30, 0x38):
     Relative jump e (signed 8-bit immediate) bytes if cc (condition) is true.
 */
-static uint8_t z80_inst_jr_cc_e(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_jr_cc_e(Z80 *z80, uint8_t opcode)
 {
     if (extract_cond(z80, opcode - 0x20)) {
-        int8_t jump = mmu_read_byte(z80->mmu, z80->regs.pc + 1);
+        int8_t jump = read_operand(z80, z80->regs.pc + 1);
         z80->regs.pc += jump + 2;
         return 12;
     } else {
@@ -2101,7 +2089,7 @@ static uint8_t z80_inst_djnz_e(Z80 *z80, uint8_t opcode)
     (void) opcode;
     z80->regs.b--;
     if (z80->regs.b != 0) {
-        int8_t jump = mmu_read_byte(z80->mmu, z80->regs.pc + 1);
+        int8_t jump = read_operand(z80, z80->regs.pc + 1);
         z80->regs.pc += jump + 2;
         return 13;
     } else {
@@ -2118,7 +2106,7 @@ static uint8_t z80_inst_call_nn(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
     stack_push(z80, z80->regs.pc + 3);
-    z80->regs.pc = mmu_read_double(z80->mmu, ++z80->regs.pc);
+    z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
     return 17;
 }
 
@@ -2126,11 +2114,11 @@ static uint8_t z80_inst_call_nn(Z80 *z80, uint8_t opcode)
     CALL cc, nn (0xC4, 0xCC, 0xD4, 0xDC, 0xE4, 0xEC, 0xF4, 0xFC):
     Push PC+3 onto the stack and jump to nn (16-bit immediate) if cc is true.
 */
-static uint8_t z80_inst_call_cc_nn(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_call_cc_nn(Z80 *z80, uint8_t opcode)
 {
     if (extract_cond(z80, opcode)) {
         stack_push(z80, z80->regs.pc + 3);
-        z80->regs.pc = mmu_read_double(z80->mmu, ++z80->regs.pc);
+        z80->regs.pc = read_operand_double(z80, ++z80->regs.pc);
         return 17;
     } else {
         z80->regs.pc += 3;
@@ -2153,7 +2141,7 @@ static uint8_t z80_inst_ret(Z80 *z80, uint8_t opcode)
     RET cc (0xC0, 0xC8, 0xD0, 0xD8, 0xE0, 0xE8, 0xF0, 0xF8):
     Pop PC from the stack if cc is true.
 */
-static uint8_t z80_inst_ret_cc(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_ret_cc(Z80 *z80, uint8_t opcode)
 {
     if (extract_cond(z80, opcode)) {
         z80->regs.pc = stack_pop(z80);
@@ -2191,7 +2179,7 @@ static uint8_t z80_inst_retn(Z80 *z80, uint8_t opcode)
     RST p (0xC7, 0xCF, 0xD7, 0xDF, 0xE7, 0xEF, 0xF7, 0xFF):
     Push PC+1 onto the stack and jump to p (opcode & 0x38).
 */
-static uint8_t z80_inst_rst_p(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_rst_p(Z80 *z80, uint8_t opcode)
 {
     stack_push(z80, z80->regs.pc + 1);
     z80->regs.pc = opcode & 0x38;
@@ -2205,7 +2193,7 @@ static uint8_t z80_inst_rst_p(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_in_a_n(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t port = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t port = read_operand(z80, ++z80->regs.pc);
     z80->regs.a = io_port_read(z80->io, port);
     z80->regs.pc++;
     return 11;
@@ -2215,7 +2203,7 @@ static uint8_t z80_inst_in_a_n(Z80 *z80, uint8_t opcode)
     IN r, (C) (0xED40, 0xED48, 0xED50, 0xED58, 0xED60, 0xED68, 0xED70, 0xED78):
     Read a byte from port C into r, or affect flags only if 0xED70.
 */
-static uint8_t z80_inst_in_r_c(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_in_r_c(Z80 *z80, uint8_t opcode)
 {
     uint8_t data = io_port_read(z80->io, z80->regs.c);
     if (opcode != 0x70)
@@ -2293,7 +2281,7 @@ static uint8_t z80_inst_indr(Z80 *z80, uint8_t opcode)
 static uint8_t z80_inst_out_n_a(Z80 *z80, uint8_t opcode)
 {
     (void) opcode;
-    uint8_t port = mmu_read_byte(z80->mmu, ++z80->regs.pc);
+    uint8_t port = read_operand(z80, ++z80->regs.pc);
     io_port_write(z80->io, port, z80->regs.a);
     z80->regs.pc++;
     return 11;
@@ -2304,7 +2292,7 @@ static uint8_t z80_inst_out_n_a(Z80 *z80, uint8_t opcode)
         0xED79):
     Write a byte from r (8-bit reg, or 0 if 0xED71) into port C.
 */
-static uint8_t z80_inst_out_c_r(Z80 *z80, uint8_t opcode)
+static inline uint8_t z80_inst_out_c_r(Z80 *z80, uint8_t opcode)
 {
     uint8_t value = opcode != 0x71 ? *extract_reg(z80, opcode) : 0;
     io_port_write(z80->io, z80->regs.c, value);
@@ -2384,33 +2372,14 @@ static uint8_t z80_inst_nop2(Z80 *z80, uint8_t opcode)
     return 8;
 }
 
-/*
-    0xED:
-    Handle an extended instruction.
-*/
-static uint8_t z80_prefix_extended(Z80 *z80, uint8_t opcode)
-{
-    opcode = mmu_read_byte(z80->mmu, ++z80->regs.pc);
-    return (*instruction_table_extended[opcode])(z80, opcode);
-}
+#include "z80_handlers.inc.c"
 
 /*
-    0xED:
-    Handle a bit instruction.
+    Point the IXY register aliases at IX or IY, based on the index prefix.
 */
-static uint8_t z80_prefix_bits(Z80 *z80, uint8_t opcode)
+static inline void select_index_register(Z80 *z80, uint8_t prefix)
 {
-    opcode = mmu_read_byte(z80->mmu, ++z80->regs.pc);
-    return (*instruction_table_bits[opcode])(z80, opcode);
-}
-
-/*
-    0xDD, 0xFD:
-    Handle an index instruction.
-*/
-static uint8_t z80_prefix_index(Z80 *z80, uint8_t opcode)
-{
-    if (opcode == 0xDD) {
+    if (prefix == 0xDD) {
         z80->regs.ixy = &z80->regs.ix;
         z80->regs.ih  = &z80->regs.ixh;
         z80->regs.il  = &z80->regs.ixl;
@@ -2419,19 +2388,26 @@ static uint8_t z80_prefix_index(Z80 *z80, uint8_t opcode)
         z80->regs.ih  = &z80->regs.iyh;
         z80->regs.il  = &z80->regs.iyl;
     }
-
-    opcode = mmu_read_byte(z80->mmu, ++z80->regs.pc);
-    return (*instruction_table_index[opcode])(z80, opcode);
 }
 
-/*
-    0xDDCB, 0xFDCB:
-    Handle an index-bit instruction.
-*/
-static uint8_t z80_prefix_index_bits(Z80 *z80, uint8_t opcode)
-{
-    opcode = mmu_read_byte(z80->mmu, z80->regs.pc += 2);
-    return (*instruction_table_index_bits[opcode])(z80, opcode);
-}
+typedef uint8_t (*DispatchTable[256])(Z80*, uint8_t);
+
+#define Z80_TABLE_BEGIN(table) static DispatchTable instruction_table_##table = {
+#define Z80_TABLE_END };
+#define Z80_OP(table, code, func) [code] = func##__##code,
+#define Z80_PREFIX(table, code, kind)
 
 #include "z80_tables.inc.c"
+
+#undef Z80_TABLE_BEGIN
+#undef Z80_TABLE_END
+#undef Z80_OP
+#undef Z80_PREFIX
+
+static DispatchTable *const instruction_tables[] = {
+    [TABLE_MAIN]       = &instruction_table_main,
+    [TABLE_EXTENDED]   = &instruction_table_extended,
+    [TABLE_BITS]       = &instruction_table_bits,
+    [TABLE_INDEX]      = &instruction_table_index,
+    [TABLE_INDEX_BITS] = &instruction_table_index_bits
+};
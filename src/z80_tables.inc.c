@@ -1,1297 +1,1309 @@
 /* Copyright (C) 2014-2019 Ben Kurtovic <ben.kurtovic@gmail.com>
    Released under the terms of the MIT License. See LICENSE for details. */
 
-static DispatchTable instruction_table = {
-    [0x00] = z80_inst_nop,
-    [0x01] = z80_inst_ld_dd_nn,
-    [0x02] = z80_inst_ld_bcde_a,
-    [0x03] = z80_inst_inc_ss,
-    [0x04] = z80_inst_inc_r,
-    [0x05] = z80_inst_dec_r,
-    [0x06] = z80_inst_ld_r_n,
-    [0x07] = z80_inst_rlca,
-    [0x08] = z80_inst_ex_af_af,
-    [0x09] = z80_inst_add_hl_ss,
-    [0x0A] = z80_inst_ld_a_bcde,
-    [0x0B] = z80_inst_dec_ss,
-    [0x0C] = z80_inst_inc_r,
-    [0x0D] = z80_inst_dec_r,
-    [0x0E] = z80_inst_ld_r_n,
-    [0x0F] = z80_inst_rrca,
-    [0x10] = z80_inst_djnz_e,
-    [0x11] = z80_inst_ld_dd_nn,
-    [0x12] = z80_inst_ld_bcde_a,
-    [0x13] = z80_inst_inc_ss,
-    [0x14] = z80_inst_inc_r,
-    [0x15] = z80_inst_dec_r,
-    [0x16] = z80_inst_ld_r_n,
-    [0x17] = z80_inst_rla,
-    [0x18] = z80_inst_jr_e,
-    [0x19] = z80_inst_add_hl_ss,
-    [0x1A] = z80_inst_ld_a_bcde,
-    [0x1B] = z80_inst_dec_ss,
-    [0x1C] = z80_inst_inc_r,
-    [0x1D] = z80_inst_dec_r,
-    [0x1E] = z80_inst_ld_r_n,
-    [0x1F] = z80_inst_rra,
-    [0x20] = z80_inst_jr_cc_e,
-    [0x21] = z80_inst_ld_dd_nn,
-    [0x22] = z80_inst_ld_inn_hl,
-    [0x23] = z80_inst_inc_ss,
-    [0x24] = z80_inst_inc_r,
-    [0x25] = z80_inst_dec_r,
-    [0x26] = z80_inst_ld_r_n,
-    [0x27] = z80_inst_daa,
-    [0x28] = z80_inst_jr_cc_e,
-    [0x29] = z80_inst_add_hl_ss,
-    [0x2A] = z80_inst_ld_hl_inn,
-    [0x2B] = z80_inst_dec_ss,
-    [0x2C] = z80_inst_inc_r,
-    [0x2D] = z80_inst_dec_r,
-    [0x2E] = z80_inst_ld_r_n,
-    [0x2F] = z80_inst_cpl,
-    [0x30] = z80_inst_jr_cc_e,
-    [0x31] = z80_inst_ld_dd_nn,
-    [0x32] = z80_inst_ld_nn_a,
-    [0x33] = z80_inst_inc_ss,
-    [0x34] = z80_inst_inc_hl,
-    [0x35] = z80_inst_dec_hl,
-    [0x36] = z80_inst_ld_hl_n,
-    [0x37] = z80_inst_scf,
-    [0x38] = z80_inst_jr_cc_e,
-    [0x39] = z80_inst_add_hl_ss,
-    [0x3A] = z80_inst_ld_a_nn,
-    [0x3B] = z80_inst_dec_ss,
-    [0x3C] = z80_inst_inc_r,
-    [0x3D] = z80_inst_dec_r,
-    [0x3E] = z80_inst_ld_r_n,
-    [0x3F] = z80_inst_ccf,
-    [0x40] = z80_inst_ld_r_r,
-    [0x41] = z80_inst_ld_r_r,
-    [0x42] = z80_inst_ld_r_r,
-    [0x43] = z80_inst_ld_r_r,
-    [0x44] = z80_inst_ld_r_r,
-    [0x45] = z80_inst_ld_r_r,
-    [0x46] = z80_inst_ld_r_hl,
-    [0x47] = z80_inst_ld_r_r,
-    [0x48] = z80_inst_ld_r_r,
-    [0x49] = z80_inst_ld_r_r,
-    [0x4A] = z80_inst_ld_r_r,
-    [0x4B] = z80_inst_ld_r_r,
-    [0x4C] = z80_inst_ld_r_r,
-    [0x4D] = z80_inst_ld_r_r,
-    [0x4E] = z80_inst_ld_r_hl,
-    [0x4F] = z80_inst_ld_r_r,
-    [0x50] = z80_inst_ld_r_r,
-    [0x51] = z80_inst_ld_r_r,
-    [0x52] = z80_inst_ld_r_r,
-    [0x53] = z80_inst_ld_r_r,
-    [0x54] = z80_inst_ld_r_r,
-    [0x55] = z80_inst_ld_r_r,
-    [0x56] = z80_inst_ld_r_hl,
-    [0x57] = z80_inst_ld_r_r,
-    [0x58] = z80_inst_ld_r_r,
-    [0x59] = z80_inst_ld_r_r,
-    [0x5A] = z80_inst_ld_r_r,
-    [0x5B] = z80_inst_ld_r_r,
-    [0x5C] = z80_inst_ld_r_r,
-    [0x5D] = z80_inst_ld_r_r,
-    [0x5E] = z80_inst_ld_r_hl,
-    [0x5F] = z80_inst_ld_r_r,
-    [0x60] = z80_inst_ld_r_r,
-    [0x61] = z80_inst_ld_r_r,
-    [0x62] = z80_inst_ld_r_r,
-    [0x63] = z80_inst_ld_r_r,
-    [0x64] = z80_inst_ld_r_r,
-    [0x65] = z80_inst_ld_r_r,
-    [0x66] = z80_inst_ld_r_hl,
-    [0x67] = z80_inst_ld_r_r,
-    [0x68] = z80_inst_ld_r_r,
-    [0x69] = z80_inst_ld_r_r,
-    [0x6A] = z80_inst_ld_r_r,
-    [0x6B] = z80_inst_ld_r_r,
-    [0x6C] = z80_inst_ld_r_r,
-    [0x6D] = z80_inst_ld_r_r,
-    [0x6E] = z80_inst_ld_r_hl,
-    [0x6F] = z80_inst_ld_r_r,
-    [0x70] = z80_inst_ld_hl_r,
-    [0x71] = z80_inst_ld_hl_r,
-    [0x72] = z80_inst_ld_hl_r,
-    [0x73] = z80_inst_ld_hl_r,
-    [0x74] = z80_inst_ld_hl_r,
-    [0x75] = z80_inst_ld_hl_r,
-    [0x76] = z80_inst_halt,
-    [0x77] = z80_inst_ld_hl_r,
-    [0x78] = z80_inst_ld_r_r,
-    [0x79] = z80_inst_ld_r_r,
-    [0x7A] = z80_inst_ld_r_r,
-    [0x7B] = z80_inst_ld_r_r,
-    [0x7C] = z80_inst_ld_r_r,
-    [0x7D] = z80_inst_ld_r_r,
-    [0x7E] = z80_inst_ld_r_hl,
-    [0x7F] = z80_inst_ld_r_r,
-    [0x80] = z80_inst_add_a_r,
-    [0x81] = z80_inst_add_a_r,
-    [0x82] = z80_inst_add_a_r,
-    [0x83] = z80_inst_add_a_r,
-    [0x84] = z80_inst_add_a_r,
-    [0x85] = z80_inst_add_a_r,
-    [0x86] = z80_inst_add_a_hl,
-    [0x87] = z80_inst_add_a_r,
-    [0x88] = z80_inst_adc_a_r,
-    [0x89] = z80_inst_adc_a_r,
-    [0x8A] = z80_inst_adc_a_r,
-    [0x8B] = z80_inst_adc_a_r,
-    [0x8C] = z80_inst_adc_a_r,
-    [0x8D] = z80_inst_adc_a_r,
-    [0x8E] = z80_inst_adc_a_hl,
-    [0x8F] = z80_inst_adc_a_r,
-    [0x90] = z80_inst_sub_r,
-    [0x91] = z80_inst_sub_r,
-    [0x92] = z80_inst_sub_r,
-    [0x93] = z80_inst_sub_r,
-    [0x94] = z80_inst_sub_r,
-    [0x95] = z80_inst_sub_r,
-    [0x96] = z80_inst_sub_hl,
-    [0x97] = z80_inst_sub_r,
-    [0x98] = z80_inst_sbc_a_r,
-    [0x99] = z80_inst_sbc_a_r,
-    [0x9A] = z80_inst_sbc_a_r,
-    [0x9B] = z80_inst_sbc_a_r,
-    [0x9C] = z80_inst_sbc_a_r,
-    [0x9D] = z80_inst_sbc_a_r,
-    [0x9E] = z80_inst_sbc_a_hl,
-    [0x9F] = z80_inst_sbc_a_r,
-    [0xA0] = z80_inst_and_r,
-    [0xA1] = z80_inst_and_r,
-    [0xA2] = z80_inst_and_r,
-    [0xA3] = z80_inst_and_r,
-    [0xA4] = z80_inst_and_r,
-    [0xA5] = z80_inst_and_r,
-    [0xA6] = z80_inst_and_hl,
-    [0xA7] = z80_inst_and_r,
-    [0xA8] = z80_inst_xor_r,
-    [0xA9] = z80_inst_xor_r,
-    [0xAA] = z80_inst_xor_r,
-    [0xAB] = z80_inst_xor_r,
-    [0xAC] = z80_inst_xor_r,
-    [0xAD] = z80_inst_xor_r,
-    [0xAE] = z80_inst_xor_hl,
-    [0xAF] = z80_inst_xor_r,
-    [0xB0] = z80_inst_or_r,
-    [0xB1] = z80_inst_or_r,
-    [0xB2] = z80_inst_or_r,
-    [0xB3] = z80_inst_or_r,
-    [0xB4] = z80_inst_or_r,
-    [0xB5] = z80_inst_or_r,
-    [0xB6] = z80_inst_or_hl,
-    [0xB7] = z80_inst_or_r,
-    [0xB8] = z80_inst_cp_r,
-    [0xB9] = z80_inst_cp_r,
-    [0xBA] = z80_inst_cp_r,
-    [0xBB] = z80_inst_cp_r,
-    [0xBC] = z80_inst_cp_r,
-    [0xBD] = z80_inst_cp_r,
-    [0xBE] = z80_inst_cp_hl,
-    [0xBF] = z80_inst_cp_r,
-    [0xC0] = z80_inst_ret_cc,
-    [0xC1] = z80_inst_pop_qq,
-    [0xC2] = z80_inst_jp_cc_nn,
-    [0xC3] = z80_inst_jp_nn,
-    [0xC4] = z80_inst_call_cc_nn,
-    [0xC5] = z80_inst_push_qq,
-    [0xC6] = z80_inst_add_a_n,
-    [0xC7] = z80_inst_rst_p,
-    [0xC8] = z80_inst_ret_cc,
-    [0xC9] = z80_inst_ret,
-    [0xCA] = z80_inst_jp_cc_nn,
-    [0xCB] = z80_prefix_bits,
-    [0xCC] = z80_inst_call_cc_nn,
-    [0xCD] = z80_inst_call_nn,
-    [0xCE] = z80_inst_adc_a_n,
-    [0xCF] = z80_inst_rst_p,
-    [0xD0] = z80_inst_ret_cc,
-    [0xD1] = z80_inst_pop_qq,
-    [0xD2] = z80_inst_jp_cc_nn,
-    [0xD3] = z80_inst_out_n_a,
-    [0xD4] = z80_inst_call_cc_nn,
-    [0xD5] = z80_inst_push_qq,
-    [0xD6] = z80_inst_sub_n,
-    [0xD7] = z80_inst_rst_p,
-    [0xD8] = z80_inst_ret_cc,
-    [0xD9] = z80_inst_exx,
-    [0xDA] = z80_inst_jp_cc_nn,
-    [0xDB] = z80_inst_in_a_n,
-    [0xDC] = z80_inst_call_cc_nn,
-    [0xDD] = z80_prefix_index,
-    [0xDE] = z80_inst_sbc_a_n,
-    [0xDF] = z80_inst_rst_p,
-    [0xE0] = z80_inst_ret_cc,
-    [0xE1] = z80_inst_pop_qq,
-    [0xE2] = z80_inst_jp_cc_nn,
-    [0xE3] = z80_inst_ex_sp_hl,
-    [0xE4] = z80_inst_call_cc_nn,
-    [0xE5] = z80_inst_push_qq,
-    [0xE6] = z80_inst_and_n,
-    [0xE7] = z80_inst_rst_p,
-    [0xE8] = z80_inst_ret_cc,
-    [0xE9] = z80_inst_jp_hl,
-    [0xEA] = z80_inst_jp_cc_nn,
-    [0xEB] = z80_inst_ex_de_hl,
-    [0xEC] = z80_inst_call_cc_nn,
-    [0xED] = z80_prefix_extended,
-    [0xEE] = z80_inst_xor_n,
-    [0xEF] = z80_inst_rst_p,
-    [0xF0] = z80_inst_ret_cc,
-    [0xF1] = z80_inst_pop_qq,
-    [0xF2] = z80_inst_jp_cc_nn,
-    [0xF3] = z80_inst_di,
-    [0xF4] = z80_inst_call_cc_nn,
-    [0xF5] = z80_inst_push_qq,
-    [0xF6] = z80_inst_or_n,
-    [0xF7] = z80_inst_rst_p,
-    [0xF8] = z80_inst_ret_cc,
-    [0xF9] = z80_inst_ld_sp_hl,
-    [0xFA] = z80_inst_jp_cc_nn,
-    [0xFB] = z80_inst_ei,
-    [0xFC] = z80_inst_call_cc_nn,
-    [0xFD] = z80_prefix_index,
-    [0xFE] = z80_inst_cp_n,
-    [0xFF] = z80_inst_rst_p
-};
+/*
+    This file contains the Z80's opcode dispatch tables. It is included by
+    z80.c once for each dispatch core, with Z80_TABLE_BEGIN, Z80_TABLE_END,
+    Z80_OP, and Z80_PREFIX defined to expand the entries into either arrays of
+    handler functions or arrays of label addresses (and the labels themselves).
 
-static DispatchTable instruction_table_extended = {
-    [0x00] = z80_inst_nop2,
-    [0x01] = z80_inst_nop2,
-    [0x02] = z80_inst_nop2,
-    [0x03] = z80_inst_nop2,
-    [0x04] = z80_inst_nop2,
-    [0x05] = z80_inst_nop2,
-    [0x06] = z80_inst_nop2,
-    [0x07] = z80_inst_nop2,
-    [0x08] = z80_inst_nop2,
-    [0x09] = z80_inst_nop2,
-    [0x0A] = z80_inst_nop2,
-    [0x0B] = z80_inst_nop2,
-    [0x0C] = z80_inst_nop2,
-    [0x0D] = z80_inst_nop2,
-    [0x0E] = z80_inst_nop2,
-    [0x0F] = z80_inst_nop2,
-    [0x10] = z80_inst_nop2,
-    [0x11] = z80_inst_nop2,
-    [0x12] = z80_inst_nop2,
-    [0x13] = z80_inst_nop2,
-    [0x14] = z80_inst_nop2,
-    [0x15] = z80_inst_nop2,
-    [0x16] = z80_inst_nop2,
-    [0x17] = z80_inst_nop2,
-    [0x18] = z80_inst_nop2,
-    [0x19] = z80_inst_nop2,
-    [0x1A] = z80_inst_nop2,
-    [0x1B] = z80_inst_nop2,
-    [0x1C] = z80_inst_nop2,
-    [0x1D] = z80_inst_nop2,
-    [0x1E] = z80_inst_nop2,
-    [0x1F] = z80_inst_nop2,
-    [0x20] = z80_inst_nop2,
-    [0x21] = z80_inst_nop2,
-    [0x22] = z80_inst_nop2,
-    [0x23] = z80_inst_nop2,
-    [0x24] = z80_inst_nop2,
-    [0x25] = z80_inst_nop2,
-    [0x26] = z80_inst_nop2,
-    [0x27] = z80_inst_nop2,
-    [0x28] = z80_inst_nop2,
-    [0x29] = z80_inst_nop2,
-    [0x2A] = z80_inst_nop2,
-    [0x2B] = z80_inst_nop2,
-    [0x2C] = z80_inst_nop2,
-    [0x2D] = z80_inst_nop2,
-    [0x2E] = z80_inst_nop2,
-    [0x2F] = z80_inst_nop2,
-    [0x30] = z80_inst_nop2,
-    [0x31] = z80_inst_nop2,
-    [0x32] = z80_inst_nop2,
-    [0x33] = z80_inst_nop2,
-    [0x34] = z80_inst_nop2,
-    [0x35] = z80_inst_nop2,
-    [0x36] = z80_inst_nop2,
-    [0x37] = z80_inst_nop2,
-    [0x38] = z80_inst_nop2,
-    [0x39] = z80_inst_nop2,
-    [0x3A] = z80_inst_nop2,
-    [0x3B] = z80_inst_nop2,
-    [0x3C] = z80_inst_nop2,
-    [0x3D] = z80_inst_nop2,
-    [0x3E] = z80_inst_nop2,
-    [0x3F] = z80_inst_nop2,
-    [0x40] = z80_inst_in_r_c,
-    [0x41] = z80_inst_out_c_r,
-    [0x42] = z80_inst_sbc_hl_ss,
-    [0x43] = z80_inst_ld_inn_dd,
-    [0x44] = z80_inst_neg,
-    [0x45] = z80_inst_retn,
-    [0x46] = z80_inst_im,
-    [0x47] = z80_inst_ld_i_a,
-    [0x48] = z80_inst_in_r_c,
-    [0x49] = z80_inst_out_c_r,
-    [0x4A] = z80_inst_adc_hl_ss,
-    [0x4B] = z80_inst_ld_dd_inn,
-    [0x4C] = z80_inst_neg,
-    [0x4D] = z80_inst_reti,
-    [0x4E] = z80_inst_im,
-    [0x4F] = z80_inst_ld_r_a,
-    [0x50] = z80_inst_in_r_c,
-    [0x51] = z80_inst_out_c_r,
-    [0x52] = z80_inst_sbc_hl_ss,
-    [0x53] = z80_inst_ld_inn_dd,
-    [0x54] = z80_inst_neg,
-    [0x55] = z80_inst_retn,
-    [0x56] = z80_inst_im,
-    [0x57] = z80_inst_ld_a_i,
-    [0x58] = z80_inst_in_r_c,
-    [0x59] = z80_inst_out_c_r,
-    [0x5A] = z80_inst_adc_hl_ss,
-    [0x5B] = z80_inst_ld_dd_inn,
-    [0x5C] = z80_inst_neg,
-    [0x5D] = z80_inst_retn,
-    [0x5E] = z80_inst_im,
-    [0x5F] = z80_inst_ld_a_r,
-    [0x60] = z80_inst_in_r_c,
-    [0x61] = z80_inst_out_c_r,
-    [0x62] = z80_inst_sbc_hl_ss,
-    [0x63] = z80_inst_ld_inn_dd,
-    [0x64] = z80_inst_neg,
-    [0x65] = z80_inst_retn,
-    [0x66] = z80_inst_im,
-    [0x67] = z80_inst_rrd,
-    [0x68] = z80_inst_in_r_c,
-    [0x69] = z80_inst_out_c_r,
-    [0x6A] = z80_inst_adc_hl_ss,
-    [0x6B] = z80_inst_ld_dd_inn,
-    [0x6C] = z80_inst_neg,
-    [0x6D] = z80_inst_retn,
-    [0x6E] = z80_inst_im,
-    [0x6F] = z80_inst_rld,
-    [0x70] = z80_inst_in_r_c,
-    [0x71] = z80_inst_out_c_r,
-    [0x72] = z80_inst_sbc_hl_ss,
-    [0x73] = z80_inst_ld_inn_dd,
-    [0x74] = z80_inst_neg,
-    [0x75] = z80_inst_retn,
-    [0x76] = z80_inst_im,
-    [0x77] = z80_inst_nop2,
-    [0x78] = z80_inst_in_r_c,
-    [0x79] = z80_inst_out_c_r,
-    [0x7A] = z80_inst_adc_hl_ss,
-    [0x7B] = z80_inst_ld_dd_inn,
-    [0x7C] = z80_inst_neg,
-    [0x7D] = z80_inst_retn,
-    [0x7E] = z80_inst_im,
-    [0x7F] = z80_inst_nop2,
-    [0x80] = z80_inst_nop2,
-    [0x81] = z80_inst_nop2,
-    [0x82] = z80_inst_nop2,
-    [0x83] = z80_inst_nop2,
-    [0x84] = z80_inst_nop2,
-    [0x85] = z80_inst_nop2,
-    [0x86] = z80_inst_nop2,
-    [0x87] = z80_inst_nop2,
-    [0x88] = z80_inst_nop2,
-    [0x89] = z80_inst_nop2,
-    [0x8A] = z80_inst_nop2,
-    [0x8B] = z80_inst_nop2,
-    [0x8C] = z80_inst_nop2,
-    [0x8D] = z80_inst_nop2,
-    [0x8E] = z80_inst_nop2,
-    [0x8F] = z80_inst_nop2,
-    [0x90] = z80_inst_nop2,
-    [0x91] = z80_inst_nop2,
-    [0x92] = z80_inst_nop2,
-    [0x93] = z80_inst_nop2,
-    [0x94] = z80_inst_nop2,
-    [0x95] = z80_inst_nop2,
-    [0x96] = z80_inst_nop2,
-    [0x97] = z80_inst_nop2,
-    [0x98] = z80_inst_nop2,
-    [0x99] = z80_inst_nop2,
-    [0x9A] = z80_inst_nop2,
-    [0x9B] = z80_inst_nop2,
-    [0x9C] = z80_inst_nop2,
-    [0x9D] = z80_inst_nop2,
-    [0x9E] = z80_inst_nop2,
-    [0x9F] = z80_inst_nop2,
-    [0xA0] = z80_inst_ldi,
-    [0xA1] = z80_inst_cpi,
-    [0xA2] = z80_inst_ini,
-    [0xA3] = z80_inst_outi,
-    [0xA4] = z80_inst_nop2,
-    [0xA5] = z80_inst_nop2,
-    [0xA6] = z80_inst_nop2,
-    [0xA7] = z80_inst_nop2,
-    [0xA8] = z80_inst_ldd,
-    [0xA9] = z80_inst_cpd,
-    [0xAA] = z80_inst_ind,
-    [0xAB] = z80_inst_outd,
-    [0xAC] = z80_inst_nop2,
-    [0xAD] = z80_inst_nop2,
-    [0xAE] = z80_inst_nop2,
-    [0xAF] = z80_inst_nop2,
-    [0xB0] = z80_inst_ldir,
-    [0xB1] = z80_inst_cpir,
-    [0xB2] = z80_inst_inir,
-    [0xB3] = z80_inst_otir,
-    [0xB4] = z80_inst_nop2,
-    [0xB5] = z80_inst_nop2,
-    [0xB6] = z80_inst_nop2,
-    [0xB7] = z80_inst_nop2,
-    [0xB8] = z80_inst_lddr,
-    [0xB9] = z80_inst_cpdr,
-    [0xBA] = z80_inst_indr,
-    [0xBB] = z80_inst_otdr,
-    [0xBC] = z80_inst_nop2,
-    [0xBD] = z80_inst_nop2,
-    [0xBE] = z80_inst_nop2,
-    [0xBF] = z80_inst_nop2,
-    [0xC0] = z80_inst_nop2,
-    [0xC1] = z80_inst_nop2,
-    [0xC2] = z80_inst_nop2,
-    [0xC3] = z80_inst_nop2,
-    [0xC4] = z80_inst_nop2,
-    [0xC5] = z80_inst_nop2,
-    [0xC6] = z80_inst_nop2,
-    [0xC7] = z80_inst_nop2,
-    [0xC8] = z80_inst_nop2,
-    [0xC9] = z80_inst_nop2,
-    [0xCA] = z80_inst_nop2,
-    [0xCB] = z80_inst_nop2,
-    [0xCC] = z80_inst_nop2,
-    [0xCD] = z80_inst_nop2,
-    [0xCE] = z80_inst_nop2,
-    [0xCF] = z80_inst_nop2,
-    [0xD0] = z80_inst_nop2,
-    [0xD1] = z80_inst_nop2,
-    [0xD2] = z80_inst_nop2,
-    [0xD3] = z80_inst_nop2,
-    [0xD4] = z80_inst_nop2,
-    [0xD5] = z80_inst_nop2,
-    [0xD6] = z80_inst_nop2,
-    [0xD7] = z80_inst_nop2,
-    [0xD8] = z80_inst_nop2,
-    [0xD9] = z80_inst_nop2,
-    [0xDA] = z80_inst_nop2,
-    [0xDB] = z80_inst_nop2,
-    [0xDC] = z80_inst_nop2,
-    [0xDD] = z80_inst_nop2,
-    [0xDE] = z80_inst_nop2,
-    [0xDF] = z80_inst_nop2,
-    [0xE0] = z80_inst_nop2,
-    [0xE1] = z80_inst_nop2,
-    [0xE2] = z80_inst_nop2,
-    [0xE3] = z80_inst_nop2,
-    [0xE4] = z80_inst_nop2,
-    [0xE5] = z80_inst_nop2,
-    [0xE6] = z80_inst_nop2,
-    [0xE7] = z80_inst_nop2,
-    [0xE8] = z80_inst_nop2,
-    [0xE9] = z80_inst_nop2,
-    [0xEA] = z80_inst_nop2,
-    [0xEB] = z80_inst_nop2,
-    [0xEC] = z80_inst_nop2,
-    [0xED] = z80_inst_nop2,
-    [0xEE] = z80_inst_nop2,
-    [0xEF] = z80_inst_nop2,
-    [0xF0] = z80_inst_nop2,
-    [0xF1] = z80_inst_nop2,
-    [0xF2] = z80_inst_nop2,
-    [0xF3] = z80_inst_nop2,
-    [0xF4] = z80_inst_nop2,
-    [0xF5] = z80_inst_nop2,
-    [0xF6] = z80_inst_nop2,
-    [0xF7] = z80_inst_nop2,
-    [0xF8] = z80_inst_nop2,
-    [0xF9] = z80_inst_nop2,
-    [0xFA] = z80_inst_nop2,
-    [0xFB] = z80_inst_nop2,
-    [0xFC] = z80_inst_nop2,
-    [0xFD] = z80_inst_nop2,
-    [0xFE] = z80_inst_nop2,
-    [0xFF] = z80_inst_nop2
-};
+    Z80_OP(table, opcode, handler) maps an opcode to an instruction handler.
+    Z80_PREFIX(table, opcode, kind) marks a prefix byte that continues decoding
+    in the <kind> table. Prefixes are resolved by decode_instruction() in
+    z80.c, which must agree with these entries.
+*/
 
-static DispatchTable instruction_table_bits = {
-    [0x00] = z80_inst_rlc_r,
-    [0x01] = z80_inst_rlc_r,
-    [0x02] = z80_inst_rlc_r,
-    [0x03] = z80_inst_rlc_r,
-    [0x04] = z80_inst_rlc_r,
-    [0x05] = z80_inst_rlc_r,
-    [0x06] = z80_inst_rlc_hl,
-    [0x07] = z80_inst_rlc_r,
-    [0x08] = z80_inst_rrc_r,
-    [0x09] = z80_inst_rrc_r,
-    [0x0A] = z80_inst_rrc_r,
-    [0x0B] = z80_inst_rrc_r,
-    [0x0C] = z80_inst_rrc_r,
-    [0x0D] = z80_inst_rrc_r,
-    [0x0E] = z80_inst_rrc_hl,
-    [0x0F] = z80_inst_rrc_r,
-    [0x10] = z80_inst_rl_r,
-    [0x11] = z80_inst_rl_r,
-    [0x12] = z80_inst_rl_r,
-    [0x13] = z80_inst_rl_r,
-    [0x14] = z80_inst_rl_r,
-    [0x15] = z80_inst_rl_r,
-    [0x16] = z80_inst_rl_hl,
-    [0x17] = z80_inst_rl_r,
-    [0x18] = z80_inst_rr_r,
-    [0x19] = z80_inst_rr_r,
-    [0x1A] = z80_inst_rr_r,
-    [0x1B] = z80_inst_rr_r,
-    [0x1C] = z80_inst_rr_r,
-    [0x1D] = z80_inst_rr_r,
-    [0x1E] = z80_inst_rr_hl,
-    [0x1F] = z80_inst_rr_r,
-    [0x20] = z80_inst_sla_r,
-    [0x21] = z80_inst_sla_r,
-    [0x22] = z80_inst_sla_r,
-    [0x23] = z80_inst_sla_r,
-    [0x24] = z80_inst_sla_r,
-    [0x25] = z80_inst_sla_r,
-    [0x26] = z80_inst_sla_hl,
-    [0x27] = z80_inst_sla_r,
-    [0x28] = z80_inst_sra_r,
-    [0x29] = z80_inst_sra_r,
-    [0x2A] = z80_inst_sra_r,
-    [0x2B] = z80_inst_sra_r,
-    [0x2C] = z80_inst_sra_r,
-    [0x2D] = z80_inst_sra_r,
-    [0x2E] = z80_inst_sra_hl,
-    [0x2F] = z80_inst_sra_r,
-    [0x30] = z80_inst_sl1_r,
-    [0x31] = z80_inst_sl1_r,
-    [0x32] = z80_inst_sl1_r,
-    [0x33] = z80_inst_sl1_r,
-    [0x34] = z80_inst_sl1_r,
-    [0x35] = z80_inst_sl1_r,
-    [0x36] = z80_inst_sl1_hl,
-    [0x37] = z80_inst_sl1_r,
-    [0x38] = z80_inst_srl_r,
-    [0x39] = z80_inst_srl_r,
-    [0x3A] = z80_inst_srl_r,
-    [0x3B] = z80_inst_srl_r,
-    [0x3C] = z80_inst_srl_r,
-    [0x3D] = z80_inst_srl_r,
-    [0x3E] = z80_inst_srl_hl,
-    [0x3F] = z80_inst_srl_r,
-    [0x40] = z80_inst_bit_b_r,
-    [0x41] = z80_inst_bit_b_r,
-    [0x42] = z80_inst_bit_b_r,
-    [0x43] = z80_inst_bit_b_r,
-    [0x44] = z80_inst_bit_b_r,
-    [0x45] = z80_inst_bit_b_r,
-    [0x46] = z80_inst_bit_b_hl,
-    [0x47] = z80_inst_bit_b_r,
-    [0x48] = z80_inst_bit_b_r,
-    [0x49] = z80_inst_bit_b_r,
-    [0x4A] = z80_inst_bit_b_r,
-    [0x4B] = z80_inst_bit_b_r,
-    [0x4C] = z80_inst_bit_b_r,
-    [0x4D] = z80_inst_bit_b_r,
-    [0x4E] = z80_inst_bit_b_hl,
-    [0x4F] = z80_inst_bit_b_r,
-    [0x50] = z80_inst_bit_b_r,
-    [0x51] = z80_inst_bit_b_r,
-    [0x52] = z80_inst_bit_b_r,
-    [0x53] = z80_inst_bit_b_r,
-    [0x54] = z80_inst_bit_b_r,
-    [0x55] = z80_inst_bit_b_r,
-    [0x56] = z80_inst_bit_b_hl,
-    [0x57] = z80_inst_bit_b_r,
-    [0x58] = z80_inst_bit_b_r,
-    [0x59] = z80_inst_bit_b_r,
-    [0x5A] = z80_inst_bit_b_r,
-    [0x5B] = z80_inst_bit_b_r,
-    [0x5C] = z80_inst_bit_b_r,
-    [0x5D] = z80_inst_bit_b_r,
-    [0x5E] = z80_inst_bit_b_hl,
-    [0x5F] = z80_inst_bit_b_r,
-    [0x60] = z80_inst_bit_b_r,
-    [0x61] = z80_inst_bit_b_r,
-    [0x62] = z80_inst_bit_b_r,
-    [0x63] = z80_inst_bit_b_r,
-    [0x64] = z80_inst_bit_b_r,
-    [0x65] = z80_inst_bit_b_r,
-    [0x66] = z80_inst_bit_b_hl,
-    [0x67] = z80_inst_bit_b_r,
-    [0x68] = z80_inst_bit_b_r,
-    [0x69] = z80_inst_bit_b_r,
-    [0x6A] = z80_inst_bit_b_r,
-    [0x6B] = z80_inst_bit_b_r,
-    [0x6C] = z80_inst_bit_b_r,
-    [0x6D] = z80_inst_bit_b_r,
-    [0x6E] = z80_inst_bit_b_hl,
-    [0x6F] = z80_inst_bit_b_r,
-    [0x70] = z80_inst_bit_b_r,
-    [0x71] = z80_inst_bit_b_r,
-    [0x72] = z80_inst_bit_b_r,
-    [0x73] = z80_inst_bit_b_r,
-    [0x74] = z80_inst_bit_b_r,
-    [0x75] = z80_inst_bit_b_r,
-    [0x76] = z80_inst_bit_b_hl,
-    [0x77] = z80_inst_bit_b_r,
-    [0x78] = z80_inst_bit_b_r,
-    [0x79] = z80_inst_bit_b_r,
-    [0x7A] = z80_inst_bit_b_r,
-    [0x7B] = z80_inst_bit_b_r,
-    [0x7C] = z80_inst_bit_b_r,
-    [0x7D] = z80_inst_bit_b_r,
-    [0x7E] = z80_inst_bit_b_hl,
-    [0x7F] = z80_inst_bit_b_r,
-    [0x80] = z80_inst_res_b_r,
-    [0x81] = z80_inst_res_b_r,
-    [0x82] = z80_inst_res_b_r,
-    [0x83] = z80_inst_res_b_r,
-    [0x84] = z80_inst_res_b_r,
-    [0x85] = z80_inst_res_b_r,
-    [0x86] = z80_inst_res_b_hl,
-    [0x87] = z80_inst_res_b_r,
-    [0x88] = z80_inst_res_b_r,
-    [0x89] = z80_inst_res_b_r,
-    [0x8A] = z80_inst_res_b_r,
-    [0x8B] = z80_inst_res_b_r,
-    [0x8C] = z80_inst_res_b_r,
-    [0x8D] = z80_inst_res_b_r,
-    [0x8E] = z80_inst_res_b_hl,
-    [0x8F] = z80_inst_res_b_r,
-    [0x90] = z80_inst_res_b_r,
-    [0x91] = z80_inst_res_b_r,
-    [0x92] = z80_inst_res_b_r,
-    [0x93] = z80_inst_res_b_r,
-    [0x94] = z80_inst_res_b_r,
-    [0x95] = z80_inst_res_b_r,
-    [0x96] = z80_inst_res_b_hl,
-    [0x97] = z80_inst_res_b_r,
-    [0x98] = z80_inst_res_b_r,
-    [0x99] = z80_inst_res_b_r,
-    [0x9A] = z80_inst_res_b_r,
-    [0x9B] = z80_inst_res_b_r,
-    [0x9C] = z80_inst_res_b_r,
-    [0x9D] = z80_inst_res_b_r,
-    [0x9E] = z80_inst_res_b_hl,
-    [0x9F] = z80_inst_res_b_r,
-    [0xA0] = z80_inst_res_b_r,
-    [0xA1] = z80_inst_res_b_r,
-    [0xA2] = z80_inst_res_b_r,
-    [0xA3] = z80_inst_res_b_r,
-    [0xA4] = z80_inst_res_b_r,
-    [0xA5] = z80_inst_res_b_r,
-    [0xA6] = z80_inst_res_b_hl,
-    [0xA7] = z80_inst_res_b_r,
-    [0xA8] = z80_inst_res_b_r,
-    [0xA9] = z80_inst_res_b_r,
-    [0xAA] = z80_inst_res_b_r,
-    [0xAB] = z80_inst_res_b_r,
-    [0xAC] = z80_inst_res_b_r,
-    [0xAD] = z80_inst_res_b_r,
-    [0xAE] = z80_inst_res_b_hl,
-    [0xAF] = z80_inst_res_b_r,
-    [0xB0] = z80_inst_res_b_r,
-    [0xB1] = z80_inst_res_b_r,
-    [0xB2] = z80_inst_res_b_r,
-    [0xB3] = z80_inst_res_b_r,
-    [0xB4] = z80_inst_res_b_r,
-    [0xB5] = z80_inst_res_b_r,
-    [0xB6] = z80_inst_res_b_hl,
-    [0xB7] = z80_inst_res_b_r,
-    [0xB8] = z80_inst_res_b_r,
-    [0xB9] = z80_inst_res_b_r,
-    [0xBA] = z80_inst_res_b_r,
-    [0xBB] = z80_inst_res_b_r,
-    [0xBC] = z80_inst_res_b_r,
-    [0xBD] = z80_inst_res_b_r,
-    [0xBE] = z80_inst_res_b_hl,
-    [0xBF] = z80_inst_res_b_r,
-    [0xC0] = z80_inst_set_b_r,
-    [0xC1] = z80_inst_set_b_r,
-    [0xC2] = z80_inst_set_b_r,
-    [0xC3] = z80_inst_set_b_r,
-    [0xC4] = z80_inst_set_b_r,
-    [0xC5] = z80_inst_set_b_r,
-    [0xC6] = z80_inst_set_b_hl,
-    [0xC7] = z80_inst_set_b_r,
-    [0xC8] = z80_inst_set_b_r,
-    [0xC9] = z80_inst_set_b_r,
-    [0xCA] = z80_inst_set_b_r,
-    [0xCB] = z80_inst_set_b_r,
-    [0xCC] = z80_inst_set_b_r,
-    [0xCD] = z80_inst_set_b_r,
-    [0xCE] = z80_inst_set_b_hl,
-    [0xCF] = z80_inst_set_b_r,
-    [0xD0] = z80_inst_set_b_r,
-    [0xD1] = z80_inst_set_b_r,
-    [0xD2] = z80_inst_set_b_r,
-    [0xD3] = z80_inst_set_b_r,
-    [0xD4] = z80_inst_set_b_r,
-    [0xD5] = z80_inst_set_b_r,
-    [0xD6] = z80_inst_set_b_hl,
-    [0xD7] = z80_inst_set_b_r,
-    [0xD8] = z80_inst_set_b_r,
-    [0xD9] = z80_inst_set_b_r,
-    [0xDA] = z80_inst_set_b_r,
-    [0xDB] = z80_inst_set_b_r,
-    [0xDC] = z80_inst_set_b_r,
-    [0xDD] = z80_inst_set_b_r,
-    [0xDE] = z80_inst_set_b_hl,
-    [0xDF] = z80_inst_set_b_r,
-    [0xE0] = z80_inst_set_b_r,
-    [0xE1] = z80_inst_set_b_r,
-    [0xE2] = z80_inst_set_b_r,
-    [0xE3] = z80_inst_set_b_r,
-    [0xE4] = z80_inst_set_b_r,
-    [0xE5] = z80_inst_set_b_r,
-    [0xE6] = z80_inst_set_b_hl,
-    [0xE7] = z80_inst_set_b_r,
-    [0xE8] = z80_inst_set_b_r,
-    [0xE9] = z80_inst_set_b_r,
-    [0xEA] = z80_inst_set_b_r,
-    [0xEB] = z80_inst_set_b_r,
-    [0xEC] = z80_inst_set_b_r,
-    [0xED] = z80_inst_set_b_r,
-    [0xEE] = z80_inst_set_b_hl,
-    [0xEF] = z80_inst_set_b_r,
-    [0xF0] = z80_inst_set_b_r,
-    [0xF1] = z80_inst_set_b_r,
-    [0xF2] = z80_inst_set_b_r,
-    [0xF3] = z80_inst_set_b_r,
-    [0xF4] = z80_inst_set_b_r,
-    [0xF5] = z80_inst_set_b_r,
-    [0xF6] = z80_inst_set_b_hl,
-    [0xF7] = z80_inst_set_b_r,
-    [0xF8] = z80_inst_set_b_r,
-    [0xF9] = z80_inst_set_b_r,
-    [0xFA] = z80_inst_set_b_r,
-    [0xFB] = z80_inst_set_b_r,
-    [0xFC] = z80_inst_set_b_r,
-    [0xFD] = z80_inst_set_b_r,
-    [0xFE] = z80_inst_set_b_hl,
-    [0xFF] = z80_inst_set_b_r
-};
+Z80_TABLE_BEGIN(main)
+    Z80_OP(main, 0x00, z80_inst_nop)
+    Z80_OP(main, 0x01, z80_inst_ld_dd_nn)
+    Z80_OP(main, 0x02, z80_inst_ld_bcde_a)
+    Z80_OP(main, 0x03, z80_inst_inc_ss)
+    Z80_OP(main, 0x04, z80_inst_inc_r)
+    Z80_OP(main, 0x05, z80_inst_dec_r)
+    Z80_OP(main, 0x06, z80_inst_ld_r_n)
+    Z80_OP(main, 0x07, z80_inst_rlca)
+    Z80_OP(main, 0x08, z80_inst_ex_af_af)
+    Z80_OP(main, 0x09, z80_inst_add_hl_ss)
+    Z80_OP(main, 0x0A, z80_inst_ld_a_bcde)
+    Z80_OP(main, 0x0B, z80_inst_dec_ss)
+    Z80_OP(main, 0x0C, z80_inst_inc_r)
+    Z80_OP(main, 0x0D, z80_inst_dec_r)
+    Z80_OP(main, 0x0E, z80_inst_ld_r_n)
+    Z80_OP(main, 0x0F, z80_inst_rrca)
+    Z80_OP(main, 0x10, z80_inst_djnz_e)
+    Z80_OP(main, 0x11, z80_inst_ld_dd_nn)
+    Z80_OP(main, 0x12, z80_inst_ld_bcde_a)
+    Z80_OP(main, 0x13, z80_inst_inc_ss)
+    Z80_OP(main, 0x14, z80_inst_inc_r)
+    Z80_OP(main, 0x15, z80_inst_dec_r)
+    Z80_OP(main, 0x16, z80_inst_ld_r_n)
+    Z80_OP(main, 0x17, z80_inst_rla)
+    Z80_OP(main, 0x18, z80_inst_jr_e)
+    Z80_OP(main, 0x19, z80_inst_add_hl_ss)
+    Z80_OP(main, 0x1A, z80_inst_ld_a_bcde)
+    Z80_OP(main, 0x1B, z80_inst_dec_ss)
+    Z80_OP(main, 0x1C, z80_inst_inc_r)
+    Z80_OP(main, 0x1D, z80_inst_dec_r)
+    Z80_OP(main, 0x1E, z80_inst_ld_r_n)
+    Z80_OP(main, 0x1F, z80_inst_rra)
+    Z80_OP(main, 0x20, z80_inst_jr_cc_e)
+    Z80_OP(main, 0x21, z80_inst_ld_dd_nn)
+    Z80_OP(main, 0x22, z80_inst_ld_inn_hl)
+    Z80_OP(main, 0x23, z80_inst_inc_ss)
+    Z80_OP(main, 0x24, z80_inst_inc_r)
+    Z80_OP(main, 0x25, z80_inst_dec_r)
+    Z80_OP(main, 0x26, z80_inst_ld_r_n)
+    Z80_OP(main, 0x27, z80_inst_daa)
+    Z80_OP(main, 0x28, z80_inst_jr_cc_e)
+    Z80_OP(main, 0x29, z80_inst_add_hl_ss)
+    Z80_OP(main, 0x2A, z80_inst_ld_hl_inn)
+    Z80_OP(main, 0x2B, z80_inst_dec_ss)
+    Z80_OP(main, 0x2C, z80_inst_inc_r)
+    Z80_OP(main, 0x2D, z80_inst_dec_r)
+    Z80_OP(main, 0x2E, z80_inst_ld_r_n)
+    Z80_OP(main, 0x2F, z80_inst_cpl)
+    Z80_OP(main, 0x30, z80_inst_jr_cc_e)
+    Z80_OP(main, 0x31, z80_inst_ld_dd_nn)
+    Z80_OP(main, 0x32, z80_inst_ld_nn_a)
+    Z80_OP(main, 0x33, z80_inst_inc_ss)
+    Z80_OP(main, 0x34, z80_inst_inc_hl)
+    Z80_OP(main, 0x35, z80_inst_dec_hl)
+    Z80_OP(main, 0x36, z80_inst_ld_hl_n)
+    Z80_OP(main, 0x37, z80_inst_scf)
+    Z80_OP(main, 0x38, z80_inst_jr_cc_e)
+    Z80_OP(main, 0x39, z80_inst_add_hl_ss)
+    Z80_OP(main, 0x3A, z80_inst_ld_a_nn)
+    Z80_OP(main, 0x3B, z80_inst_dec_ss)
+    Z80_OP(main, 0x3C, z80_inst_inc_r)
+    Z80_OP(main, 0x3D, z80_inst_dec_r)
+    Z80_OP(main, 0x3E, z80_inst_ld_r_n)
+    Z80_OP(main, 0x3F, z80_inst_ccf)
+    Z80_OP(main, 0x40, z80_inst_ld_r_r)
+    Z80_OP(main, 0x41, z80_inst_ld_r_r)
+    Z80_OP(main, 0x42, z80_inst_ld_r_r)
+    Z80_OP(main, 0x43, z80_inst_ld_r_r)
+    Z80_OP(main, 0x44, z80_inst_ld_r_r)
+    Z80_OP(main, 0x45, z80_inst_ld_r_r)
+    Z80_OP(main, 0x46, z80_inst_ld_r_hl)
+    Z80_OP(main, 0x47, z80_inst_ld_r_r)
+    Z80_OP(main, 0x48, z80_inst_ld_r_r)
+    Z80_OP(main, 0x49, z80_inst_ld_r_r)
+    Z80_OP(main, 0x4A, z80_inst_ld_r_r)
+    Z80_OP(main, 0x4B, z80_inst_ld_r_r)
+    Z80_OP(main, 0x4C, z80_inst_ld_r_r)
+    Z80_OP(main, 0x4D, z80_inst_ld_r_r)
+    Z80_OP(main, 0x4E, z80_inst_ld_r_hl)
+    Z80_OP(main, 0x4F, z80_inst_ld_r_r)
+    Z80_OP(main, 0x50, z80_inst_ld_r_r)
+    Z80_OP(main, 0x51, z80_inst_ld_r_r)
+    Z80_OP(main, 0x52, z80_inst_ld_r_r)
+    Z80_OP(main, 0x53, z80_inst_ld_r_r)
+    Z80_OP(main, 0x54, z80_inst_ld_r_r)
+    Z80_OP(main, 0x55, z80_inst_ld_r_r)
+    Z80_OP(main, 0x56, z80_inst_ld_r_hl)
+    Z80_OP(main, 0x57, z80_inst_ld_r_r)
+    Z80_OP(main, 0x58, z80_inst_ld_r_r)
+    Z80_OP(main, 0x59, z80_inst_ld_r_r)
+    Z80_OP(main, 0x5A, z80_inst_ld_r_r)
+    Z80_OP(main, 0x5B, z80_inst_ld_r_r)
+    Z80_OP(main, 0x5C, z80_inst_ld_r_r)
+    Z80_OP(main, 0x5D, z80_inst_ld_r_r)
+    Z80_OP(main, 0x5E, z80_inst_ld_r_hl)
+    Z80_OP(main, 0x5F, z80_inst_ld_r_r)
+    Z80_OP(main, 0x60, z80_inst_ld_r_r)
+    Z80_OP(main, 0x61, z80_inst_ld_r_r)
+    Z80_OP(main, 0x62, z80_inst_ld_r_r)
+    Z80_OP(main, 0x63, z80_inst_ld_r_r)
+    Z80_OP(main, 0x64, z80_inst_ld_r_r)
+    Z80_OP(main, 0x65, z80_inst_ld_r_r)
+    Z80_OP(main, 0x66, z80_inst_ld_r_hl)
+    Z80_OP(main, 0x67, z80_inst_ld_r_r)
+    Z80_OP(main, 0x68, z80_inst_ld_r_r)
+    Z80_OP(main, 0x69, z80_inst_ld_r_r)
+    Z80_OP(main, 0x6A, z80_inst_ld_r_r)
+    Z80_OP(main, 0x6B, z80_inst_ld_r_r)
+    Z80_OP(main, 0x6C, z80_inst_ld_r_r)
+    Z80_OP(main, 0x6D, z80_inst_ld_r_r)
+    Z80_OP(main, 0x6E, z80_inst_ld_r_hl)
+    Z80_OP(main, 0x6F, z80_inst_ld_r_r)
+    Z80_OP(main, 0x70, z80_inst_ld_hl_r)
+    Z80_OP(main, 0x71, z80_inst_ld_hl_r)
+    Z80_OP(main, 0x72, z80_inst_ld_hl_r)
+    Z80_OP(main, 0x73, z80_inst_ld_hl_r)
+    Z80_OP(main, 0x74, z80_inst_ld_hl_r)
+    Z80_OP(main, 0x75, z80_inst_ld_hl_r)
+    Z80_OP(main, 0x76, z80_inst_halt)
+    Z80_OP(main, 0x77, z80_inst_ld_hl_r)
+    Z80_OP(main, 0x78, z80_inst_ld_r_r)
+    Z80_OP(main, 0x79, z80_inst_ld_r_r)
+    Z80_OP(main, 0x7A, z80_inst_ld_r_r)
+    Z80_OP(main, 0x7B, z80_inst_ld_r_r)
+    Z80_OP(main, 0x7C, z80_inst_ld_r_r)
+    Z80_OP(main, 0x7D, z80_inst_ld_r_r)
+    Z80_OP(main, 0x7E, z80_inst_ld_r_hl)
+    Z80_OP(main, 0x7F, z80_inst_ld_r_r)
+    Z80_OP(main, 0x80, z80_inst_add_a_r)
+    Z80_OP(main, 0x81, z80_inst_add_a_r)
+    Z80_OP(main, 0x82, z80_inst_add_a_r)
+    Z80_OP(main, 0x83, z80_inst_add_a_r)
+    Z80_OP(main, 0x84, z80_inst_add_a_r)
+    Z80_OP(main, 0x85, z80_inst_add_a_r)
+    Z80_OP(main, 0x86, z80_inst_add_a_hl)
+    Z80_OP(main, 0x87, z80_inst_add_a_r)
+    Z80_OP(main, 0x88, z80_inst_adc_a_r)
+    Z80_OP(main, 0x89, z80_inst_adc_a_r)
+    Z80_OP(main, 0x8A, z80_inst_adc_a_r)
+    Z80_OP(main, 0x8B, z80_inst_adc_a_r)
+    Z80_OP(main, 0x8C, z80_inst_adc_a_r)
+    Z80_OP(main, 0x8D, z80_inst_adc_a_r)
+    Z80_OP(main, 0x8E, z80_inst_adc_a_hl)
+    Z80_OP(main, 0x8F, z80_inst_adc_a_r)
+    Z80_OP(main, 0x90, z80_inst_sub_r)
+    Z80_OP(main, 0x91, z80_inst_sub_r)
+    Z80_OP(main, 0x92, z80_inst_sub_r)
+    Z80_OP(main, 0x93, z80_inst_sub_r)
+    Z80_OP(main, 0x94, z80_inst_sub_r)
+    Z80_OP(main, 0x95, z80_inst_sub_r)
+    Z80_OP(main, 0x96, z80_inst_sub_hl)
+    Z80_OP(main, 0x97, z80_inst_sub_r)
+    Z80_OP(main, 0x98, z80_inst_sbc_a_r)
+    Z80_OP(main, 0x99, z80_inst_sbc_a_r)
+    Z80_OP(main, 0x9A, z80_inst_sbc_a_r)
+    Z80_OP(main, 0x9B, z80_inst_sbc_a_r)
+    Z80_OP(main, 0x9C, z80_inst_sbc_a_r)
+    Z80_OP(main, 0x9D, z80_inst_sbc_a_r)
+    Z80_OP(main, 0x9E, z80_inst_sbc_a_hl)
+    Z80_OP(main, 0x9F, z80_inst_sbc_a_r)
+    Z80_OP(main, 0xA0, z80_inst_and_r)
+    Z80_OP(main, 0xA1, z80_inst_and_r)
+    Z80_OP(main, 0xA2, z80_inst_and_r)
+    Z80_OP(main, 0xA3, z80_inst_and_r)
+    Z80_OP(main, 0xA4, z80_inst_and_r)
+    Z80_OP(main, 0xA5, z80_inst_and_r)
+    Z80_OP(main, 0xA6, z80_inst_and_hl)
+    Z80_OP(main, 0xA7, z80_inst_and_r)
+    Z80_OP(main, 0xA8, z80_inst_xor_r)
+    Z80_OP(main, 0xA9, z80_inst_xor_r)
+    Z80_OP(main, 0xAA, z80_inst_xor_r)
+    Z80_OP(main, 0xAB, z80_inst_xor_r)
+    Z80_OP(main, 0xAC, z80_inst_xor_r)
+    Z80_OP(main, 0xAD, z80_inst_xor_r)
+    Z80_OP(main, 0xAE, z80_inst_xor_hl)
+    Z80_OP(main, 0xAF, z80_inst_xor_r)
+    Z80_OP(main, 0xB0, z80_inst_or_r)
+    Z80_OP(main, 0xB1, z80_inst_or_r)
+    Z80_OP(main, 0xB2, z80_inst_or_r)
+    Z80_OP(main, 0xB3, z80_inst_or_r)
+    Z80_OP(main, 0xB4, z80_inst_or_r)
+    Z80_OP(main, 0xB5, z80_inst_or_r)
+    Z80_OP(main, 0xB6, z80_inst_or_hl)
+    Z80_OP(main, 0xB7, z80_inst_or_r)
+    Z80_OP(main, 0xB8, z80_inst_cp_r)
+    Z80_OP(main, 0xB9, z80_inst_cp_r)
+    Z80_OP(main, 0xBA, z80_inst_cp_r)
+    Z80_OP(main, 0xBB, z80_inst_cp_r)
+    Z80_OP(main, 0xBC, z80_inst_cp_r)
+    Z80_OP(main, 0xBD, z80_inst_cp_r)
+    Z80_OP(main, 0xBE, z80_inst_cp_hl)
+    Z80_OP(main, 0xBF, z80_inst_cp_r)
+    Z80_OP(main, 0xC0, z80_inst_ret_cc)
+    Z80_OP(main, 0xC1, z80_inst_pop_qq)
+    Z80_OP(main, 0xC2, z80_inst_jp_cc_nn)
+    Z80_OP(main, 0xC3, z80_inst_jp_nn)
+    Z80_OP(main, 0xC4, z80_inst_call_cc_nn)
+    Z80_OP(main, 0xC5, z80_inst_push_qq)
+    Z80_OP(main, 0xC6, z80_inst_add_a_n)
+    Z80_OP(main, 0xC7, z80_inst_rst_p)
+    Z80_OP(main, 0xC8, z80_inst_ret_cc)
+    Z80_OP(main, 0xC9, z80_inst_ret)
+    Z80_OP(main, 0xCA, z80_inst_jp_cc_nn)
+    Z80_PREFIX(main, 0xCB, bits)
+    Z80_OP(main, 0xCC, z80_inst_call_cc_nn)
+    Z80_OP(main, 0xCD, z80_inst_call_nn)
+    Z80_OP(main, 0xCE, z80_inst_adc_a_n)
+    Z80_OP(main, 0xCF, z80_inst_rst_p)
+    Z80_OP(main, 0xD0, z80_inst_ret_cc)
+    Z80_OP(main, 0xD1, z80_inst_pop_qq)
+    Z80_OP(main, 0xD2, z80_inst_jp_cc_nn)
+    Z80_OP(main, 0xD3, z80_inst_out_n_a)
+    Z80_OP(main, 0xD4, z80_inst_call_cc_nn)
+    Z80_OP(main, 0xD5, z80_inst_push_qq)
+    Z80_OP(main, 0xD6, z80_inst_sub_n)
+    Z80_OP(main, 0xD7, z80_inst_rst_p)
+    Z80_OP(main, 0xD8, z80_inst_ret_cc)
+    Z80_OP(main, 0xD9, z80_inst_exx)
+    Z80_OP(main, 0xDA, z80_inst_jp_cc_nn)
+    Z80_OP(main, 0xDB, z80_inst_in_a_n)
+    Z80_OP(main, 0xDC, z80_inst_call_cc_nn)
+    Z80_PREFIX(main, 0xDD, index)
+    Z80_OP(main, 0xDE, z80_inst_sbc_a_n)
+    Z80_OP(main, 0xDF, z80_inst_rst_p)
+    Z80_OP(main, 0xE0, z80_inst_ret_cc)
+    Z80_OP(main, 0xE1, z80_inst_pop_qq)
+    Z80_OP(main, 0xE2, z80_inst_jp_cc_nn)
+    Z80_OP(main, 0xE3, z80_inst_ex_sp_hl)
+    Z80_OP(main, 0xE4, z80_inst_call_cc_nn)
+    Z80_OP(main, 0xE5, z80_inst_push_qq)
+    Z80_OP(main, 0xE6, z80_inst_and_n)
+    Z80_OP(main, 0xE7, z80_inst_rst_p)
+    Z80_OP(main, 0xE8, z80_inst_ret_cc)
+    Z80_OP(main, 0xE9, z80_inst_jp_hl)
+    Z80_OP(main, 0xEA, z80_inst_jp_cc_nn)
+    Z80_OP(main, 0xEB, z80_inst_ex_de_hl)
+    Z80_OP(main, 0xEC, z80_inst_call_cc_nn)
+    Z80_PREFIX(main, 0xED, extended)
+    Z80_OP(main, 0xEE, z80_inst_xor_n)
+    Z80_OP(main, 0xEF, z80_inst_rst_p)
+    Z80_OP(main, 0xF0, z80_inst_ret_cc)
+    Z80_OP(main, 0xF1, z80_inst_pop_qq)
+    Z80_OP(main, 0xF2, z80_inst_jp_cc_nn)
+    Z80_OP(main, 0xF3, z80_inst_di)
+    Z80_OP(main, 0xF4, z80_inst_call_cc_nn)
+    Z80_OP(main, 0xF5, z80_inst_push_qq)
+    Z80_OP(main, 0xF6, z80_inst_or_n)
+    Z80_OP(main, 0xF7, z80_inst_rst_p)
+    Z80_OP(main, 0xF8, z80_inst_ret_cc)
+    Z80_OP(main, 0xF9, z80_inst_ld_sp_hl)
+    Z80_OP(main, 0xFA, z80_inst_jp_cc_nn)
+    Z80_OP(main, 0xFB, z80_inst_ei)
+    Z80_OP(main, 0xFC, z80_inst_call_cc_nn)
+    Z80_PREFIX(main, 0xFD, index)
+    Z80_OP(main, 0xFE, z80_inst_cp_n)
+    Z80_OP(main, 0xFF, z80_inst_rst_p)
+Z80_TABLE_END
 
-static DispatchTable instruction_table_index = {
-    [0x00] = z80_inst_nop2,
-    [0x01] = z80_inst_nop2,
-    [0x02] = z80_inst_nop2,
-    [0x03] = z80_inst_nop2,
-    [0x04] = z80_inst_nop2,
-    [0x05] = z80_inst_nop2,
-    [0x06] = z80_inst_nop2,
-    [0x07] = z80_inst_nop2,
-    [0x08] = z80_inst_nop2,
-    [0x09] = z80_inst_add_ixy_pp,
-    [0x0A] = z80_inst_nop2,
-    [0x0B] = z80_inst_nop2,
-    [0x0C] = z80_inst_nop2,
-    [0x0D] = z80_inst_nop2,
-    [0x0E] = z80_inst_nop2,
-    [0x0F] = z80_inst_nop2,
-    [0x10] = z80_inst_nop2,
-    [0x11] = z80_inst_nop2,
-    [0x12] = z80_inst_nop2,
-    [0x13] = z80_inst_nop2,
-    [0x14] = z80_inst_nop2,
-    [0x15] = z80_inst_nop2,
-    [0x16] = z80_inst_nop2,
-    [0x17] = z80_inst_nop2,
-    [0x18] = z80_inst_nop2,
-    [0x19] = z80_inst_add_ixy_pp,
-    [0x1A] = z80_inst_nop2,
-    [0x1B] = z80_inst_nop2,
-    [0x1C] = z80_inst_nop2,
-    [0x1D] = z80_inst_nop2,
-    [0x1E] = z80_inst_nop2,
-    [0x1F] = z80_inst_nop2,
-    [0x20] = z80_inst_nop2,
-    [0x21] = z80_inst_ld_ixy_nn,
-    [0x22] = z80_inst_ld_inn_ixy,
-    [0x23] = z80_inst_inc_xy,
-    [0x24] = z80_inst_unimplemented,  // TODO
-    [0x25] = z80_inst_unimplemented,  // TODO
-    [0x26] = z80_inst_unimplemented,  // TODO
-    [0x27] = z80_inst_nop2,
-    [0x28] = z80_inst_nop2,
-    [0x29] = z80_inst_add_ixy_pp,
-    [0x2A] = z80_inst_ld_ixy_inn,
-    [0x2B] = z80_inst_dec_xy,
-    [0x2C] = z80_inst_unimplemented,  // TODO
-    [0x2D] = z80_inst_unimplemented,  // TODO
-    [0x2E] = z80_inst_unimplemented,  // TODO
-    [0x2F] = z80_inst_nop2,
-    [0x30] = z80_inst_nop2,
-    [0x31] = z80_inst_nop2,
-    [0x32] = z80_inst_nop2,
-    [0x33] = z80_inst_nop2,
-    [0x34] = z80_inst_inc_ixy,
-    [0x35] = z80_inst_dec_ixy,
-    [0x36] = z80_inst_ld_ixy_n,
-    [0x37] = z80_inst_nop2,
-    [0x38] = z80_inst_nop2,
-    [0x39] = z80_inst_add_ixy_pp,
-    [0x3A] = z80_inst_nop2,
-    [0x3B] = z80_inst_nop2,
-    [0x3C] = z80_inst_nop2,
-    [0x3D] = z80_inst_nop2,
-    [0x3E] = z80_inst_nop2,
-    [0x3F] = z80_inst_nop2,
-    [0x40] = z80_inst_nop2,
-    [0x41] = z80_inst_nop2,
-    [0x42] = z80_inst_nop2,
-    [0x43] = z80_inst_nop2,
-    [0x44] = z80_inst_unimplemented,  // TODO
-    [0x45] = z80_inst_unimplemented,  // TODO
-    [0x46] = z80_inst_ld_r_ixy,
-    [0x47] = z80_inst_nop2,
-    [0x48] = z80_inst_nop2,
-    [0x49] = z80_inst_nop2,
-    [0x4A] = z80_inst_nop2,
-    [0x4B] = z80_inst_nop2,
-    [0x4C] = z80_inst_unimplemented,  // TODO
-    [0x4D] = z80_inst_unimplemented,  // TODO
-    [0x4E] = z80_inst_ld_r_ixy,
-    [0x4F] = z80_inst_nop2,
-    [0x50] = z80_inst_nop2,
-    [0x51] = z80_inst_nop2,
-    [0x52] = z80_inst_nop2,
-    [0x53] = z80_inst_nop2,
-    [0x54] = z80_inst_unimplemented,  // TODO
-    [0x55] = z80_inst_unimplemented,  // TODO
-    [0x56] = z80_inst_ld_r_ixy,
-    [0x57] = z80_inst_nop2,
-    [0x58] = z80_inst_nop2,
-    [0x59] = z80_inst_nop2,
-    [0x5A] = z80_inst_nop2,
-    [0x5B] = z80_inst_nop2,
-    [0x5C] = z80_inst_unimplemented,  // TODO
-    [0x5D] = z80_inst_unimplemented,  // TODO
-    [0x5E] = z80_inst_ld_r_ixy,
-    [0x5F] = z80_inst_nop2,
-    [0x60] = z80_inst_unimplemented,  // TODO
-    [0x61] = z80_inst_unimplemented,  // TODO
-    [0x62] = z80_inst_unimplemented,  // TODO
-    [0x63] = z80_inst_unimplemented,  // TODO
-    [0x64] = z80_inst_unimplemented,  // TODO
-    [0x65] = z80_inst_unimplemented,  // TODO
-    [0x66] = z80_inst_ld_r_ixy,
-    [0x67] = z80_inst_unimplemented,  // TODO
-    [0x68] = z80_inst_unimplemented,  // TODO
-    [0x69] = z80_inst_unimplemented,  // TODO
-    [0x6A] = z80_inst_unimplemented,  // TODO
-    [0x6B] = z80_inst_unimplemented,  // TODO
-    [0x6C] = z80_inst_unimplemented,  // TODO
-    [0x6D] = z80_inst_unimplemented,  // TODO
-    [0x6E] = z80_inst_ld_r_ixy,
-    [0x6F] = z80_inst_unimplemented,  // TODO
-    [0x70] = z80_inst_ld_ixy_r,
-    [0x71] = z80_inst_ld_ixy_r,
-    [0x72] = z80_inst_ld_ixy_r,
-    [0x73] = z80_inst_ld_ixy_r,
-    [0x74] = z80_inst_ld_ixy_r,
-    [0x75] = z80_inst_ld_ixy_r,
-    [0x76] = z80_inst_nop2,
-    [0x77] = z80_inst_ld_ixy_r,
-    [0x78] = z80_inst_nop2,
-    [0x79] = z80_inst_nop2,
-    [0x7A] = z80_inst_nop2,
-    [0x7B] = z80_inst_nop2,
-    [0x7C] = z80_inst_unimplemented,  // TODO
-    [0x7D] = z80_inst_unimplemented,  // TODO
-    [0x7E] = z80_inst_ld_r_ixy,
-    [0x7F] = z80_inst_nop2,
-    [0x80] = z80_inst_nop2,
-    [0x81] = z80_inst_nop2,
-    [0x82] = z80_inst_nop2,
-    [0x83] = z80_inst_nop2,
-    [0x84] = z80_inst_unimplemented,  // TODO
-    [0x85] = z80_inst_unimplemented,  // TODO
-    [0x86] = z80_inst_add_a_ixy,
-    [0x87] = z80_inst_nop2,
-    [0x88] = z80_inst_nop2,
-    [0x89] = z80_inst_nop2,
-    [0x8A] = z80_inst_nop2,
-    [0x8B] = z80_inst_nop2,
-    [0x8C] = z80_inst_unimplemented,  // TODO
-    [0x8D] = z80_inst_unimplemented,  // TODO
-    [0x8E] = z80_inst_adc_a_ixy,
-    [0x8F] = z80_inst_nop2,
-    [0x90] = z80_inst_nop2,
-    [0x91] = z80_inst_nop2,
-    [0x92] = z80_inst_nop2,
-    [0x93] = z80_inst_nop2,
-    [0x94] = z80_inst_unimplemented,  // TODO
-    [0x95] = z80_inst_unimplemented,  // TODO
-    [0x96] = z80_inst_sub_ixy,
-    [0x97] = z80_inst_nop2,
-    [0x98] = z80_inst_nop2,
-    [0x99] = z80_inst_nop2,
-    [0x9A] = z80_inst_nop2,
-    [0x9B] = z80_inst_nop2,
-    [0x9C] = z80_inst_unimplemented,  // TODO
-    [0x9D] = z80_inst_unimplemented,  // TODO
-    [0x9E] = z80_inst_sbc_a_ixy,
-    [0x9F] = z80_inst_nop2,
-    [0xA0] = z80_inst_nop2,
-    [0xA1] = z80_inst_nop2,
-    [0xA2] = z80_inst_nop2,
-    [0xA3] = z80_inst_nop2,
-    [0xA4] = z80_inst_unimplemented,  // TODO
-    [0xA5] = z80_inst_unimplemented,  // TODO
-    [0xA6] = z80_inst_and_ixy,
-    [0xA7] = z80_inst_nop2,
-    [0xA8] = z80_inst_nop2,
-    [0xA9] = z80_inst_nop2,
-    [0xAA] = z80_inst_nop2,
-    [0xAB] = z80_inst_nop2,
-    [0xAC] = z80_inst_unimplemented,  // TODO
-    [0xAD] = z80_inst_unimplemented,  // TODO
-    [0xAE] = z80_inst_xor_ixy,
-    [0xAF] = z80_inst_nop2,
-    [0xB0] = z80_inst_nop2,
-    [0xB1] = z80_inst_nop2,
-    [0xB2] = z80_inst_nop2,
-    [0xB3] = z80_inst_nop2,
-    [0xB4] = z80_inst_unimplemented,  // TODO
-    [0xB5] = z80_inst_unimplemented,  // TODO
-    [0xB6] = z80_inst_or_ixy,
-    [0xB7] = z80_inst_nop2,
-    [0xB8] = z80_inst_nop2,
-    [0xB9] = z80_inst_nop2,
-    [0xBA] = z80_inst_nop2,
-    [0xBB] = z80_inst_nop2,
-    [0xBC] = z80_inst_unimplemented,  // TODO
-    [0xBD] = z80_inst_unimplemented,  // TODO
-    [0xBE] = z80_inst_cp_ixy,
-    [0xBF] = z80_inst_nop2,
-    [0xC0] = z80_inst_nop2,
-    [0xC1] = z80_inst_nop2,
-    [0xC2] = z80_inst_nop2,
-    [0xC3] = z80_inst_nop2,
-    [0xC4] = z80_inst_nop2,
-    [0xC5] = z80_inst_nop2,
-    [0xC6] = z80_inst_nop2,
-    [0xC7] = z80_inst_nop2,
-    [0xC8] = z80_inst_nop2,
-    [0xC9] = z80_inst_nop2,
-    [0xCA] = z80_inst_nop2,
-    [0xCB] = z80_prefix_index_bits,
-    [0xCC] = z80_inst_nop2,
-    [0xCD] = z80_inst_nop2,
-    [0xCE] = z80_inst_nop2,
-    [0xCF] = z80_inst_nop2,
-    [0xD0] = z80_inst_nop2,
-    [0xD1] = z80_inst_nop2,
-    [0xD2] = z80_inst_nop2,
-    [0xD3] = z80_inst_nop2,
-    [0xD4] = z80_inst_nop2,
-    [0xD5] = z80_inst_nop2,
-    [0xD6] = z80_inst_nop2,
-    [0xD7] = z80_inst_nop2,
-    [0xD8] = z80_inst_nop2,
-    [0xD9] = z80_inst_nop2,
-    [0xDA] = z80_inst_nop2,
-    [0xDB] = z80_inst_nop2,
-    [0xDC] = z80_inst_nop2,
-    [0xDD] = z80_inst_nop2,
-    [0xDE] = z80_inst_nop2,
-    [0xDF] = z80_inst_nop2,
-    [0xE0] = z80_inst_nop2,
-    [0xE1] = z80_inst_pop_ixy,
-    [0xE2] = z80_inst_nop2,
-    [0xE3] = z80_inst_ex_sp_ixy,
-    [0xE4] = z80_inst_nop2,
-    [0xE5] = z80_inst_push_ixy,
-    [0xE6] = z80_inst_nop2,
-    [0xE7] = z80_inst_nop2,
-    [0xE8] = z80_inst_nop2,
-    [0xE9] = z80_inst_jp_ixy,
-    [0xEA] = z80_inst_nop2,
-    [0xEB] = z80_inst_nop2,
-    [0xEC] = z80_inst_nop2,
-    [0xED] = z80_inst_nop2,
-    [0xEE] = z80_inst_nop2,
-    [0xEF] = z80_inst_nop2,
-    [0xF0] = z80_inst_nop2,
-    [0xF1] = z80_inst_nop2,
-    [0xF2] = z80_inst_nop2,
-    [0xF3] = z80_inst_nop2,
-    [0xF4] = z80_inst_nop2,
-    [0xF5] = z80_inst_nop2,
-    [0xF6] = z80_inst_nop2,
-    [0xF7] = z80_inst_nop2,
-    [0xF8] = z80_inst_nop2,
-    [0xF9] = z80_inst_ld_sp_ixy,
-    [0xFA] = z80_inst_nop2,
-    [0xFB] = z80_inst_nop2,
-    [0xFC] = z80_inst_nop2,
-    [0xFD] = z80_inst_nop2,
-    [0xFE] = z80_inst_nop2,
-    [0xFF] = z80_inst_nop2
-};
+Z80_TABLE_BEGIN(extended)
+    Z80_OP(extended, 0x00, z80_inst_nop2)
+    Z80_OP(extended, 0x01, z80_inst_nop2)
+    Z80_OP(extended, 0x02, z80_inst_nop2)
+    Z80_OP(extended, 0x03, z80_inst_nop2)
+    Z80_OP(extended, 0x04, z80_inst_nop2)
+    Z80_OP(extended, 0x05, z80_inst_nop2)
+    Z80_OP(extended, 0x06, z80_inst_nop2)
+    Z80_OP(extended, 0x07, z80_inst_nop2)
+    Z80_OP(extended, 0x08, z80_inst_nop2)
+    Z80_OP(extended, 0x09, z80_inst_nop2)
+    Z80_OP(extended, 0x0A, z80_inst_nop2)
+    Z80_OP(extended, 0x0B, z80_inst_nop2)
+    Z80_OP(extended, 0x0C, z80_inst_nop2)
+    Z80_OP(extended, 0x0D, z80_inst_nop2)
+    Z80_OP(extended, 0x0E, z80_inst_nop2)
+    Z80_OP(extended, 0x0F, z80_inst_nop2)
+    Z80_OP(extended, 0x10, z80_inst_nop2)
+    Z80_OP(extended, 0x11, z80_inst_nop2)
+    Z80_OP(extended, 0x12, z80_inst_nop2)
+    Z80_OP(extended, 0x13, z80_inst_nop2)
+    Z80_OP(extended, 0x14, z80_inst_nop2)
+    Z80_OP(extended, 0x15, z80_inst_nop2)
+    Z80_OP(extended, 0x16, z80_inst_nop2)
+    Z80_OP(extended, 0x17, z80_inst_nop2)
+    Z80_OP(extended, 0x18, z80_inst_nop2)
+    Z80_OP(extended, 0x19, z80_inst_nop2)
+    Z80_OP(extended, 0x1A, z80_inst_nop2)
+    Z80_OP(extended, 0x1B, z80_inst_nop2)
+    Z80_OP(extended, 0x1C, z80_inst_nop2)
+    Z80_OP(extended, 0x1D, z80_inst_nop2)
+    Z80_OP(extended, 0x1E, z80_inst_nop2)
+    Z80_OP(extended, 0x1F, z80_inst_nop2)
+    Z80_OP(extended, 0x20, z80_inst_nop2)
+    Z80_OP(extended, 0x21, z80_inst_nop2)
+    Z80_OP(extended, 0x22, z80_inst_nop2)
+    Z80_OP(extended, 0x23, z80_inst_nop2)
+    Z80_OP(extended, 0x24, z80_inst_nop2)
+    Z80_OP(extended, 0x25, z80_inst_nop2)
+    Z80_OP(extended, 0x26, z80_inst_nop2)
+    Z80_OP(extended, 0x27, z80_inst_nop2)
+    Z80_OP(extended, 0x28, z80_inst_nop2)
+    Z80_OP(extended, 0x29, z80_inst_nop2)
+    Z80_OP(extended, 0x2A, z80_inst_nop2)
+    Z80_OP(extended, 0x2B, z80_inst_nop2)
+    Z80_OP(extended, 0x2C, z80_inst_nop2)
+    Z80_OP(extended, 0x2D, z80_inst_nop2)
+    Z80_OP(extended, 0x2E, z80_inst_nop2)
+    Z80_OP(extended, 0x2F, z80_inst_nop2)
+    Z80_OP(extended, 0x30, z80_inst_nop2)
+    Z80_OP(extended, 0x31, z80_inst_nop2)
+    Z80_OP(extended, 0x32, z80_inst_nop2)
+    Z80_OP(extended, 0x33, z80_inst_nop2)
+    Z80_OP(extended, 0x34, z80_inst_nop2)
+    Z80_OP(extended, 0x35, z80_inst_nop2)
+    Z80_OP(extended, 0x36, z80_inst_nop2)
+    Z80_OP(extended, 0x37, z80_inst_nop2)
+    Z80_OP(extended, 0x38, z80_inst_nop2)
+    Z80_OP(extended, 0x39, z80_inst_nop2)
+    Z80_OP(extended, 0x3A, z80_inst_nop2)
+    Z80_OP(extended, 0x3B, z80_inst_nop2)
+    Z80_OP(extended, 0x3C, z80_inst_nop2)
+    Z80_OP(extended, 0x3D, z80_inst_nop2)
+    Z80_OP(extended, 0x3E, z80_inst_nop2)
+    Z80_OP(extended, 0x3F, z80_inst_nop2)
+    Z80_OP(extended, 0x40, z80_inst_in_r_c)
+    Z80_OP(extended, 0x41, z80_inst_out_c_r)
+    Z80_OP(extended, 0x42, z80_inst_sbc_hl_ss)
+    Z80_OP(extended, 0x43, z80_inst_ld_inn_dd)
+    Z80_OP(extended, 0x44, z80_inst_neg)
+    Z80_OP(extended, 0x45, z80_inst_retn)
+    Z80_OP(extended, 0x46, z80_inst_im)
+    Z80_OP(extended, 0x47, z80_inst_ld_i_a)
+    Z80_OP(extended, 0x48, z80_inst_in_r_c)
+    Z80_OP(extended, 0x49, z80_inst_out_c_r)
+    Z80_OP(extended, 0x4A, z80_inst_adc_hl_ss)
+    Z80_OP(extended, 0x4B, z80_inst_ld_dd_inn)
+    Z80_OP(extended, 0x4C, z80_inst_neg)
+    Z80_OP(extended, 0x4D, z80_inst_reti)
+    Z80_OP(extended, 0x4E, z80_inst_im)
+    Z80_OP(extended, 0x4F, z80_inst_ld_r_a)
+    Z80_OP(extended, 0x50, z80_inst_in_r_c)
+    Z80_OP(extended, 0x51, z80_inst_out_c_r)
+    Z80_OP(extended, 0x52, z80_inst_sbc_hl_ss)
+    Z80_OP(extended, 0x53, z80_inst_ld_inn_dd)
+    Z80_OP(extended, 0x54, z80_inst_neg)
+    Z80_OP(extended, 0x55, z80_inst_retn)
+    Z80_OP(extended, 0x56, z80_inst_im)
+    Z80_OP(extended, 0x57, z80_inst_ld_a_i)
+    Z80_OP(extended, 0x58, z80_inst_in_r_c)
+    Z80_OP(extended, 0x59, z80_inst_out_c_r)
+    Z80_OP(extended, 0x5A, z80_inst_adc_hl_ss)
+    Z80_OP(extended, 0x5B, z80_inst_ld_dd_inn)
+    Z80_OP(extended, 0x5C, z80_inst_neg)
+    Z80_OP(extended, 0x5D, z80_inst_retn)
+    Z80_OP(extended, 0x5E, z80_inst_im)
+    Z80_OP(extended, 0x5F, z80_inst_ld_a_r)
+    Z80_OP(extended, 0x60, z80_inst_in_r_c)
+    Z80_OP(extended, 0x61, z80_inst_out_c_r)
+    Z80_OP(extended, 0x62, z80_inst_sbc_hl_ss)
+    Z80_OP(extended, 0x63, z80_inst_ld_inn_dd)
+    Z80_OP(extended, 0x64, z80_inst_neg)
+    Z80_OP(extended, 0x65, z80_inst_retn)
+    Z80_OP(extended, 0x66, z80_inst_im)
+    Z80_OP(extended, 0x67, z80_inst_rrd)
+    Z80_OP(extended, 0x68, z80_inst_in_r_c)
+    Z80_OP(extended, 0x69, z80_inst_out_c_r)
+    Z80_OP(extended, 0x6A, z80_inst_adc_hl_ss)
+    Z80_OP(extended, 0x6B, z80_inst_ld_dd_inn)
+    Z80_OP(extended, 0x6C, z80_inst_neg)
+    Z80_OP(extended, 0x6D, z80_inst_retn)
+    Z80_OP(extended, 0x6E, z80_inst_im)
+    Z80_OP(extended, 0x6F, z80_inst_rld)
+    Z80_OP(extended, 0x70, z80_inst_in_r_c)
+    Z80_OP(extended, 0x71, z80_inst_out_c_r)
+    Z80_OP(extended, 0x72, z80_inst_sbc_hl_ss)
+    Z80_OP(extended, 0x73, z80_inst_ld_inn_dd)
+    Z80_OP(extended, 0x74, z80_inst_neg)
+    Z80_OP(extended, 0x75, z80_inst_retn)
+    Z80_OP(extended, 0x76, z80_inst_im)
+    Z80_OP(extended, 0x77, z80_inst_nop2)
+    Z80_OP(extended, 0x78, z80_inst_in_r_c)
+    Z80_OP(extended, 0x79, z80_inst_out_c_r)
+    Z80_OP(extended, 0x7A, z80_inst_adc_hl_ss)
+    Z80_OP(extended, 0x7B, z80_inst_ld_dd_inn)
+    Z80_OP(extended, 0x7C, z80_inst_neg)
+    Z80_OP(extended, 0x7D, z80_inst_retn)
+    Z80_OP(extended, 0x7E, z80_inst_im)
+    Z80_OP(extended, 0x7F, z80_inst_nop2)
+    Z80_OP(extended, 0x80, z80_inst_nop2)
+    Z80_OP(extended, 0x81, z80_inst_nop2)
+    Z80_OP(extended, 0x82, z80_inst_nop2)
+    Z80_OP(extended, 0x83, z80_inst_nop2)
+    Z80_OP(extended, 0x84, z80_inst_nop2)
+    Z80_OP(extended, 0x85, z80_inst_nop2)
+    Z80_OP(extended, 0x86, z80_inst_nop2)
+    Z80_OP(extended, 0x87, z80_inst_nop2)
+    Z80_OP(extended, 0x88, z80_inst_nop2)
+    Z80_OP(extended, 0x89, z80_inst_nop2)
+    Z80_OP(extended, 0x8A, z80_inst_nop2)
+    Z80_OP(extended, 0x8B, z80_inst_nop2)
+    Z80_OP(extended, 0x8C, z80_inst_nop2)
+    Z80_OP(extended, 0x8D, z80_inst_nop2)
+    Z80_OP(extended, 0x8E, z80_inst_nop2)
+    Z80_OP(extended, 0x8F, z80_inst_nop2)
+    Z80_OP(extended, 0x90, z80_inst_nop2)
+    Z80_OP(extended, 0x91, z80_inst_nop2)
+    Z80_OP(extended, 0x92, z80_inst_nop2)
+    Z80_OP(extended, 0x93, z80_inst_nop2)
+    Z80_OP(extended, 0x94, z80_inst_nop2)
+    Z80_OP(extended, 0x95, z80_inst_nop2)
+    Z80_OP(extended, 0x96, z80_inst_nop2)
+    Z80_OP(extended, 0x97, z80_inst_nop2)
+    Z80_OP(extended, 0x98, z80_inst_nop2)
+    Z80_OP(extended, 0x99, z80_inst_nop2)
+    Z80_OP(extended, 0x9A, z80_inst_nop2)
+    Z80_OP(extended, 0x9B, z80_inst_nop2)
+    Z80_OP(extended, 0x9C, z80_inst_nop2)
+    Z80_OP(extended, 0x9D, z80_inst_nop2)
+    Z80_OP(extended, 0x9E, z80_inst_nop2)
+    Z80_OP(extended, 0x9F, z80_inst_nop2)
+    Z80_OP(extended, 0xA0, z80_inst_ldi)
+    Z80_OP(extended, 0xA1, z80_inst_cpi)
+    Z80_OP(extended, 0xA2, z80_inst_ini)
+    Z80_OP(extended, 0xA3, z80_inst_outi)
+    Z80_OP(extended, 0xA4, z80_inst_nop2)
+    Z80_OP(extended, 0xA5, z80_inst_nop2)
+    Z80_OP(extended, 0xA6, z80_inst_nop2)
+    Z80_OP(extended, 0xA7, z80_inst_nop2)
+    Z80_OP(extended, 0xA8, z80_inst_ldd)
+    Z80_OP(extended, 0xA9, z80_inst_cpd)
+    Z80_OP(extended, 0xAA, z80_inst_ind)
+    Z80_OP(extended, 0xAB, z80_inst_outd)
+    Z80_OP(extended, 0xAC, z80_inst_nop2)
+    Z80_OP(extended, 0xAD, z80_inst_nop2)
+    Z80_OP(extended, 0xAE, z80_inst_nop2)
+    Z80_OP(extended, 0xAF, z80_inst_nop2)
+    Z80_OP(extended, 0xB0, z80_inst_ldir)
+    Z80_OP(extended, 0xB1, z80_inst_cpir)
+    Z80_OP(extended, 0xB2, z80_inst_inir)
+    Z80_OP(extended, 0xB3, z80_inst_otir)
+    Z80_OP(extended, 0xB4, z80_inst_nop2)
+    Z80_OP(extended, 0xB5, z80_inst_nop2)
+    Z80_OP(extended, 0xB6, z80_inst_nop2)
+    Z80_OP(extended, 0xB7, z80_inst_nop2)
+    Z80_OP(extended, 0xB8, z80_inst_lddr)
+    Z80_OP(extended, 0xB9, z80_inst_cpdr)
+    Z80_OP(extended, 0xBA, z80_inst_indr)
+    Z80_OP(extended, 0xBB, z80_inst_otdr)
+    Z80_OP(extended, 0xBC, z80_inst_nop2)
+    Z80_OP(extended, 0xBD, z80_inst_nop2)
+    Z80_OP(extended, 0xBE, z80_inst_nop2)
+    Z80_OP(extended, 0xBF, z80_inst_nop2)
+    Z80_OP(extended, 0xC0, z80_inst_nop2)
+    Z80_OP(extended, 0xC1, z80_inst_nop2)
+    Z80_OP(extended, 0xC2, z80_inst_nop2)
+    Z80_OP(extended, 0xC3, z80_inst_nop2)
+    Z80_OP(extended, 0xC4, z80_inst_nop2)
+    Z80_OP(extended, 0xC5, z80_inst_nop2)
+    Z80_OP(extended, 0xC6, z80_inst_nop2)
+    Z80_OP(extended, 0xC7, z80_inst_nop2)
+    Z80_OP(extended, 0xC8, z80_inst_nop2)
+    Z80_OP(extended, 0xC9, z80_inst_nop2)
+    Z80_OP(extended, 0xCA, z80_inst_nop2)
+    Z80_OP(extended, 0xCB, z80_inst_nop2)
+    Z80_OP(extended, 0xCC, z80_inst_nop2)
+    Z80_OP(extended, 0xCD, z80_inst_nop2)
+    Z80_OP(extended, 0xCE, z80_inst_nop2)
+    Z80_OP(extended, 0xCF, z80_inst_nop2)
+    Z80_OP(extended, 0xD0, z80_inst_nop2)
+    Z80_OP(extended, 0xD1, z80_inst_nop2)
+    Z80_OP(extended, 0xD2, z80_inst_nop2)
+    Z80_OP(extended, 0xD3, z80_inst_nop2)
+    Z80_OP(extended, 0xD4, z80_inst_nop2)
+    Z80_OP(extended, 0xD5, z80_inst_nop2)
+    Z80_OP(extended, 0xD6, z80_inst_nop2)
+    Z80_OP(extended, 0xD7, z80_inst_nop2)
+    Z80_OP(extended, 0xD8, z80_inst_nop2)
+    Z80_OP(extended, 0xD9, z80_inst_nop2)
+    Z80_OP(extended, 0xDA, z80_inst_nop2)
+    Z80_OP(extended, 0xDB, z80_inst_nop2)
+    Z80_OP(extended, 0xDC, z80_inst_nop2)
+    Z80_OP(extended, 0xDD, z80_inst_nop2)
+    Z80_OP(extended, 0xDE, z80_inst_nop2)
+    Z80_OP(extended, 0xDF, z80_inst_nop2)
+    Z80_OP(extended, 0xE0, z80_inst_nop2)
+    Z80_OP(extended, 0xE1, z80_inst_nop2)
+    Z80_OP(extended, 0xE2, z80_inst_nop2)
+    Z80_OP(extended, 0xE3, z80_inst_nop2)
+    Z80_OP(extended, 0xE4, z80_inst_nop2)
+    Z80_OP(extended, 0xE5, z80_inst_nop2)
+    Z80_OP(extended, 0xE6, z80_inst_nop2)
+    Z80_OP(extended, 0xE7, z80_inst_nop2)
+    Z80_OP(extended, 0xE8, z80_inst_nop2)
+    Z80_OP(extended, 0xE9, z80_inst_nop2)
+    Z80_OP(extended, 0xEA, z80_inst_nop2)
+    Z80_OP(extended, 0xEB, z80_inst_nop2)
+    Z80_OP(extended, 0xEC, z80_inst_nop2)
+    Z80_OP(extended, 0xED, z80_inst_nop2)
+    Z80_OP(extended, 0xEE, z80_inst_nop2)
+    Z80_OP(extended, 0xEF, z80_inst_nop2)
+    Z80_OP(extended, 0xF0, z80_inst_nop2)
+    Z80_OP(extended, 0xF1, z80_inst_nop2)
+    Z80_OP(extended, 0xF2, z80_inst_nop2)
+    Z80_OP(extended, 0xF3, z80_inst_nop2)
+    Z80_OP(extended, 0xF4, z80_inst_nop2)
+    Z80_OP(extended, 0xF5, z80_inst_nop2)
+    Z80_OP(extended, 0xF6, z80_inst_nop2)
+    Z80_OP(extended, 0xF7, z80_inst_nop2)
+    Z80_OP(extended, 0xF8, z80_inst_nop2)
+    Z80_OP(extended, 0xF9, z80_inst_nop2)
+    Z80_OP(extended, 0xFA, z80_inst_nop2)
+    Z80_OP(extended, 0xFB, z80_inst_nop2)
+    Z80_OP(extended, 0xFC, z80_inst_nop2)
+    Z80_OP(extended, 0xFD, z80_inst_nop2)
+    Z80_OP(extended, 0xFE, z80_inst_nop2)
+    Z80_OP(extended, 0xFF, z80_inst_nop2)
+Z80_TABLE_END
 
-static DispatchTable instruction_table_index_bits = {
-    [0x00] = z80_inst_unimplemented,  // TODO
-    [0x01] = z80_inst_unimplemented,  // TODO
-    [0x02] = z80_inst_unimplemented,  // TODO
-    [0x03] = z80_inst_unimplemented,  // TODO
-    [0x04] = z80_inst_unimplemented,  // TODO
-    [0x05] = z80_inst_unimplemented,  // TODO
-    [0x06] = z80_inst_unimplemented,  // TODO
-    [0x07] = z80_inst_unimplemented,  // TODO
-    [0x08] = z80_inst_unimplemented,  // TODO
-    [0x09] = z80_inst_unimplemented,  // TODO
-    [0x0A] = z80_inst_unimplemented,  // TODO
-    [0x0B] = z80_inst_unimplemented,  // TODO
-    [0x0C] = z80_inst_unimplemented,  // TODO
-    [0x0D] = z80_inst_unimplemented,  // TODO
-    [0x0E] = z80_inst_unimplemented,  // TODO
-    [0x0F] = z80_inst_unimplemented,  // TODO
-    [0x10] = z80_inst_unimplemented,  // TODO
-    [0x11] = z80_inst_unimplemented,  // TODO
-    [0x12] = z80_inst_unimplemented,  // TODO
-    [0x13] = z80_inst_unimplemented,  // TODO
-    [0x14] = z80_inst_unimplemented,  // TODO
-    [0x15] = z80_inst_unimplemented,  // TODO
-    [0x16] = z80_inst_unimplemented,  // TODO
-    [0x17] = z80_inst_unimplemented,  // TODO
-    [0x18] = z80_inst_unimplemented,  // TODO
-    [0x19] = z80_inst_unimplemented,  // TODO
-    [0x1A] = z80_inst_unimplemented,  // TODO
-    [0x1B] = z80_inst_unimplemented,  // TODO
-    [0x1C] = z80_inst_unimplemented,  // TODO
-    [0x1D] = z80_inst_unimplemented,  // TODO
-    [0x1E] = z80_inst_unimplemented,  // TODO
-    [0x1F] = z80_inst_unimplemented,  // TODO
-    [0x20] = z80_inst_unimplemented,  // TODO
-    [0x21] = z80_inst_unimplemented,  // TODO
-    [0x22] = z80_inst_unimplemented,  // TODO
-    [0x23] = z80_inst_unimplemented,  // TODO
-    [0x24] = z80_inst_unimplemented,  // TODO
-    [0x25] = z80_inst_unimplemented,  // TODO
-    [0x26] = z80_inst_unimplemented,  // TODO
-    [0x27] = z80_inst_unimplemented,  // TODO
-    [0x28] = z80_inst_unimplemented,  // TODO
-    [0x29] = z80_inst_unimplemented,  // TODO
-    [0x2A] = z80_inst_unimplemented,  // TODO
-    [0x2B] = z80_inst_unimplemented,  // TODO
-    [0x2C] = z80_inst_unimplemented,  // TODO
-    [0x2D] = z80_inst_unimplemented,  // TODO
-    [0x2E] = z80_inst_unimplemented,  // TODO
-    [0x2F] = z80_inst_unimplemented,  // TODO
-    [0x30] = z80_inst_unimplemented,  // TODO
-    [0x31] = z80_inst_unimplemented,  // TODO
-    [0x32] = z80_inst_unimplemented,  // TODO
-    [0x33] = z80_inst_unimplemented,  // TODO
-    [0x34] = z80_inst_unimplemented,  // TODO
-    [0x35] = z80_inst_unimplemented,  // TODO
-    [0x36] = z80_inst_unimplemented,  // TODO
-    [0x37] = z80_inst_unimplemented,  // TODO
-    [0x38] = z80_inst_unimplemented,  // TODO
-    [0x39] = z80_inst_unimplemented,  // TODO
-    [0x3A] = z80_inst_unimplemented,  // TODO
-    [0x3B] = z80_inst_unimplemented,  // TODO
-    [0x3C] = z80_inst_unimplemented,  // TODO
-    [0x3D] = z80_inst_unimplemented,  // TODO
-    [0x3E] = z80_inst_unimplemented,  // TODO
-    [0x3F] = z80_inst_unimplemented,  // TODO
-    [0x40] = z80_inst_bit_b_ixy,
-    [0x41] = z80_inst_bit_b_ixy,
-    [0x42] = z80_inst_bit_b_ixy,
-    [0x43] = z80_inst_bit_b_ixy,
-    [0x44] = z80_inst_bit_b_ixy,
-    [0x45] = z80_inst_bit_b_ixy,
-    [0x46] = z80_inst_bit_b_ixy,
-    [0x47] = z80_inst_bit_b_ixy,
-    [0x48] = z80_inst_bit_b_ixy,
-    [0x49] = z80_inst_bit_b_ixy,
-    [0x4A] = z80_inst_bit_b_ixy,
-    [0x4B] = z80_inst_bit_b_ixy,
-    [0x4C] = z80_inst_bit_b_ixy,
-    [0x4D] = z80_inst_bit_b_ixy,
-    [0x4E] = z80_inst_bit_b_ixy,
-    [0x4F] = z80_inst_bit_b_ixy,
-    [0x50] = z80_inst_bit_b_ixy,
-    [0x51] = z80_inst_bit_b_ixy,
-    [0x52] = z80_inst_bit_b_ixy,
-    [0x53] = z80_inst_bit_b_ixy,
-    [0x54] = z80_inst_bit_b_ixy,
-    [0x55] = z80_inst_bit_b_ixy,
-    [0x56] = z80_inst_bit_b_ixy,
-    [0x57] = z80_inst_bit_b_ixy,
-    [0x58] = z80_inst_bit_b_ixy,
-    [0x59] = z80_inst_bit_b_ixy,
-    [0x5A] = z80_inst_bit_b_ixy,
-    [0x5B] = z80_inst_bit_b_ixy,
-    [0x5C] = z80_inst_bit_b_ixy,
-    [0x5D] = z80_inst_bit_b_ixy,
-    [0x5E] = z80_inst_bit_b_ixy,
-    [0x5F] = z80_inst_bit_b_ixy,
-    [0x60] = z80_inst_bit_b_ixy,
-    [0x61] = z80_inst_bit_b_ixy,
-    [0x62] = z80_inst_bit_b_ixy,
-    [0x63] = z80_inst_bit_b_ixy,
-    [0x64] = z80_inst_bit_b_ixy,
-    [0x65] = z80_inst_bit_b_ixy,
-    [0x66] = z80_inst_bit_b_ixy,
-    [0x67] = z80_inst_bit_b_ixy,
-    [0x68] = z80_inst_bit_b_ixy,
-    [0x69] = z80_inst_bit_b_ixy,
-    [0x6A] = z80_inst_bit_b_ixy,
-    [0x6B] = z80_inst_bit_b_ixy,
-    [0x6C] = z80_inst_bit_b_ixy,
-    [0x6D] = z80_inst_bit_b_ixy,
-    [0x6E] = z80_inst_bit_b_ixy,
-    [0x6F] = z80_inst_bit_b_ixy,
-    [0x70] = z80_inst_bit_b_ixy,
-    [0x71] = z80_inst_bit_b_ixy,
-    [0x72] = z80_inst_bit_b_ixy,
-    [0x73] = z80_inst_bit_b_ixy,
-    [0x74] = z80_inst_bit_b_ixy,
-    [0x75] = z80_inst_bit_b_ixy,
-    [0x76] = z80_inst_bit_b_ixy,
-    [0x77] = z80_inst_bit_b_ixy,
-    [0x78] = z80_inst_bit_b_ixy,
-    [0x79] = z80_inst_bit_b_ixy,
-    [0x7A] = z80_inst_bit_b_ixy,
-    [0x7B] = z80_inst_bit_b_ixy,
-    [0x7C] = z80_inst_bit_b_ixy,
-    [0x7D] = z80_inst_bit_b_ixy,
-    [0x7E] = z80_inst_bit_b_ixy,
-    [0x7F] = z80_inst_bit_b_ixy,
-    [0x80] = z80_inst_unimplemented,  // TODO
-    [0x81] = z80_inst_unimplemented,  // TODO
-    [0x82] = z80_inst_unimplemented,  // TODO
-    [0x83] = z80_inst_unimplemented,  // TODO
-    [0x84] = z80_inst_unimplemented,  // TODO
-    [0x85] = z80_inst_unimplemented,  // TODO
-    [0x86] = z80_inst_res_b_ixy,
-    [0x87] = z80_inst_unimplemented,  // TODO
-    [0x88] = z80_inst_unimplemented,  // TODO
-    [0x89] = z80_inst_unimplemented,  // TODO
-    [0x8A] = z80_inst_unimplemented,  // TODO
-    [0x8B] = z80_inst_unimplemented,  // TODO
-    [0x8C] = z80_inst_unimplemented,  // TODO
-    [0x8D] = z80_inst_unimplemented,  // TODO
-    [0x8E] = z80_inst_res_b_ixy,
-    [0x8F] = z80_inst_unimplemented,  // TODO
-    [0x90] = z80_inst_unimplemented,  // TODO
-    [0x91] = z80_inst_unimplemented,  // TODO
-    [0x92] = z80_inst_unimplemented,  // TODO
-    [0x93] = z80_inst_unimplemented,  // TODO
-    [0x94] = z80_inst_unimplemented,  // TODO
-    [0x95] = z80_inst_unimplemented,  // TODO
-    [0x96] = z80_inst_res_b_ixy,
-    [0x97] = z80_inst_unimplemented,  // TODO
-    [0x98] = z80_inst_unimplemented,  // TODO
-    [0x99] = z80_inst_unimplemented,  // TODO
-    [0x9A] = z80_inst_unimplemented,  // TODO
-    [0x9B] = z80_inst_unimplemented,  // TODO
-    [0x9C] = z80_inst_unimplemented,  // TODO
-    [0x9D] = z80_inst_unimplemented,  // TODO
-    [0x9E] = z80_inst_res_b_ixy,
-    [0x9F] = z80_inst_unimplemented,  // TODO
-    [0xA0] = z80_inst_unimplemented,  // TODO
-    [0xA1] = z80_inst_unimplemented,  // TODO
-    [0xA2] = z80_inst_unimplemented,  // TODO
-    [0xA3] = z80_inst_unimplemented,  // TODO
-    [0xA4] = z80_inst_unimplemented,  // TODO
-    [0xA5] = z80_inst_unimplemented,  // TODO
-    [0xA6] = z80_inst_res_b_ixy,
-    [0xA7] = z80_inst_unimplemented,  // TODO
-    [0xA8] = z80_inst_unimplemented,  // TODO
-    [0xA9] = z80_inst_unimplemented,  // TODO
-    [0xAA] = z80_inst_unimplemented,  // TODO
-    [0xAB] = z80_inst_unimplemented,  // TODO
-    [0xAC] = z80_inst_unimplemented,  // TODO
-    [0xAD] = z80_inst_unimplemented,  // TODO
-    [0xAE] = z80_inst_res_b_ixy,
-    [0xAF] = z80_inst_unimplemented,  // TODO
-    [0xB0] = z80_inst_unimplemented,  // TODO
-    [0xB1] = z80_inst_unimplemented,  // TODO
-    [0xB2] = z80_inst_unimplemented,  // TODO
-    [0xB3] = z80_inst_unimplemented,  // TODO
-    [0xB4] = z80_inst_unimplemented,  // TODO
-    [0xB5] = z80_inst_unimplemented,  // TODO
-    [0xB6] = z80_inst_res_b_ixy,
-    [0xB7] = z80_inst_unimplemented,  // TODO
-    [0xB8] = z80_inst_unimplemented,  // TODO
-    [0xB9] = z80_inst_unimplemented,  // TODO
-    [0xBA] = z80_inst_unimplemented,  // TODO
-    [0xBB] = z80_inst_unimplemented,  // TODO
-    [0xBC] = z80_inst_unimplemented,  // TODO
-    [0xBD] = z80_inst_unimplemented,  // TODO
-    [0xBE] = z80_inst_res_b_ixy,
-    [0xBF] = z80_inst_unimplemented,  // TODO
-    [0xC0] = z80_inst_unimplemented,  // TODO
-    [0xC1] = z80_inst_unimplemented,  // TODO
-    [0xC2] = z80_inst_unimplemented,  // TODO
-    [0xC3] = z80_inst_unimplemented,  // TODO
-    [0xC4] = z80_inst_unimplemented,  // TODO
-    [0xC5] = z80_inst_unimplemented,  // TODO
-    [0xC6] = z80_inst_set_b_ixy,
-    [0xC7] = z80_inst_unimplemented,  // TODO
-    [0xC8] = z80_inst_unimplemented,  // TODO
-    [0xC9] = z80_inst_unimplemented,  // TODO
-    [0xCA] = z80_inst_unimplemented,  // TODO
-    [0xCB] = z80_inst_unimplemented,  // TODO
-    [0xCC] = z80_inst_unimplemented,  // TODO
-    [0xCD] = z80_inst_unimplemented,  // TODO
-    [0xCE] = z80_inst_set_b_ixy,
-    [0xCF] = z80_inst_unimplemented,  // TODO
-    [0xD0] = z80_inst_unimplemented,  // TODO
-    [0xD1] = z80_inst_unimplemented,  // TODO
-    [0xD2] = z80_inst_unimplemented,  // TODO
-    [0xD3] = z80_inst_unimplemented,  // TODO
-    [0xD4] = z80_inst_unimplemented,  // TODO
-    [0xD5] = z80_inst_unimplemented,  // TODO
-    [0xD6] = z80_inst_set_b_ixy,
-    [0xD7] = z80_inst_unimplemented,  // TODO
-    [0xD8] = z80_inst_unimplemented,  // TODO
-    [0xD9] = z80_inst_unimplemented,  // TODO
-    [0xDA] = z80_inst_unimplemented,  // TODO
-    [0xDB] = z80_inst_unimplemented,  // TODO
-    [0xDC] = z80_inst_unimplemented,  // TODO
-    [0xDD] = z80_inst_unimplemented,  // TODO
-    [0xDE] = z80_inst_set_b_ixy,
-    [0xDF] = z80_inst_unimplemented,  // TODO
-    [0xE0] = z80_inst_unimplemented,  // TODO
-    [0xE1] = z80_inst_unimplemented,  // TODO
-    [0xE2] = z80_inst_unimplemented,  // TODO
-    [0xE3] = z80_inst_unimplemented,  // TODO
-    [0xE4] = z80_inst_unimplemented,  // TODO
-    [0xE5] = z80_inst_unimplemented,  // TODO
-    [0xE6] = z80_inst_set_b_ixy,
-    [0xE7] = z80_inst_unimplemented,  // TODO
-    [0xE8] = z80_inst_unimplemented,  // TODO
-    [0xE9] = z80_inst_unimplemented,  // TODO
-    [0xEA] = z80_inst_unimplemented,  // TODO
-    [0xEB] = z80_inst_unimplemented,  // TODO
-    [0xEC] = z80_inst_unimplemented,  // TODO
-    [0xED] = z80_inst_unimplemented,  // TODO
-    [0xEE] = z80_inst_set_b_ixy,
-    [0xEF] = z80_inst_unimplemented,  // TODO
-    [0xF0] = z80_inst_unimplemented,  // TODO
-    [0xF1] = z80_inst_unimplemented,  // TODO
-    [0xF2] = z80_inst_unimplemented,  // TODO
-    [0xF3] = z80_inst_unimplemented,  // TODO
-    [0xF4] = z80_inst_unimplemented,  // TODO
-    [0xF5] = z80_inst_unimplemented,  // TODO
-    [0xF6] = z80_inst_set_b_ixy,
-    [0xF7] = z80_inst_unimplemented,  // TODO
-    [0xF8] = z80_inst_unimplemented,  // TODO
-    [0xF9] = z80_inst_unimplemented,  // TODO
-    [0xFA] = z80_inst_unimplemented,  // TODO
-    [0xFB] = z80_inst_unimplemented,  // TODO
-    [0xFC] = z80_inst_unimplemented,  // TODO
-    [0xFD] = z80_inst_unimplemented,  // TODO
-    [0xFE] = z80_inst_set_b_ixy,
-    [0xFF] = z80_inst_unimplemented   // TODO
-};
+Z80_TABLE_BEGIN(bits)
+    Z80_OP(bits, 0x00, z80_inst_rlc_r)
+    Z80_OP(bits, 0x01, z80_inst_rlc_r)
+    Z80_OP(bits, 0x02, z80_inst_rlc_r)
+    Z80_OP(bits, 0x03, z80_inst_rlc_r)
+    Z80_OP(bits, 0x04, z80_inst_rlc_r)
+    Z80_OP(bits, 0x05, z80_inst_rlc_r)
+    Z80_OP(bits, 0x06, z80_inst_rlc_hl)
+    Z80_OP(bits, 0x07, z80_inst_rlc_r)
+    Z80_OP(bits, 0x08, z80_inst_rrc_r)
+    Z80_OP(bits, 0x09, z80_inst_rrc_r)
+    Z80_OP(bits, 0x0A, z80_inst_rrc_r)
+    Z80_OP(bits, 0x0B, z80_inst_rrc_r)
+    Z80_OP(bits, 0x0C, z80_inst_rrc_r)
+    Z80_OP(bits, 0x0D, z80_inst_rrc_r)
+    Z80_OP(bits, 0x0E, z80_inst_rrc_hl)
+    Z80_OP(bits, 0x0F, z80_inst_rrc_r)
+    Z80_OP(bits, 0x10, z80_inst_rl_r)
+    Z80_OP(bits, 0x11, z80_inst_rl_r)
+    Z80_OP(bits, 0x12, z80_inst_rl_r)
+    Z80_OP(bits, 0x13, z80_inst_rl_r)
+    Z80_OP(bits, 0x14, z80_inst_rl_r)
+    Z80_OP(bits, 0x15, z80_inst_rl_r)
+    Z80_OP(bits, 0x16, z80_inst_rl_hl)
+    Z80_OP(bits, 0x17, z80_inst_rl_r)
+    Z80_OP(bits, 0x18, z80_inst_rr_r)
+    Z80_OP(bits, 0x19, z80_inst_rr_r)
+    Z80_OP(bits, 0x1A, z80_inst_rr_r)
+    Z80_OP(bits, 0x1B, z80_inst_rr_r)
+    Z80_OP(bits, 0x1C, z80_inst_rr_r)
+    Z80_OP(bits, 0x1D, z80_inst_rr_r)
+    Z80_OP(bits, 0x1E, z80_inst_rr_hl)
+    Z80_OP(bits, 0x1F, z80_inst_rr_r)
+    Z80_OP(bits, 0x20, z80_inst_sla_r)
+    Z80_OP(bits, 0x21, z80_inst_sla_r)
+    Z80_OP(bits, 0x22, z80_inst_sla_r)
+    Z80_OP(bits, 0x23, z80_inst_sla_r)
+    Z80_OP(bits, 0x24, z80_inst_sla_r)
+    Z80_OP(bits, 0x25, z80_inst_sla_r)
+    Z80_OP(bits, 0x26, z80_inst_sla_hl)
+    Z80_OP(bits, 0x27, z80_inst_sla_r)
+    Z80_OP(bits, 0x28, z80_inst_sra_r)
+    Z80_OP(bits, 0x29, z80_inst_sra_r)
+    Z80_OP(bits, 0x2A, z80_inst_sra_r)
+    Z80_OP(bits, 0x2B, z80_inst_sra_r)
+    Z80_OP(bits, 0x2C, z80_inst_sra_r)
+    Z80_OP(bits, 0x2D, z80_inst_sra_r)
+    Z80_OP(bits, 0x2E, z80_inst_sra_hl)
+    Z80_OP(bits, 0x2F, z80_inst_sra_r)
+    Z80_OP(bits, 0x30, z80_inst_sl1_r)
+    Z80_OP(bits, 0x31, z80_inst_sl1_r)
+    Z80_OP(bits, 0x32, z80_inst_sl1_r)
+    Z80_OP(bits, 0x33, z80_inst_sl1_r)
+    Z80_OP(bits, 0x34, z80_inst_sl1_r)
+    Z80_OP(bits, 0x35, z80_inst_sl1_r)
+    Z80_OP(bits, 0x36, z80_inst_sl1_hl)
+    Z80_OP(bits, 0x37, z80_inst_sl1_r)
+    Z80_OP(bits, 0x38, z80_inst_srl_r)
+    Z80_OP(bits, 0x39, z80_inst_srl_r)
+    Z80_OP(bits, 0x3A, z80_inst_srl_r)
+    Z80_OP(bits, 0x3B, z80_inst_srl_r)
+    Z80_OP(bits, 0x3C, z80_inst_srl_r)
+    Z80_OP(bits, 0x3D, z80_inst_srl_r)
+    Z80_OP(bits, 0x3E, z80_inst_srl_hl)
+    Z80_OP(bits, 0x3F, z80_inst_srl_r)
+    Z80_OP(bits, 0x40, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x41, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x42, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x43, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x44, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x45, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x46, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x47, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x48, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x49, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x4A, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x4B, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x4C, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x4D, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x4E, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x4F, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x50, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x51, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x52, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x53, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x54, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x55, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x56, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x57, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x58, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x59, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x5A, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x5B, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x5C, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x5D, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x5E, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x5F, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x60, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x61, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x62, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x63, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x64, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x65, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x66, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x67, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x68, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x69, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x6A, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x6B, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x6C, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x6D, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x6E, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x6F, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x70, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x71, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x72, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x73, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x74, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x75, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x76, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x77, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x78, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x79, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x7A, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x7B, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x7C, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x7D, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x7E, z80_inst_bit_b_hl)
+    Z80_OP(bits, 0x7F, z80_inst_bit_b_r)
+    Z80_OP(bits, 0x80, z80_inst_res_b_r)
+    Z80_OP(bits, 0x81, z80_inst_res_b_r)
+    Z80_OP(bits, 0x82, z80_inst_res_b_r)
+    Z80_OP(bits, 0x83, z80_inst_res_b_r)
+    Z80_OP(bits, 0x84, z80_inst_res_b_r)
+    Z80_OP(bits, 0x85, z80_inst_res_b_r)
+    Z80_OP(bits, 0x86, z80_inst_res_b_hl)
+    Z80_OP(bits, 0x87, z80_inst_res_b_r)
+    Z80_OP(bits, 0x88, z80_inst_res_b_r)
+    Z80_OP(bits, 0x89, z80_inst_res_b_r)
+    Z80_OP(bits, 0x8A, z80_inst_res_b_r)
+    Z80_OP(bits, 0x8B, z80_inst_res_b_r)
+    Z80_OP(bits, 0x8C, z80_inst_res_b_r)
+    Z80_OP(bits, 0x8D, z80_inst_res_b_r)
+    Z80_OP(bits, 0x8E, z80_inst_res_b_hl)
+    Z80_OP(bits, 0x8F, z80_inst_res_b_r)
+    Z80_OP(bits, 0x90, z80_inst_res_b_r)
+    Z80_OP(bits, 0x91, z80_inst_res_b_r)
+    Z80_OP(bits, 0x92, z80_inst_res_b_r)
+    Z80_OP(bits, 0x93, z80_inst_res_b_r)
+    Z80_OP(bits, 0x94, z80_inst_res_b_r)
+    Z80_OP(bits, 0x95, z80_inst_res_b_r)
+    Z80_OP(bits, 0x96, z80_inst_res_b_hl)
+    Z80_OP(bits, 0x97, z80_inst_res_b_r)
+    Z80_OP(bits, 0x98, z80_inst_res_b_r)
+    Z80_OP(bits, 0x99, z80_inst_res_b_r)
+    Z80_OP(bits, 0x9A, z80_inst_res_b_r)
+    Z80_OP(bits, 0x9B, z80_inst_res_b_r)
+    Z80_OP(bits, 0x9C, z80_inst_res_b_r)
+    Z80_OP(bits, 0x9D, z80_inst_res_b_r)
+    Z80_OP(bits, 0x9E, z80_inst_res_b_hl)
+    Z80_OP(bits, 0x9F, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA0, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA1, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA2, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA3, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA4, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA5, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA6, z80_inst_res_b_hl)
+    Z80_OP(bits, 0xA7, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA8, z80_inst_res_b_r)
+    Z80_OP(bits, 0xA9, z80_inst_res_b_r)
+    Z80_OP(bits, 0xAA, z80_inst_res_b_r)
+    Z80_OP(bits, 0xAB, z80_inst_res_b_r)
+    Z80_OP(bits, 0xAC, z80_inst_res_b_r)
+    Z80_OP(bits, 0xAD, z80_inst_res_b_r)
+    Z80_OP(bits, 0xAE, z80_inst_res_b_hl)
+    Z80_OP(bits, 0xAF, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB0, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB1, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB2, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB3, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB4, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB5, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB6, z80_inst_res_b_hl)
+    Z80_OP(bits, 0xB7, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB8, z80_inst_res_b_r)
+    Z80_OP(bits, 0xB9, z80_inst_res_b_r)
+    Z80_OP(bits, 0xBA, z80_inst_res_b_r)
+    Z80_OP(bits, 0xBB, z80_inst_res_b_r)
+    Z80_OP(bits, 0xBC, z80_inst_res_b_r)
+    Z80_OP(bits, 0xBD, z80_inst_res_b_r)
+    Z80_OP(bits, 0xBE, z80_inst_res_b_hl)
+    Z80_OP(bits, 0xBF, z80_inst_res_b_r)
+    Z80_OP(bits, 0xC0, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC1, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC2, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC3, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC4, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC5, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC6, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xC7, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC8, z80_inst_set_b_r)
+    Z80_OP(bits, 0xC9, z80_inst_set_b_r)
+    Z80_OP(bits, 0xCA, z80_inst_set_b_r)
+    Z80_OP(bits, 0xCB, z80_inst_set_b_r)
+    Z80_OP(bits, 0xCC, z80_inst_set_b_r)
+    Z80_OP(bits, 0xCD, z80_inst_set_b_r)
+    Z80_OP(bits, 0xCE, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xCF, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD0, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD1, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD2, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD3, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD4, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD5, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD6, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xD7, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD8, z80_inst_set_b_r)
+    Z80_OP(bits, 0xD9, z80_inst_set_b_r)
+    Z80_OP(bits, 0xDA, z80_inst_set_b_r)
+    Z80_OP(bits, 0xDB, z80_inst_set_b_r)
+    Z80_OP(bits, 0xDC, z80_inst_set_b_r)
+    Z80_OP(bits, 0xDD, z80_inst_set_b_r)
+    Z80_OP(bits, 0xDE, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xDF, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE0, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE1, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE2, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE3, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE4, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE5, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE6, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xE7, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE8, z80_inst_set_b_r)
+    Z80_OP(bits, 0xE9, z80_inst_set_b_r)
+    Z80_OP(bits, 0xEA, z80_inst_set_b_r)
+    Z80_OP(bits, 0xEB, z80_inst_set_b_r)
+    Z80_OP(bits, 0xEC, z80_inst_set_b_r)
+    Z80_OP(bits, 0xED, z80_inst_set_b_r)
+    Z80_OP(bits, 0xEE, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xEF, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF0, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF1, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF2, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF3, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF4, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF5, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF6, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xF7, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF8, z80_inst_set_b_r)
+    Z80_OP(bits, 0xF9, z80_inst_set_b_r)
+    Z80_OP(bits, 0xFA, z80_inst_set_b_r)
+    Z80_OP(bits, 0xFB, z80_inst_set_b_r)
+    Z80_OP(bits, 0xFC, z80_inst_set_b_r)
+    Z80_OP(bits, 0xFD, z80_inst_set_b_r)
+    Z80_OP(bits, 0xFE, z80_inst_set_b_hl)
+    Z80_OP(bits, 0xFF, z80_inst_set_b_r)
+Z80_TABLE_END
+
+Z80_TABLE_BEGIN(index)
+    Z80_OP(index, 0x00, z80_inst_nop2)
+    Z80_OP(index, 0x01, z80_inst_nop2)
+    Z80_OP(index, 0x02, z80_inst_nop2)
+    Z80_OP(index, 0x03, z80_inst_nop2)
+    Z80_OP(index, 0x04, z80_inst_nop2)
+    Z80_OP(index, 0x05, z80_inst_nop2)
+    Z80_OP(index, 0x06, z80_inst_nop2)
+    Z80_OP(index, 0x07, z80_inst_nop2)
+    Z80_OP(index, 0x08, z80_inst_nop2)
+    Z80_OP(index, 0x09, z80_inst_add_ixy_pp)
+    Z80_OP(index, 0x0A, z80_inst_nop2)
+    Z80_OP(index, 0x0B, z80_inst_nop2)
+    Z80_OP(index, 0x0C, z80_inst_nop2)
+    Z80_OP(index, 0x0D, z80_inst_nop2)
+    Z80_OP(index, 0x0E, z80_inst_nop2)
+    Z80_OP(index, 0x0F, z80_inst_nop2)
+    Z80_OP(index, 0x10, z80_inst_nop2)
+    Z80_OP(index, 0x11, z80_inst_nop2)
+    Z80_OP(index, 0x12, z80_inst_nop2)
+    Z80_OP(index, 0x13, z80_inst_nop2)
+    Z80_OP(index, 0x14, z80_inst_nop2)
+    Z80_OP(index, 0x15, z80_inst_nop2)
+    Z80_OP(index, 0x16, z80_inst_nop2)
+    Z80_OP(index, 0x17, z80_inst_nop2)
+    Z80_OP(index, 0x18, z80_inst_nop2)
+    Z80_OP(index, 0x19, z80_inst_add_ixy_pp)
+    Z80_OP(index, 0x1A, z80_inst_nop2)
+    Z80_OP(index, 0x1B, z80_inst_nop2)
+    Z80_OP(index, 0x1C, z80_inst_nop2)
+    Z80_OP(index, 0x1D, z80_inst_nop2)
+    Z80_OP(index, 0x1E, z80_inst_nop2)
+    Z80_OP(index, 0x1F, z80_inst_nop2)
+    Z80_OP(index, 0x20, z80_inst_nop2)
+    Z80_OP(index, 0x21, z80_inst_ld_ixy_nn)
+    Z80_OP(index, 0x22, z80_inst_ld_inn_ixy)
+    Z80_OP(index, 0x23, z80_inst_inc_xy)
+    Z80_OP(index, 0x24, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x25, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x26, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x27, z80_inst_nop2)
+    Z80_OP(index, 0x28, z80_inst_nop2)
+    Z80_OP(index, 0x29, z80_inst_add_ixy_pp)
+    Z80_OP(index, 0x2A, z80_inst_ld_ixy_inn)
+    Z80_OP(index, 0x2B, z80_inst_dec_xy)
+    Z80_OP(index, 0x2C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x2D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x2E, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x2F, z80_inst_nop2)
+    Z80_OP(index, 0x30, z80_inst_nop2)
+    Z80_OP(index, 0x31, z80_inst_nop2)
+    Z80_OP(index, 0x32, z80_inst_nop2)
+    Z80_OP(index, 0x33, z80_inst_nop2)
+    Z80_OP(index, 0x34, z80_inst_inc_ixy)
+    Z80_OP(index, 0x35, z80_inst_dec_ixy)
+    Z80_OP(index, 0x36, z80_inst_ld_ixy_n)
+    Z80_OP(index, 0x37, z80_inst_nop2)
+    Z80_OP(index, 0x38, z80_inst_nop2)
+    Z80_OP(index, 0x39, z80_inst_add_ixy_pp)
+    Z80_OP(index, 0x3A, z80_inst_nop2)
+    Z80_OP(index, 0x3B, z80_inst_nop2)
+    Z80_OP(index, 0x3C, z80_inst_nop2)
+    Z80_OP(index, 0x3D, z80_inst_nop2)
+    Z80_OP(index, 0x3E, z80_inst_nop2)
+    Z80_OP(index, 0x3F, z80_inst_nop2)
+    Z80_OP(index, 0x40, z80_inst_nop2)
+    Z80_OP(index, 0x41, z80_inst_nop2)
+    Z80_OP(index, 0x42, z80_inst_nop2)
+    Z80_OP(index, 0x43, z80_inst_nop2)
+    Z80_OP(index, 0x44, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x45, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x46, z80_inst_ld_r_ixy)
+    Z80_OP(index, 0x47, z80_inst_nop2)
+    Z80_OP(index, 0x48, z80_inst_nop2)
+    Z80_OP(index, 0x49, z80_inst_nop2)
+    Z80_OP(index, 0x4A, z80_inst_nop2)
+    Z80_OP(index, 0x4B, z80_inst_nop2)
+    Z80_OP(index, 0x4C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x4D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x4E, z80_inst_ld_r_ixy)
+    Z80_OP(index, 0x4F, z80_inst_nop2)
+    Z80_OP(index, 0x50, z80_inst_nop2)
+    Z80_OP(index, 0x51, z80_inst_nop2)
+    Z80_OP(index, 0x52, z80_inst_nop2)
+    Z80_OP(index, 0x53, z80_inst_nop2)
+    Z80_OP(index, 0x54, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x55, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x56, z80_inst_ld_r_ixy)
+    Z80_OP(index, 0x57, z80_inst_nop2)
+    Z80_OP(index, 0x58, z80_inst_nop2)
+    Z80_OP(index, 0x59, z80_inst_nop2)
+    Z80_OP(index, 0x5A, z80_inst_nop2)
+    Z80_OP(index, 0x5B, z80_inst_nop2)
+    Z80_OP(index, 0x5C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x5D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x5E, z80_inst_ld_r_ixy)
+    Z80_OP(index, 0x5F, z80_inst_nop2)
+    Z80_OP(index, 0x60, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x61, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x62, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x63, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x64, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x65, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x66, z80_inst_ld_r_ixy)
+    Z80_OP(index, 0x67, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x68, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x69, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x6A, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x6B, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x6C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x6D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x6E, z80_inst_ld_r_ixy)
+    Z80_OP(index, 0x6F, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x70, z80_inst_ld_ixy_r)
+    Z80_OP(index, 0x71, z80_inst_ld_ixy_r)
+    Z80_OP(index, 0x72, z80_inst_ld_ixy_r)
+    Z80_OP(index, 0x73, z80_inst_ld_ixy_r)
+    Z80_OP(index, 0x74, z80_inst_ld_ixy_r)
+    Z80_OP(index, 0x75, z80_inst_ld_ixy_r)
+    Z80_OP(index, 0x76, z80_inst_nop2)
+    Z80_OP(index, 0x77, z80_inst_ld_ixy_r)
+    Z80_OP(index, 0x78, z80_inst_nop2)
+    Z80_OP(index, 0x79, z80_inst_nop2)
+    Z80_OP(index, 0x7A, z80_inst_nop2)
+    Z80_OP(index, 0x7B, z80_inst_nop2)
+    Z80_OP(index, 0x7C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x7D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x7E, z80_inst_ld_r_ixy)
+    Z80_OP(index, 0x7F, z80_inst_nop2)
+    Z80_OP(index, 0x80, z80_inst_nop2)
+    Z80_OP(index, 0x81, z80_inst_nop2)
+    Z80_OP(index, 0x82, z80_inst_nop2)
+    Z80_OP(index, 0x83, z80_inst_nop2)
+    Z80_OP(index, 0x84, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x85, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x86, z80_inst_add_a_ixy)
+    Z80_OP(index, 0x87, z80_inst_nop2)
+    Z80_OP(index, 0x88, z80_inst_nop2)
+    Z80_OP(index, 0x89, z80_inst_nop2)
+    Z80_OP(index, 0x8A, z80_inst_nop2)
+    Z80_OP(index, 0x8B, z80_inst_nop2)
+    Z80_OP(index, 0x8C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x8D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x8E, z80_inst_adc_a_ixy)
+    Z80_OP(index, 0x8F, z80_inst_nop2)
+    Z80_OP(index, 0x90, z80_inst_nop2)
+    Z80_OP(index, 0x91, z80_inst_nop2)
+    Z80_OP(index, 0x92, z80_inst_nop2)
+    Z80_OP(index, 0x93, z80_inst_nop2)
+    Z80_OP(index, 0x94, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x95, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x96, z80_inst_sub_ixy)
+    Z80_OP(index, 0x97, z80_inst_nop2)
+    Z80_OP(index, 0x98, z80_inst_nop2)
+    Z80_OP(index, 0x99, z80_inst_nop2)
+    Z80_OP(index, 0x9A, z80_inst_nop2)
+    Z80_OP(index, 0x9B, z80_inst_nop2)
+    Z80_OP(index, 0x9C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x9D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0x9E, z80_inst_sbc_a_ixy)
+    Z80_OP(index, 0x9F, z80_inst_nop2)
+    Z80_OP(index, 0xA0, z80_inst_nop2)
+    Z80_OP(index, 0xA1, z80_inst_nop2)
+    Z80_OP(index, 0xA2, z80_inst_nop2)
+    Z80_OP(index, 0xA3, z80_inst_nop2)
+    Z80_OP(index, 0xA4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xA5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xA6, z80_inst_and_ixy)
+    Z80_OP(index, 0xA7, z80_inst_nop2)
+    Z80_OP(index, 0xA8, z80_inst_nop2)
+    Z80_OP(index, 0xA9, z80_inst_nop2)
+    Z80_OP(index, 0xAA, z80_inst_nop2)
+    Z80_OP(index, 0xAB, z80_inst_nop2)
+    Z80_OP(index, 0xAC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xAD, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xAE, z80_inst_xor_ixy)
+    Z80_OP(index, 0xAF, z80_inst_nop2)
+    Z80_OP(index, 0xB0, z80_inst_nop2)
+    Z80_OP(index, 0xB1, z80_inst_nop2)
+    Z80_OP(index, 0xB2, z80_inst_nop2)
+    Z80_OP(index, 0xB3, z80_inst_nop2)
+    Z80_OP(index, 0xB4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xB5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xB6, z80_inst_or_ixy)
+    Z80_OP(index, 0xB7, z80_inst_nop2)
+    Z80_OP(index, 0xB8, z80_inst_nop2)
+    Z80_OP(index, 0xB9, z80_inst_nop2)
+    Z80_OP(index, 0xBA, z80_inst_nop2)
+    Z80_OP(index, 0xBB, z80_inst_nop2)
+    Z80_OP(index, 0xBC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xBD, z80_inst_unimplemented)  // TODO
+    Z80_OP(index, 0xBE, z80_inst_cp_ixy)
+    Z80_OP(index, 0xBF, z80_inst_nop2)
+    Z80_OP(index, 0xC0, z80_inst_nop2)
+    Z80_OP(index, 0xC1, z80_inst_nop2)
+    Z80_OP(index, 0xC2, z80_inst_nop2)
+    Z80_OP(index, 0xC3, z80_inst_nop2)
+    Z80_OP(index, 0xC4, z80_inst_nop2)
+    Z80_OP(index, 0xC5, z80_inst_nop2)
+    Z80_OP(index, 0xC6, z80_inst_nop2)
+    Z80_OP(index, 0xC7, z80_inst_nop2)
+    Z80_OP(index, 0xC8, z80_inst_nop2)
+    Z80_OP(index, 0xC9, z80_inst_nop2)
+    Z80_OP(index, 0xCA, z80_inst_nop2)
+    Z80_PREFIX(index, 0xCB, index_bits)
+    Z80_OP(index, 0xCC, z80_inst_nop2)
+    Z80_OP(index, 0xCD, z80_inst_nop2)
+    Z80_OP(index, 0xCE, z80_inst_nop2)
+    Z80_OP(index, 0xCF, z80_inst_nop2)
+    Z80_OP(index, 0xD0, z80_inst_nop2)
+    Z80_OP(index, 0xD1, z80_inst_nop2)
+    Z80_OP(index, 0xD2, z80_inst_nop2)
+    Z80_OP(index, 0xD3, z80_inst_nop2)
+    Z80_OP(index, 0xD4, z80_inst_nop2)
+    Z80_OP(index, 0xD5, z80_inst_nop2)
+    Z80_OP(index, 0xD6, z80_inst_nop2)
+    Z80_OP(index, 0xD7, z80_inst_nop2)
+    Z80_OP(index, 0xD8, z80_inst_nop2)
+    Z80_OP(index, 0xD9, z80_inst_nop2)
+    Z80_OP(index, 0xDA, z80_inst_nop2)
+    Z80_OP(index, 0xDB, z80_inst_nop2)
+    Z80_OP(index, 0xDC, z80_inst_nop2)
+    Z80_OP(index, 0xDD, z80_inst_nop2)
+    Z80_OP(index, 0xDE, z80_inst_nop2)
+    Z80_OP(index, 0xDF, z80_inst_nop2)
+    Z80_OP(index, 0xE0, z80_inst_nop2)
+    Z80_OP(index, 0xE1, z80_inst_pop_ixy)
+    Z80_OP(index, 0xE2, z80_inst_nop2)
+    Z80_OP(index, 0xE3, z80_inst_ex_sp_ixy)
+    Z80_OP(index, 0xE4, z80_inst_nop2)
+    Z80_OP(index, 0xE5, z80_inst_push_ixy)
+    Z80_OP(index, 0xE6, z80_inst_nop2)
+    Z80_OP(index, 0xE7, z80_inst_nop2)
+    Z80_OP(index, 0xE8, z80_inst_nop2)
+    Z80_OP(index, 0xE9, z80_inst_jp_ixy)
+    Z80_OP(index, 0xEA, z80_inst_nop2)
+    Z80_OP(index, 0xEB, z80_inst_nop2)
+    Z80_OP(index, 0xEC, z80_inst_nop2)
+    Z80_OP(index, 0xED, z80_inst_nop2)
+    Z80_OP(index, 0xEE, z80_inst_nop2)
+    Z80_OP(index, 0xEF, z80_inst_nop2)
+    Z80_OP(index, 0xF0, z80_inst_nop2)
+    Z80_OP(index, 0xF1, z80_inst_nop2)
+    Z80_OP(index, 0xF2, z80_inst_nop2)
+    Z80_OP(index, 0xF3, z80_inst_nop2)
+    Z80_OP(index, 0xF4, z80_inst_nop2)
+    Z80_OP(index, 0xF5, z80_inst_nop2)
+    Z80_OP(index, 0xF6, z80_inst_nop2)
+    Z80_OP(index, 0xF7, z80_inst_nop2)
+    Z80_OP(index, 0xF8, z80_inst_nop2)
+    Z80_OP(index, 0xF9, z80_inst_ld_sp_ixy)
+    Z80_OP(index, 0xFA, z80_inst_nop2)
+    Z80_OP(index, 0xFB, z80_inst_nop2)
+    Z80_OP(index, 0xFC, z80_inst_nop2)
+    Z80_OP(index, 0xFD, z80_inst_nop2)
+    Z80_OP(index, 0xFE, z80_inst_nop2)
+    Z80_OP(index, 0xFF, z80_inst_nop2)
+Z80_TABLE_END
+
+Z80_TABLE_BEGIN(index_bits)
+    Z80_OP(index_bits, 0x00, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x01, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x02, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x03, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x04, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x05, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x06, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x07, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x08, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x09, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x0A, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x0B, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x0C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x0D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x0E, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x0F, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x10, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x11, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x12, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x13, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x14, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x15, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x16, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x17, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x18, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x19, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x1A, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x1B, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x1C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x1D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x1E, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x1F, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x20, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x21, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x22, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x23, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x24, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x25, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x26, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x27, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x28, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x29, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x2A, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x2B, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x2C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x2D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x2E, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x2F, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x30, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x31, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x32, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x33, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x34, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x35, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x36, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x37, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x38, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x39, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x3A, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x3B, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x3C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x3D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x3E, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x3F, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x40, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x41, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x42, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x43, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x44, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x45, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x46, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x47, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x48, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x49, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x4A, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x4B, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x4C, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x4D, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x4E, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x4F, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x50, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x51, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x52, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x53, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x54, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x55, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x56, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x57, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x58, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x59, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x5A, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x5B, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x5C, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x5D, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x5E, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x5F, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x60, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x61, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x62, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x63, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x64, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x65, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x66, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x67, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x68, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x69, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x6A, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x6B, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x6C, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x6D, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x6E, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x6F, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x70, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x71, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x72, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x73, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x74, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x75, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x76, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x77, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x78, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x79, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x7A, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x7B, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x7C, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x7D, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x7E, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x7F, z80_inst_bit_b_ixy)
+    Z80_OP(index_bits, 0x80, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x81, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x82, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x83, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x84, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x85, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x86, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0x87, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x88, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x89, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x8A, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x8B, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x8C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x8D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x8E, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0x8F, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x90, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x91, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x92, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x93, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x94, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x95, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x96, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0x97, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x98, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x99, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x9A, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x9B, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x9C, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x9D, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0x9E, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0x9F, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA0, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA1, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA2, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA3, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA6, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0xA7, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA8, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xA9, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xAA, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xAB, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xAC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xAD, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xAE, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0xAF, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB0, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB1, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB2, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB3, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB6, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0xB7, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB8, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xB9, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xBA, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xBB, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xBC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xBD, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xBE, z80_inst_res_b_ixy)
+    Z80_OP(index_bits, 0xBF, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC0, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC1, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC2, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC3, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC6, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xC7, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC8, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xC9, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xCA, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xCB, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xCC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xCD, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xCE, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xCF, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD0, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD1, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD2, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD3, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD6, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xD7, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD8, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xD9, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xDA, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xDB, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xDC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xDD, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xDE, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xDF, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE0, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE1, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE2, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE3, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE6, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xE7, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE8, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xE9, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xEA, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xEB, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xEC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xED, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xEE, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xEF, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF0, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF1, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF2, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF3, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF4, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF5, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF6, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xF7, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF8, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xF9, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xFA, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xFB, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xFC, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xFD, z80_inst_unimplemented)  // TODO
+    Z80_OP(index_bits, 0xFE, z80_inst_set_b_ixy)
+    Z80_OP(index_bits, 0xFF, z80_inst_unimplemented)  // TODO
+Z80_TABLE_END
@@ -0,0 +1,226 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Micro-benchmark for the Z80's flag lookup tables.
+
+    For each kind of ALU operation, this times working out the F register the
+    way the interpreter does (through resolve_flags() and the tables) against
+    computing it from scratch with the formulas the tables are built from,
+    over every possible input. It also checks that the two always agree.
+*/
+
+#include "../../src/z80.c"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define READ_TICKS() __rdtsc()
+#else
+#define READ_TICKS() 0
+#endif
+
+#define ROUNDS 64
+
+typedef uint8_t (*FlagFunc)(Z80*, unsigned, unsigned);
+
+typedef struct {
+    const char *name;
+    unsigned lh_max, rh_max;
+    FlagFunc formula, table;
+} FlagBench;
+
+static volatile uint8_t sink;
+
+/* Formulas (what the interpreter did before the tables) */
+
+static uint8_t formula_add(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    return compute_flags_add8(lh, rh);
+}
+
+static uint8_t formula_sub(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    return compute_flags_sub8(lh, rh);
+}
+
+static uint8_t formula_cp(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    return (compute_flags_sub8(lh, rh) & ~0x28) | (rh & 0x28);
+}
+
+static uint8_t formula_and(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    return compute_flags_szp(lh & rh) | 1 << FLAG_HALFCARRY;
+}
+
+static uint8_t formula_xor(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    return compute_flags_szp(lh ^ rh);
+}
+
+static uint8_t formula_inc(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    return compute_flags_inc(lh) | rh;
+}
+
+static uint8_t formula_dec(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    return compute_flags_dec(lh) | rh;
+}
+
+static uint8_t formula_daa(Z80 *z80, unsigned lh, unsigned rh)
+{
+    (void) z80;
+    uint16_t af = compute_daa(lh, rh & 0x01, rh & 0x02, rh & 0x10);
+    return (af >> 8) ^ (af & 0xFF);
+}
+
+/* Tables, as used by the interpreter */
+
+static uint8_t table_add(Z80 *z80, unsigned lh, unsigned rh)
+{
+    z80->regs.a = lh;
+    set_flags_add8(z80, rh);
+    return resolve_flags(z80);
+}
+
+static uint8_t table_sub(Z80 *z80, unsigned lh, unsigned rh)
+{
+    z80->regs.a = lh;
+    set_flags_sub8(z80, rh);
+    return resolve_flags(z80);
+}
+
+static uint8_t table_cp(Z80 *z80, unsigned lh, unsigned rh)
+{
+    z80->regs.a = lh;
+    set_flags_cp(z80, rh);
+    return resolve_flags(z80);
+}
+
+static uint8_t table_and(Z80 *z80, unsigned lh, unsigned rh)
+{
+    set_flags_bitwise(z80, lh & rh, true);
+    return resolve_flags(z80);
+}
+
+static uint8_t table_xor(Z80 *z80, unsigned lh, unsigned rh)
+{
+    set_flags_bitwise(z80, lh ^ rh, false);
+    return resolve_flags(z80);
+}
+
+static uint8_t table_inc(Z80 *z80, unsigned lh, unsigned rh)
+{
+    store_flags(z80, rh);
+    set_flags_inc(z80, lh);
+    return resolve_flags(z80);
+}
+
+static uint8_t table_dec(Z80 *z80, unsigned lh, unsigned rh)
+{
+    store_flags(z80, rh);
+    set_flags_dec(z80, lh);
+    return resolve_flags(z80);
+}
+
+static uint8_t table_daa(Z80 *z80, unsigned lh, unsigned rh)
+{
+    z80->regs.a = lh;
+    store_flags(z80, rh);
+    z80_inst_daa(z80, 0x27);
+    return z80->regs.a ^ z80->regs.f;
+}
+
+static const FlagBench benches[] = {
+    {"ADD/ADC",     0xFF, 0x100, formula_add, table_add},
+    {"SUB/SBC",     0xFF, 0x100, formula_sub, table_sub},
+    {"CP",          0xFF, 0xFF,  formula_cp,  table_cp},
+    {"AND",         0xFF, 0xFF,  formula_and, table_and},
+    {"OR/XOR",      0xFF, 0xFF,  formula_xor, table_xor},
+    {"INC",         0xFF, 0x01,  formula_inc, table_inc},
+    {"DEC",         0xFF, 0x01,  formula_dec, table_dec},
+    {"DAA",         0xFF, 0x13,  formula_daa, table_daa}
+};
+
+/*
+    Run one flag function over every input, ROUNDS times.
+
+    Return the average time per call in nanoseconds, and store the average
+    number of timestamp counter ticks in *ticks.
+*/
+static double run(Z80 *z80, const FlagBench *bench, FlagFunc func,
+                  double *ticks)
+{
+    uint8_t acc = 0;
+    uint64_t calls = 0;
+    uint64_t start = get_time_ns(), tick_start = READ_TICKS();
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        for (unsigned lh = 0; lh <= bench->lh_max; lh++) {
+            for (unsigned rh = 0; rh <= bench->rh_max; rh++)
+                acc ^= func(z80, lh, rh);
+        }
+        calls += (bench->lh_max + 1) * (bench->rh_max + 1);
+    }
+
+    uint64_t tick_end = READ_TICKS(), end = get_time_ns();
+    sink = acc;
+    *ticks = (double) (tick_end - tick_start) / calls;
+    return (double) (end - start) / calls;
+}
+
+/*
+    Return whether the two ways of computing flags agree on every input.
+*/
+static bool check(Z80 *z80, const FlagBench *bench)
+{
+    for (unsigned lh = 0; lh <= bench->lh_max; lh++) {
+        for (unsigned rh = 0; rh <= bench->rh_max; rh++) {
+            uint8_t expected = bench->formula(z80, lh, rh);
+            uint8_t actual = bench->table(z80, lh, rh);
+            if (expected != actual) {
+                ERROR("%s: 0x%02X for (0x%02X, 0x%02X), expected 0x%02X",
+                      bench->name, actual, lh, rh, expected)
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    Z80 z80;
+    bool ok = true;
+
+    init_flag_tables();
+    z80.regs.flag_op = LAZY_NONE;
+
+    printf("crater: Z80 flag benchmark (per operation)\n");
+    printf("%-10s %12s %12s %12s\n", "op", "formula", "table", "saving");
+    for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+        const FlagBench *bench = &benches[i];
+        double formula_ticks, table_ticks;
+
+        if (!check(&z80, bench)) {
+            ok = false;
+            continue;
+        }
+        double formula = run(&z80, bench, bench->formula, &formula_ticks);
+        double table = run(&z80, bench, bench->table, &table_ticks);
+        printf("%-10s %9.2f ns %9.2f ns %9.2f ns (%.1f ticks)\n", bench->name,
+               formula, table, formula - table, formula_ticks - table_ticks);
+    }
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,182 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Benchmark for the audio resampler.
+
+    For each host rate, each vector version is first checked against the
+    plain C version: fed the same noise in random-sized chunks, with a small
+    rate change partway through, it must produce exactly the same samples.
+    The filter is checked too: a 1 kHz tone must pass at about the same
+    level, and a 60 kHz one, well above every host rate's Nyquist frequency,
+    must be cut to under 1% of it. Then each version is timed.
+*/
+
+#include "../../src/resampler.c"
+#include "../random.h"
+
+#define IN_RATE (3579545.0 / 16)
+#define IN_SAMPLES 32768
+#define MAX_CHUNK 4096
+#define ROUNDS 20
+
+static int16_t input[2 * IN_SAMPLES];
+
+/*
+    Return the name of a SIMD level.
+*/
+static const char* level_name(SIMDLevel level)
+{
+    switch (level) {
+        case SIMD_SSE2: return "sse2";
+        case SIMD_AVX2: return "avx2";
+        default:        return "none";
+    }
+}
+
+/*
+    Resample the test input at the given level, in chunks of the given sizes,
+    nudging the rate halfway through. Return how many samples were written.
+*/
+static size_t render(double rate, SIMDLevel level,
+                     const size_t *chunks, int16_t *out)
+{
+    Resampler r;
+    size_t done = 0, written = 0;
+
+    resampler_init(&r, IN_RATE, rate);
+    r.simd = level;
+    for (size_t i = 0; done < IN_SAMPLES; i++) {
+        if (done >= IN_SAMPLES / 2 && done - chunks[i - 1] < IN_SAMPLES / 2)
+            resampler_set_rates(&r, IN_RATE, rate * 1.003);
+        written += resampler_run(&r, input + 2 * done, chunks[i],
+                                 out + 2 * written);
+        done += chunks[i];
+    }
+    resampler_free(&r);
+    return written;
+}
+
+/*
+    Return whether every vector version agrees with the plain C version.
+*/
+static bool check(double rate, SIMDLevel host, int16_t *expected,
+                  int16_t *actual)
+{
+    size_t chunks[IN_SAMPLES], done = 0;
+    for (size_t i = 0; done < IN_SAMPLES; i++) {
+        chunks[i] = 1 + rand_next() % MAX_CHUNK;
+        if (chunks[i] > IN_SAMPLES - done)
+            chunks[i] = IN_SAMPLES - done;
+        done += chunks[i];
+    }
+
+    size_t count = render(rate, SIMD_NONE, chunks, expected);
+    for (int level = SIMD_SSE2; level <= (int) host; level++) {
+        size_t got = render(rate, level, chunks, actual);
+        if (got != count) {
+            ERROR("%.0f Hz, %s: got %zu samples, expected %zu", rate,
+                  level_name(level), got, count)
+            return false;
+        }
+        for (size_t i = 0; i < 2 * count; i++) {
+            if (actual[i] == expected[i])
+                continue;
+            ERROR("%.0f Hz, %s: sample %zu is %d, expected %d", rate,
+                  level_name(level), i / 2, actual[i], expected[i])
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+    Resample a sine wave of the given frequency and amplitude, and return the
+    output's amplitude as a fraction of it, skipping the filter's start-up.
+*/
+static double response(double rate, double freq, int16_t *out)
+{
+    Resampler r;
+    double amp = 16000, sum = 0;
+
+    for (size_t i = 0; i < IN_SAMPLES; i++)
+        input[2 * i] = input[2 * i + 1] =
+            lround(amp * sin(2 * PI * freq * i / IN_RATE));
+
+    resampler_init(&r, IN_RATE, rate);
+    size_t count = resampler_run(&r, input, IN_SAMPLES, out);
+    size_t skip = count / 4;
+    for (size_t i = skip; i < count; i++)
+        sum += (double) out[2 * i] * out[2 * i];
+    resampler_free(&r);
+    return sqrt(2 * sum / (count - skip)) / amp;
+}
+
+/*
+    Time resampling the test input at the given level, in nanoseconds per
+    output sample.
+*/
+static double run(double rate, SIMDLevel level, int16_t *out)
+{
+    Resampler r;
+    size_t written = 0;
+
+    resampler_init(&r, IN_RATE, rate);
+    r.simd = level;
+    uint64_t start = get_time_ns();
+    for (unsigned round = 0; round < ROUNDS; round++)
+        written += resampler_run(&r, input, IN_SAMPLES, out);
+    uint64_t end = get_time_ns();
+
+    resampler_free(&r);
+    return (double) (end - start) / written;
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    // Highest last, as it needs the biggest output buffer:
+    static const double rates[] = {22050, 44100, 48000, 96000};
+    Resampler probe;
+    bool ok = true;
+
+    resampler_init(&probe, IN_RATE, rates[3]);
+    SIMDLevel host = probe.simd;
+    size_t size = 2 * resampler_max_output(&probe, IN_SAMPLES);
+    resampler_free(&probe);
+
+    int16_t *expected = cr_malloc(sizeof(int16_t) * size);
+    int16_t *actual = cr_malloc(sizeof(int16_t) * size);
+
+    printf("crater: resampler benchmark (%u taps, per output sample, %s)\n",
+           RESAMPLER_TAPS, level_name(host));
+    printf("%-8s %10s %10s %12s %12s\n", "rate", "1 kHz", "60 kHz", "plain",
+           "vector");
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        double rate = rates[i];
+        double pass = response(rate, 1000, actual);
+        double stop = response(rate, 60000, actual);
+        if (fabs(pass - 1) > 0.01 || stop > 0.01) {
+            ERROR("%.0f Hz: 1 kHz passed at %.4f, 60 kHz at %.4f", rate, pass,
+                  stop)
+            ok = false;
+        }
+
+        for (size_t j = 0; j < 2 * IN_SAMPLES; j++)
+            input[j] = rand_next() >> 16;
+        if (!check(rate, host, expected, actual)) {
+            ok = false;
+            continue;
+        }
+        double plain = run(rate, SIMD_NONE, actual);
+        double vector = run(rate, host, actual);
+        printf("%-8.0f %10.4f %10.4f %9.1f ns %9.1f ns\n", rate, pass, stop,
+               plain, vector);
+    }
+
+    free(expected);
+    free(actual);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
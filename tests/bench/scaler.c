@@ -0,0 +1,185 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Benchmark for the software scaler.
+
+    Every combination of filter, scale, aspect correction, and frame blending
+    is first checked: each vector version, on one thread and on several, must
+    produce exactly what the plain C version does, without writing outside
+    the output. Then each combination is timed at the best level the host
+    supports.
+*/
+
+#include "../../src/scaler.c"
+#include "../random.h"
+
+#define ROUNDS 200
+#define PITCH_PAD 16
+#define CANARY 0xDEADBEEF
+
+typedef struct {
+    ScalerFilter filter;
+    unsigned scale;
+    bool aspect, blend;
+} ScalerBench;
+
+static uint32_t frames[2][IN_PIXELS];
+
+/*
+    Fill the two test frames with runs of a few colors, so there are plenty of
+    edges for Scale2x to find; the second is the first with some changes.
+*/
+static void make_frames()
+{
+    static const uint32_t colors[] = {
+        0xFF000000, 0xFFFFFFFF, 0xFF55AA00, 0xFF0055FF, 0xFFAA0055
+    };
+
+    for (size_t i = 0; i < IN_PIXELS; i++) {
+        bool repeat = i % SCALER_IN_WIDTH && rand_next() % 3;
+        frames[0][i] = repeat ? frames[0][i - 1] : colors[rand_next() % 5];
+        frames[1][i] = rand_next() % 8 ? frames[0][i] : colors[rand_next() % 5];
+    }
+}
+
+/*
+    Return the name of a SIMD level.
+*/
+static const char* level_name(SIMDLevel level)
+{
+    switch (level) {
+        case SIMD_SSE2: return "sse2";
+        case SIMD_AVX2: return "avx2";
+        default:        return "none";
+    }
+}
+
+/*
+    Scale both test frames with the given settings, leaving the second in
+    out, which must hold the output plus padding after each row.
+*/
+static void render(const ScalerBench *bench, SIMDLevel level,
+                   unsigned threads, uint32_t *out)
+{
+    Scaler scaler;
+
+    scaler_init(&scaler, bench->scale, bench->filter, bench->aspect,
+                bench->blend);
+    scaler.simd = level;
+    scaler_set_threads(&scaler, threads);
+
+    size_t stride = scaler.width + PITCH_PAD;
+    for (size_t i = 0; i < stride * scaler.height; i++)
+        out[i] = CANARY;
+    scaler_run(&scaler, frames[0], out, stride * sizeof(uint32_t));
+    scaler_run(&scaler, frames[1], out, stride * sizeof(uint32_t));
+    scaler_free(&scaler);
+}
+
+/*
+    Return whether every vector version and thread count agrees with the
+    plain C version, and the padding is untouched.
+*/
+static bool check(const ScalerBench *bench, SIMDLevel host,
+                  uint32_t *expected, uint32_t *actual)
+{
+    static const unsigned thread_counts[] = {1, 3};
+    Scaler scaler;
+
+    scaler_init(&scaler, bench->scale, bench->filter, bench->aspect, false);
+    size_t width = scaler.width, height = scaler.height;
+    size_t stride = width + PITCH_PAD;
+    scaler_free(&scaler);
+
+    render(bench, SIMD_NONE, 1, expected);
+    for (int level = SIMD_NONE; level <= (int) host; level++) {
+        for (size_t t = 0; t < 2; t++) {
+            render(bench, level, thread_counts[t], actual);
+            for (size_t i = 0; i < stride * height; i++) {
+                bool pad = i % stride >= width;
+                if (pad ? actual[i] == CANARY : actual[i] == expected[i])
+                    continue;
+                ERROR("%s, %u threads: pixel (%zu, %zu) is 0x%08X, "
+                      "expected 0x%08X", level_name(level), thread_counts[t],
+                      i % stride, i / stride, actual[i],
+                      pad ? CANARY : expected[i])
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/*
+    Time scaling a frame with the given settings and thread count, in
+    nanoseconds.
+*/
+static double run(const ScalerBench *bench, SIMDLevel level,
+                  unsigned threads, uint32_t *out)
+{
+    Scaler scaler;
+
+    scaler_init(&scaler, bench->scale, bench->filter, bench->aspect,
+                bench->blend);
+    scaler.simd = level;
+    scaler_set_threads(&scaler, threads);
+    size_t pitch = (scaler.width + PITCH_PAD) * sizeof(uint32_t);
+
+    uint64_t start = get_time_ns();
+    for (unsigned round = 0; round < ROUNDS; round++)
+        scaler_run(&scaler, frames[round % 2], out, pitch);
+    uint64_t end = get_time_ns();
+
+    scaler_free(&scaler);
+    return (double) (end - start) / ROUNDS;
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    static const unsigned scales[] = {1, 2, 3, 4, 6};
+    size_t max_width = (SCALER_IN_WIDTH * 6 * PAR_WIDTH + PAR_HEIGHT - 1) /
+        PAR_HEIGHT + PITCH_PAD;
+    size_t size = max_width * SCALER_IN_HEIGHT * 6;
+    uint32_t *expected = cr_malloc(sizeof(uint32_t) * size);
+    uint32_t *actual = cr_malloc(sizeof(uint32_t) * size);
+    Scaler probe;
+    bool ok = true;
+
+    scaler_init(&probe, 1, SCALER_NEAREST, false, false);
+    SIMDLevel host = probe.simd;
+    scaler_free(&probe);
+    make_frames();
+
+    printf("crater: scaler benchmark (per frame, %s)\n", level_name(host));
+    printf("%-8s %5s %6s %5s %12s %12s %12s\n", "filter", "scale", "aspect",
+           "blend", "plain", "vector", "4 threads");
+    for (int filter = SCALER_NEAREST; filter <= SCALER_SCALE2X; filter++) {
+        for (size_t s = 0; s < sizeof(scales) / sizeof(scales[0]); s++) {
+            for (unsigned flags = 0; flags < 4; flags++) {
+                ScalerBench bench = {filter, scales[s], flags & 1, flags & 2};
+                if (filter == SCALER_SCALE2X && bench.scale % 2)
+                    continue;
+
+                if (!check(&bench, host, expected, actual)) {
+                    ok = false;
+                    continue;
+                }
+                double plain = run(&bench, SIMD_NONE, 1, actual);
+                double vector = run(&bench, host, 1, actual);
+                double threaded = run(&bench, host, 4, actual);
+                printf("%-8s %5u %6s %5s %9.0f ns %9.0f ns %9.0f ns\n",
+                       filter == SCALER_NEAREST ? "nearest" : "scale2x",
+                       bench.scale, bench.aspect ? "yes" : "no",
+                       bench.blend ? "yes" : "no", plain, vector, threaded);
+            }
+        }
+    }
+
+    free(expected);
+    free(actual);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,359 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for the Z80's lazily computed flags.
+
+    Each 8-bit ALU instruction that defers its flags (ADD, ADC, SUB, SBC, CP,
+    AND, OR, XOR, INC and DEC), and DAA, is run over every input, alone and
+    followed by each instruction that reads the pending flags to do its own
+    work (ADC, SBC, DAA, INC and DEC). A and every flag, read through
+    get_flag() while still pending, are compared against the formulas the CPU
+    used before flags were deferred, which are copied here. Each program then
+    ends with PUSH AF; POP DE, so F must come out of the stack whole too.
+
+    A second set of programs runs an instruction and then POP AF, which must
+    replace the pending flags rather than be overwritten by them later.
+*/
+
+#include "../../src/z80.c"
+
+#define STACK 0xDFF0
+#define NUM_OPS (sizeof(ops) / sizeof(ops[0]))
+#define NUM_READERS (sizeof(readers) / sizeof(readers[0]))
+
+/* Instructions that defer their flags, plus DAA */
+static const uint8_t ops[] = {
+    0x80,                   // add a, b
+    0x88,                   // adc a, b
+    0x90,                   // sub b
+    0x98,                   // sbc a, b
+    0xB8,                   // cp b
+    0xA0,                   // and b
+    0xB0,                   // or b
+    0xA8,                   // xor b
+    0x3C,                   // inc a
+    0x3D,                   // dec a
+    0x27                    // daa
+};
+
+/* Instructions that read the flags left behind by another */
+static const uint8_t readers[] = {
+    0x88,                   // adc a, b
+    0x98,                   // sbc a, b
+    0x27,                   // daa
+    0x3C,                   // inc a
+    0x3D                    // dec a
+};
+
+/* Stores AF in DE through the stack */
+static const uint8_t push_code[] = {
+    0xF5,                   // push af
+    0xD1                    // pop de
+};
+
+/* Replaces AF from the stack, then stores it in HL through the stack */
+static const uint8_t pop_code[] = {
+    0xF1,                   // pop af
+    0xF5,                   // push af
+    0xE1                    // pop hl
+};
+
+static uint8_t rom_data[MMU_ROM_BANK_SIZE];
+static uint16_t rom_next = 0x0100;
+static uint16_t single_addrs[NUM_OPS], pair_addrs[NUM_OPS][NUM_READERS];
+static uint16_t pop_addrs[NUM_OPS];
+
+/* Reference formulas, from before flags were deferred */
+
+static bool ref_overflow(bool lh_neg, bool rh_neg, bool res_neg)
+{
+    return lh_neg == rh_neg && res_neg != lh_neg;
+}
+
+static uint8_t ref_pack(bool c, bool n, bool pv, uint8_t undoc, bool h, bool z,
+                        bool s)
+{
+    return c << FLAG_CARRY | n << FLAG_SUBTRACT | pv << FLAG_PARITY |
+        (undoc & 0x28) | h << FLAG_HALFCARRY | z << FLAG_ZERO | s << FLAG_SIGN;
+}
+
+static bool ref_parity(uint8_t value)
+{
+    return !(__builtin_popcount(value) % 2);
+}
+
+/*
+    ADD or ADC; rh is 16 bits since ADC of 0xFF with carry overflows a byte.
+*/
+static uint8_t ref_add8(uint8_t *a, uint16_t rh)
+{
+    uint8_t lh = *a, res = lh + rh;
+    *a = res;
+    return ref_pack((lh + rh) & 0x100, 0,
+        ref_overflow(lh & 0x80, rh & 0x80, res & 0x80), res,
+        ((lh & 0x0F) + (rh & 0x0F)) & 0x10, !res, res & 0x80);
+}
+
+/*
+    SUB, SBC, or CP; rh is 8 bits, so SBC of 0xFF with carry wraps to zero.
+*/
+static uint8_t ref_sub8(uint8_t *a, uint8_t rh, bool compare)
+{
+    uint8_t lh = *a, res = lh - rh;
+    if (!compare)
+        *a = res;
+    return ref_pack((lh - rh) & 0x100, 1,
+        ref_overflow(lh & 0x80, !(rh & 0x80), res & 0x80),
+        compare ? rh : res, ((lh & 0x0F) - (rh & 0x0F)) & 0x10, !res,
+        res & 0x80);
+}
+
+static uint8_t ref_bitwise(uint8_t *a, uint8_t res, bool is_and)
+{
+    *a = res;
+    return ref_pack(0, 0, ref_parity(res), res, is_and, !res, res & 0x80);
+}
+
+static uint8_t ref_daa(uint8_t *a, uint8_t f)
+{
+    uint8_t old = *a, adjust = 0x00;
+    bool n = f & 1 << FLAG_SUBTRACT, h = f & 1 << FLAG_HALFCARRY;
+
+    if ((old & 0x0F) > 0x09 || h)
+        adjust += 0x06;
+    uint8_t temp = n ? (old - adjust) : (old + adjust);
+    if ((temp >> 4) > 0x09 || f & 1 << FLAG_CARRY)
+        adjust += 0x60;
+
+    uint8_t res = *a += n ? -adjust : adjust;
+    h = n ? (h && (old & 0x0F) < 0x06) : ((old & 0x0F) > 0x09);
+    return (f & 1 << FLAG_SUBTRACT) | ref_pack(adjust >= 0x60, 0,
+        ref_parity(res), res, h, !res, res & 0x80);
+}
+
+/*
+    Run one instruction on A and F the old way, with B as the operand.
+*/
+static void ref_run(uint8_t opcode, uint8_t *a, uint8_t *f, uint8_t b)
+{
+    bool carry = *f & 1 << FLAG_CARRY;
+    uint8_t res;
+
+    switch (opcode) {
+        case 0x80: *f = ref_add8(a, b); break;
+        case 0x88: *f = ref_add8(a, (uint16_t) b + carry); break;
+        case 0x90: *f = ref_sub8(a, b, false); break;
+        case 0x98: *f = ref_sub8(a, b + carry, false); break;
+        case 0xB8: *f = ref_sub8(a, b, true); break;
+        case 0xA0: *f = ref_bitwise(a, *a & b, true); break;
+        case 0xB0: *f = ref_bitwise(a, *a | b, false); break;
+        case 0xA8: *f = ref_bitwise(a, *a ^ b, false); break;
+        case 0x3C:
+            res = *a + 1;
+            *f = carry | ref_pack(0, 0, *a == 0x7F, res, (*a & 0x0F) == 0x0F,
+                !res, res & 0x80);
+            *a = res;
+            break;
+        case 0x3D:
+            res = *a - 1;
+            *f = carry | ref_pack(0, 1, *a == 0x80, res, !(*a & 0x0F),
+                !res, res & 0x80);
+            *a = res;
+            break;
+        case 0x27: *f = ref_daa(a, *f); break;
+    }
+}
+
+/* Running the real thing */
+
+/*
+    Append a program to the test ROM: the given instructions, then a tail.
+*/
+static uint16_t assemble(const uint8_t *code, size_t count,
+                         const uint8_t *tail, size_t tail_size)
+{
+    uint16_t start = rom_next;
+    memcpy(rom_data + rom_next, code, count);
+    memcpy(rom_data + rom_next + count, tail, tail_size);
+    rom_next += count + tail_size;
+    return start;
+}
+
+/*
+    Build the test ROM: one program per instruction, per pair, and per POP.
+*/
+static void build_rom()
+{
+    for (size_t i = 0; i < NUM_OPS; i++) {
+        single_addrs[i] = assemble(&ops[i], 1, push_code, sizeof(push_code));
+        pop_addrs[i] = assemble(&ops[i], 1, pop_code, sizeof(pop_code));
+        for (size_t j = 0; j < NUM_READERS; j++) {
+            uint8_t pair[] = {ops[i], readers[j]};
+            pair_addrs[i][j] = assemble(pair, 2, push_code, sizeof(push_code));
+        }
+    }
+}
+
+/*
+    Set up the registers to run the program at the given address.
+*/
+static void start(Z80 *z80, uint16_t addr, uint8_t a, uint8_t f, uint8_t b)
+{
+    z80->regs.pc = addr;
+    z80->regs.sp = STACK;
+    z80->regs.a = a;
+    z80->regs.b = b;
+    store_flags(z80, f);
+}
+
+/*
+    Run a single instruction, and check that it didn't raise an exception.
+*/
+static bool step(Z80 *z80)
+{
+    if (z80_run_until(z80, z80->clock + 1)) {
+        ERROR("exception at 0x%04X", z80->regs.pc)
+        return false;
+    }
+    return true;
+}
+
+/*
+    Check A, and each flag through get_flag(), against the expected values.
+*/
+static bool check_af(const Z80 *z80, uint8_t a, uint8_t f, const char *what)
+{
+    if (z80->regs.a != a) {
+        ERROR("%s: A is 0x%02X, expected 0x%02X", what, z80->regs.a, a)
+        return false;
+    }
+    for (uint8_t flag = 0; flag < 8; flag++) {
+        if (get_flag(z80, flag) != !!(f & 1 << flag)) {
+            ERROR("%s: flag %d is %d in 0x%02X, expected 0x%02X (A 0x%02X)",
+                  what, flag, get_flag(z80, flag), resolve_flags(z80), f, a)
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+    Run a program of instructions followed by PUSH AF; POP DE, and check it.
+*/
+static bool check_push(Z80 *z80, uint16_t addr, const uint8_t *code,
+                       size_t count, uint8_t a, uint8_t f, uint8_t b)
+{
+    char what[64];
+    size_t len = snprintf(what, sizeof(what), "A=0x%02X F=0x%02X B=0x%02X",
+                          a, f, b);
+
+    start(z80, addr, a, f, b);
+    for (size_t i = 0; i < count; i++) {
+        ref_run(code[i], &a, &f, b);
+        len += snprintf(what + len, sizeof(what) - len, " %02X", code[i]);
+        if (!step(z80) || !check_af(z80, a, f, what))
+            return false;
+    }
+    if (!step(z80) || !step(z80))
+        return false;
+    if (z80->regs.de != (a << 8 | f)) {
+        ERROR("%s: pushed AF is 0x%04X, expected 0x%04X", what,
+              z80->regs.de, a << 8 | f)
+        return false;
+    }
+    return true;
+}
+
+/*
+    Run an instruction followed by POP AF, and check that the flags popped
+    replace the pending ones.
+*/
+static bool check_pop(Z80 *z80, uint16_t addr, uint8_t opcode, uint8_t a,
+                      uint8_t f, uint8_t b)
+{
+    uint16_t popped = (a ^ 0x5A) << 8 | (uint8_t) (b * 37 + f);
+    char what[64];
+    snprintf(what, sizeof(what), "A=0x%02X F=0x%02X B=0x%02X %02X F1",
+             a, f, b, opcode);
+
+    mmu_write_double(z80->mmu, STACK, popped);
+    start(z80, addr, a, f, b);
+    if (!step(z80) || !step(z80))
+        return false;
+    if (!check_af(z80, popped >> 8, popped & 0xFF, what))
+        return false;
+    if (!step(z80) || !step(z80))
+        return false;
+    if (z80->regs.hl != popped) {
+        ERROR("%s: pushed AF is 0x%04X, expected 0x%04X", what,
+              z80->regs.hl, popped)
+        return false;
+    }
+    z80_sync_flags(z80);
+    if (z80->regs.af != popped) {
+        ERROR("%s: synced AF is 0x%04X, expected 0x%04X", what,
+              z80->regs.af, popped)
+        return false;
+    }
+    return true;
+}
+
+/*
+    Run every program over every input. Flags only matter as inputs for the
+    carry, or for DAA, INC and DEC (which keep or read more of them), so the
+    rest get all-clear and all-set. Those three get every F instead, with the
+    complement of A in B for any ADC or SBC that follows.
+*/
+static bool run_all(Z80 *z80)
+{
+    static const uint8_t flag_sets[] = {0x00, 0xFF};
+
+    for (size_t i = 0; i < NUM_OPS; i++) {
+        bool uses_b = ops[i] >= 0x80;
+        unsigned b_max = uses_b ? 0xFF : 0x00, f_max = uses_b ? 1 : 0xFF;
+
+        for (unsigned a = 0; a <= 0xFF; a++) {
+            for (unsigned operand = 0; operand <= b_max; operand++) {
+                uint8_t b = uses_b ? operand : ~a;
+                for (unsigned fi = 0; fi <= f_max; fi++) {
+                    uint8_t f = uses_b ? flag_sets[fi] : fi;
+                    if (!check_push(z80, single_addrs[i], &ops[i], 1, a, f, b))
+                        return false;
+                    if (!check_pop(z80, pop_addrs[i], ops[i], a, f, b))
+                        return false;
+                    for (size_t j = 0; j < NUM_READERS; j++) {
+                        uint8_t pair[] = {ops[i], readers[j]};
+                        if (!check_push(z80, pair_addrs[i][j], pair, 2,
+                                        a, f, b))
+                            return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    static IO io;
+    MMU mmu;
+    Z80 z80;
+
+    build_rom();
+    mmu_init(&mmu);
+    mmu_load_rom(&mmu, rom_data, sizeof(rom_data));
+    mmu_power(&mmu);
+    z80_init(&z80, &mmu, &io);
+    z80_power(&z80);
+
+    bool ok = run_all(&z80);
+
+    z80_free(&z80);
+    mmu_free(&mmu);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,214 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for the Z80's decode cache.
+
+    Each program below ends in HALT, and runs many times over, so its blocks
+    are cached (and, in ROM, compiled by the JIT) before the code under them
+    changes. The changes are made by the programs themselves, in the middle
+    of a block, and between runs:
+
+    - Code in RAM rewrites the operand of its own next instruction, directly
+      and through the mirror of system RAM.
+    - An instruction in RAM is overwritten with a different one from outside.
+    - Code in ROM switches its own slot to another bank, through the mapper
+      registers at $FFFE and $FFFF, and keeps running from the new bank.
+
+    Everything runs in the interpreter, and then with the JIT if it's
+    supported.
+*/
+
+#include "../../src/z80.c"
+
+#define ROM_BANKS 4
+#define RUNS 100
+#define STACK 0xDFF0
+#define SWITCH_OFFSET 0x1000
+
+/* Copied to $C000; rewrites the operand of the LD B after it */
+static const uint8_t rewrite_code[] = {
+    0x3C,                   // inc a
+    0x32, 0x05, 0xC0,       // ld ($C005), a
+    0x06, 0x00,             // ld b, 0
+    0x76                    // halt
+};
+
+/* Copied to $C100; as above, but writes through the mirror at $E000 */
+static const uint8_t mirror_code[] = {
+    0x3C,                   // inc a
+    0x32, 0x05, 0xE1,       // ld ($E105), a
+    0x06, 0x00,             // ld b, 0
+    0x76                    // halt
+};
+
+/* Copied to $C200; its first instruction is replaced between runs */
+static const uint8_t replace_code[] = {
+    0x06, 0x00,             // ld b, 0 (or ld c, n)
+    0x76                    // halt
+};
+
+/* At SWITCH_OFFSET in each bank, for slots 1 and 2; bytes 1 and 6 vary */
+static const uint8_t switch_code[] = {
+    0x3E, 0x00,             // ld a, <next bank>
+    0x32, 0xFE, 0xFF,       // ld ($FFFE), a (or $FFFF)
+    0x06, 0x00,             // ld b, <this bank>
+    0x76                    // halt
+};
+
+static uint8_t rom_data[ROM_BANKS * MMU_ROM_BANK_SIZE];
+static IO io;
+static bool ok = true;
+
+/*
+    Build the test ROM: the bank switching program in every bank, for slot 1
+    at SWITCH_OFFSET and for slot 2 just after it.
+*/
+static void build_rom()
+{
+    for (uint8_t bank = 0; bank < ROM_BANKS; bank++) {
+        for (uint8_t slot = 1; slot <= 2; slot++) {
+            uint8_t *code = rom_data + bank * MMU_ROM_BANK_SIZE +
+                SWITCH_OFFSET + (slot - 1) * sizeof(switch_code);
+            memcpy(code, switch_code, sizeof(switch_code));
+            code[1] = (bank + 1) % ROM_BANKS;
+            code[3] = 0xFD + slot;
+            code[6] = bank;
+        }
+    }
+}
+
+/*
+    Run the program at the given address until it halts, and check that it
+    stops where expected.
+*/
+static bool run(Z80 *z80, uint16_t addr, uint16_t end, const char *name)
+{
+    z80->regs.pc = addr;
+    z80->regs.sp = STACK;
+    z80->halted = false;
+    if (z80_run_until(z80, z80->clock + 1000)) {
+        ERROR("%s: exception at 0x%04X", name, z80->regs.pc)
+        return false;
+    }
+    if (!z80->halted || z80->regs.pc != end + 1) {
+        ERROR("%s: stopped at 0x%04X, expected 0x%04X", name, z80->regs.pc,
+              end + 1)
+        return false;
+    }
+    return true;
+}
+
+/*
+    Copy a program into RAM.
+*/
+static void load_ram(Z80 *z80, uint16_t addr, const uint8_t *code, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+        mmu_write_byte(z80->mmu, addr + i, code[i]);
+}
+
+/*
+    Run a program that rewrites its own next instruction, and check that
+    the new version runs every time.
+*/
+static void test_rewrite(Z80 *z80, uint16_t addr, const uint8_t *code,
+                         size_t size, const char *name)
+{
+    load_ram(z80, addr, code, size);
+    z80->regs.a = 0;
+    for (unsigned i = 1; i <= RUNS && ok; i++) {
+        if (!run(z80, addr, addr + size - 1, name)) {
+            ok = false;
+        } else if (z80->regs.b != (uint8_t) i) {
+            ERROR("%s: run %u loaded 0x%02X, expected 0x%02X", name, i,
+                  z80->regs.b, (uint8_t) i)
+            ok = false;
+        }
+    }
+}
+
+/*
+    Run a program whose first instruction is replaced between runs, and
+    check that the replacement runs.
+*/
+static void test_replace(Z80 *z80, uint16_t addr)
+{
+    load_ram(z80, addr, replace_code, sizeof(replace_code));
+    for (unsigned i = 1; i <= RUNS && ok; i++) {
+        uint8_t opcode = i % 2 ? 0x06 : 0x0E;  // ld b, n or ld c, n
+        mmu_write_byte(z80->mmu, addr, opcode);
+        mmu_write_byte(z80->mmu, addr + 1, i);
+        z80->regs.b = z80->regs.c = 0;
+
+        if (!run(z80, addr, addr + 2, "replace")) {
+            ok = false;
+        } else if ((opcode == 0x06 ? z80->regs.b : z80->regs.c) != i ||
+                   (opcode == 0x06 ? z80->regs.c : z80->regs.b) != 0) {
+            ERROR("replace: run %u left B 0x%02X and C 0x%02X", i,
+                  z80->regs.b, z80->regs.c)
+            ok = false;
+        }
+    }
+}
+
+/*
+    Run the program that switches its own slot to the next bank, and check
+    that the rest of it came from the new bank. The slot is put back before
+    each run, so the block that does the switching stays cached.
+*/
+static void test_switch(Z80 *z80, uint8_t slot)
+{
+    uint16_t addr = slot * MMU_ROM_BANK_SIZE + SWITCH_OFFSET +
+        (slot - 1) * sizeof(switch_code);
+    uint8_t bank = (slot + 1) % ROM_BANKS;
+
+    for (unsigned i = 1; i <= RUNS && ok; i++) {
+        mmu_write_byte(z80->mmu, 0xFFFD + slot, slot);
+        if (!run(z80, addr, addr + sizeof(switch_code) - 1, "switch")) {
+            ok = false;
+        } else if (z80->regs.b != bank) {
+            ERROR("switch: run %u in slot %d ran bank %d, expected %d", i,
+                  slot, z80->regs.b, bank)
+            ok = false;
+        }
+    }
+}
+
+/*
+    Run every test on a freshly powered CPU, in the given JIT mode.
+*/
+static void test_all(Z80 *z80, MMU *mmu, uint8_t jit)
+{
+    mmu_power(mmu);
+    z80_power(z80);
+    if (!z80_set_jit(z80, jit))
+        return;
+
+    test_rewrite(z80, 0xC000, rewrite_code, sizeof(rewrite_code), "rewrite");
+    test_rewrite(z80, 0xC100, mirror_code, sizeof(mirror_code), "mirror");
+    test_replace(z80, 0xC200);
+    test_switch(z80, 1);
+    test_switch(z80, 2);
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    MMU mmu;
+    Z80 z80;
+
+    build_rom();
+    mmu_init(&mmu);
+    mmu_load_rom(&mmu, rom_data, sizeof(rom_data));
+    z80_init(&z80, &mmu, &io);
+
+    test_all(&z80, &mmu, Z80_JIT_OFF);
+    test_all(&z80, &mmu, Z80_JIT_ON);
+
+    z80_free(&z80);
+    mmu_free(&mmu);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,195 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for HALT and interrupts.
+
+    HALT leaves PC on the next instruction, so that is where an accepted
+    interrupt returns to. While halted with nothing to accept, the CPU skips
+    the rest of its cycle budget in whole NOPs, bumping R for each. This runs
+    HALT with an interrupt already pending, with one raised while halted (in
+    interrupt modes 1 and 2), and with interrupts disabled, and checks PC, the
+    return address pushed, R, and the cycles taken.
+*/
+
+#include "../../src/z80.c"
+
+#define STACK 0xDFF0
+#define VECTOR 0x0200
+
+/* Enter interrupt mode 1 and halt with interrupts enabled */
+static const uint8_t im1_code[] = {
+    0xED, 0x56,             // im 1
+    0xFB,                   // ei
+    0x76,                   // halt
+    0x00                    // nop
+};
+
+/* Enter interrupt mode 2 and halt with interrupts enabled */
+static const uint8_t im2_code[] = {
+    0xED, 0x5E,             // im 2
+    0xFB,                   // ei
+    0x76,                   // halt
+    0x00                    // nop
+};
+
+/* Halt with interrupts disabled */
+static const uint8_t di_code[] = {
+    0xF3,                   // di
+    0x76,                   // halt
+    0x00                    // nop
+};
+
+static uint8_t rom_data[MMU_ROM_BANK_SIZE];
+static IO io;
+static bool ok = true;
+
+/*
+    Build the test ROM: each program at its own address, and a mode 2 vector
+    at $01FF (where I is $01) pointing to $0200.
+*/
+static void build_rom()
+{
+    memcpy(rom_data + 0x0100, im1_code, sizeof(im1_code));
+    memcpy(rom_data + 0x0110, im2_code, sizeof(im2_code));
+    memcpy(rom_data + 0x0120, di_code, sizeof(di_code));
+    rom_data[0x01FF] = VECTOR & 0xFF;
+    rom_data[0x0200] = VECTOR >> 8;
+}
+
+/*
+    Run the Z80 from the given address until it has executed the HALT at the
+    given offset, with the IRQ line in the given state. Return the cycles
+    HALT took.
+*/
+static uint64_t run_to_halt(Z80 *z80, uint16_t addr, uint16_t halt, bool irq)
+{
+    z80_power(z80);
+    z80->regs.pc = addr;
+    z80->regs.sp = STACK;
+    z80->regs.i = 0x01;
+    io.irq = irq;
+
+    while (z80->regs.pc != addr + halt)
+        z80_run_until(z80, z80->clock + 1);
+
+    uint64_t clock = z80->clock;
+    z80_run_until(z80, z80->clock + 1);
+    return z80->clock - clock;
+}
+
+/*
+    Check that the Z80 took an interrupt from HALT, in the given cycles.
+*/
+static void check_accepted(const Z80 *z80, uint16_t halt, uint16_t target,
+                           uint64_t cycles, uint64_t expected)
+{
+    uint16_t ret = mmu_read_double(z80->mmu, z80->regs.sp);
+
+    if (z80->halted || z80->regs.pc != target || z80->regs.iff1) {
+        ERROR("interrupt at 0x%04X not accepted: PC is 0x%04X",
+              halt, z80->regs.pc)
+        ok = false;
+    } else if (z80->regs.sp != STACK - 2 || ret != halt + 1) {
+        ERROR("interrupt at 0x%04X returns to 0x%04X, expected 0x%04X",
+              halt, ret, halt + 1)
+        ok = false;
+    } else if (cycles != expected) {
+        ERROR("interrupt at 0x%04X took %llu cycles, expected %llu",
+              halt, (unsigned long long) cycles, (unsigned long long) expected)
+        ok = false;
+    }
+}
+
+/*
+    Check that the Z80 is still halted at the given address.
+*/
+static void check_halted(const Z80 *z80, uint16_t halt)
+{
+    if (!z80->halted || z80->regs.pc != halt + 1) {
+        ERROR("HALT at 0x%04X: not halted (PC is 0x%04X)", halt, z80->regs.pc)
+        ok = false;
+    }
+}
+
+/*
+    HALT with an interrupt already pending: it is accepted straight after.
+*/
+static void test_pending(Z80 *z80)
+{
+    uint64_t cycles = run_to_halt(z80, 0x0100, 3, true);
+    if (cycles != 4) {
+        ERROR("HALT took %llu cycles, expected 4", (unsigned long long) cycles)
+        ok = false;
+    }
+    check_halted(z80, 0x0103);
+
+    uint64_t clock = z80->clock;
+    z80_run_until(z80, clock + 1);
+    check_accepted(z80, 0x0103, 0x0038, z80->clock - clock, 13);
+}
+
+/*
+    HALT with no interrupt: the budget is skipped in NOPs until one is raised.
+*/
+static void test_raised(Z80 *z80, uint16_t addr, uint16_t target,
+                        uint64_t expected)
+{
+    run_to_halt(z80, addr, 3, false);
+
+    uint8_t r = (z80->regs.r & 0x80) | ((z80->regs.r + 3) & 0x7F);
+    uint64_t clock = z80->clock;
+    z80_run_until(z80, clock + 10);
+    check_halted(z80, addr + 3);
+    if (z80->clock - clock != 12 || z80->regs.r != r) {
+        ERROR("halted for %llu cycles with R 0x%02X, expected 12 and 0x%02X",
+              (unsigned long long) (z80->clock - clock), z80->regs.r, r)
+        ok = false;
+    }
+
+    io.irq = true;
+    clock = z80->clock;
+    z80_run_until(z80, clock + 1);
+    check_accepted(z80, addr + 3, target, z80->clock - clock, expected);
+}
+
+/*
+    HALT with interrupts disabled: the IRQ line is ignored.
+*/
+static void test_disabled(Z80 *z80)
+{
+    run_to_halt(z80, 0x0120, 1, true);
+
+    uint64_t clock = z80->clock;
+    z80_run_until(z80, clock + 100);
+    check_halted(z80, 0x0121);
+    if (z80->clock - clock != 100) {
+        ERROR("halted for %llu cycles, expected 100",
+              (unsigned long long) (z80->clock - clock))
+        ok = false;
+    }
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    MMU mmu;
+    Z80 z80;
+
+    build_rom();
+    mmu_init(&mmu);
+    mmu_load_rom(&mmu, rom_data, sizeof(rom_data));
+    mmu_power(&mmu);
+    z80_init(&z80, &mmu, &io);
+
+    test_pending(&z80);
+    test_raised(&z80, 0x0100, 0x0038, 13);
+    test_raised(&z80, 0x0110, VECTOR, 19);
+    test_disabled(&z80);
+
+    z80_free(&z80);
+    mmu_free(&mmu);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
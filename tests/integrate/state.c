@@ -0,0 +1,294 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for save states.
+
+    A small program that keeps every component busy (VRAM and CRAM writes,
+    PSG and stereo writes, ROM bank switching, cartridge RAM, frame
+    interrupts, and self-modifying code in RAM) runs for a while, then a
+    state is saved, to a buffer and to a file. The frames after it are
+    hashed, display and audio together. Loading the state must bring back
+    exactly the same frames, both into the running GameGear and into a fresh
+    one before it powers on (drawing on a separate thread, this time), and
+    saving again right after loading must give back the same bytes.
+*/
+
+#include "../../src/gamegear.c"
+
+#define ROM_BANKS 4
+#define SAVE_FRAME 120
+#define RUN_FRAMES 120
+#define STATE_PATH "integrate/.state"
+
+/* Set up the VDP and cart RAM, copy the RAM routine, and enable interrupts */
+static const uint8_t init_code[] = {
+    0xF3,                   // di
+    0xED, 0x56,             // im 1
+    0x31, 0xF0, 0xDF,       // ld sp, $DFF0
+    0x3E, 0x60,             // ld a, $60 (display on, frame interrupts)
+    0xD3, 0xBF,             // out ($BF), a
+    0x3E, 0x81,             // ld a, $81
+    0xD3, 0xBF,             // out ($BF), a
+    0x3E, 0xFF,             // ld a, $FF (name table at $3800)
+    0xD3, 0xBF,             // out ($BF), a
+    0x3E, 0x82,             // ld a, $82
+    0xD3, 0xBF,             // out ($BF), a
+    0x3E, 0x08,             // ld a, $08 (cart RAM in slot 2)
+    0x32, 0xFC, 0xFF,       // ld ($FFFC), a
+    0x21, 0x00, 0x02,       // ld hl, $0200
+    0x11, 0x00, 0xC2,       // ld de, $C200
+    0x01, 0x09, 0x00,       // ld bc, 9
+    0xED, 0xB0,             // ldir
+    0xFB,                   // ei
+    0xC3, 0x00, 0x03        // jp $0300
+};
+
+/* Count frames in RAM */
+static const uint8_t irq_code[] = {
+    0xF5,                   // push af
+    0xE5,                   // push hl
+    0xDB, 0xBF,             // in a, ($BF)
+    0x21, 0x00, 0xC1,       // ld hl, $C100
+    0x34,                   // inc (hl)
+    0xE1,                   // pop hl
+    0xF1,                   // pop af
+    0xFB,                   // ei
+    0xED, 0x4D              // reti
+};
+
+/* Copied to $C200; rewrites its own immediate operand every call */
+static const uint8_t ram_code[] = {
+    0x3E, 0x00,             // ld a, 0
+    0x3C,                   // inc a
+    0x32, 0x01, 0xC2,       // ld ($C201), a
+    0xD3, 0xBE,             // out ($BE), a
+    0xC9                    // ret
+};
+
+/* Step a generator in RAM, and scatter its value everywhere */
+static const uint8_t loop_code[] = {
+    0x2A, 0x02, 0xC1,       // ld hl, ($C102)
+    0x54,                   // ld d, h
+    0x5D,                   // ld e, l
+    0x29,                   // add hl, hl
+    0x29,                   // add hl, hl
+    0x19,                   // add hl, de
+    0x23,                   // inc hl
+    0x22, 0x02, 0xC1,       // ld ($C102), hl
+    0xF3,                   // di
+    0x7D,                   // ld a, l
+    0xD3, 0xBF,             // out ($BF), a
+    0x7C,                   // ld a, h
+    0xE6, 0xBF,             // and $BF
+    0xF6, 0x40,             // or $40 (VRAM or CRAM write)
+    0xD3, 0xBF,             // out ($BF), a
+    0xFB,                   // ei
+    0x7C,                   // ld a, h
+    0xAD,                   // xor l
+    0xD3, 0xBE,             // out ($BE), a
+    0x7D,                   // ld a, l
+    0xD3, 0x7F,             // out ($7F), a
+    0xD3, 0x02,             // out ($02), a
+    0x7C,                   // ld a, h
+    0xD3, 0x06,             // out ($06), a
+    0xCD, 0x00, 0xC2,       // call $C200
+    0x3A, 0x23, 0x41,       // ld a, ($4123)
+    0xD3, 0xBE,             // out ($BE), a
+    0x32, 0x23, 0x81,       // ld ($8123), a
+    0x7C,                   // ld a, h
+    0xE6, 0x03,             // and $03
+    0x32, 0xFE, 0xFF,       // ld ($FFFE), a
+    0xC3, 0x00, 0x03        // jp $0300
+};
+
+static uint8_t rom_data[ROM_BANKS * MMU_ROM_BANK_SIZE];
+static uint32_t pixels[GG_SCREEN_WIDTH * GG_SCREEN_HEIGHT];
+static uint64_t hashes[RUN_FRAMES];
+static GGState *state, *resaved;
+static unsigned frame;
+static bool ok = true;
+
+/*
+    Build the test ROM: the program in bank 0, and filler to read elsewhere.
+*/
+static void build_rom(ROM *rom)
+{
+    for (size_t i = MMU_ROM_BANK_SIZE; i < sizeof(rom_data); i++)
+        rom_data[i] = (i * 7) ^ (i >> 8);
+    memcpy(rom_data + 0x0000, init_code, sizeof(init_code));
+    memcpy(rom_data + 0x0038, irq_code, sizeof(irq_code));
+    memcpy(rom_data + 0x0200, ram_code, sizeof(ram_code));
+    memcpy(rom_data + 0x0300, loop_code, sizeof(loop_code));
+
+    memset(rom, 0, sizeof(ROM));
+    rom->data = rom_data;
+    rom->size = sizeof(rom_data);
+    rom->product_code = 12345;
+    rom->expected_checksum = 0xBEEF;
+}
+
+/*
+    Hash the frame just emulated: its display and audio (FNV-1a).
+*/
+static uint64_t hash_frame(const GameGear *gg)
+{
+    uint64_t hash = 0xCBF29CE484222325;
+    size_t count;
+    const uint8_t *audio = (const uint8_t*) gamegear_get_audio(gg, &count);
+    const uint8_t *display = (const uint8_t*) pixels;
+
+    for (size_t i = 0; i < sizeof(pixels); i++)
+        hash = (hash ^ display[i]) * 0x100000001B3;
+    for (size_t i = 0; i < 2 * sizeof(int16_t) * count; i++)
+        hash = (hash ^ audio[i]) * 0x100000001B3;
+    return hash ^ count;
+}
+
+/*
+    Check the frame just emulated against the one hashed after the save.
+*/
+static void check_frame(GameGear *gg, unsigned index)
+{
+    if (hash_frame(gg) != hashes[index]) {
+        ERROR("frame %u after loading differs from the original", index + 1)
+        ok = false;
+        gamegear_power_off(gg);
+    }
+}
+
+/*
+    GameGear callback for the first run: save, record, load, and compare.
+*/
+static void first_callback(GameGear *gg)
+{
+    frame++;
+    if (frame < SAVE_FRAME)
+        return;
+
+    if (frame == SAVE_FRAME) {
+        if (!gamegear_save_state(gg, state, sizeof(GGState)) ||
+                !gamegear_save_state_file(gg, STATE_PATH)) {
+            ok = false;
+            gamegear_power_off(gg);
+        }
+    } else if (frame <= SAVE_FRAME + RUN_FRAMES) {
+        hashes[frame - SAVE_FRAME - 1] = hash_frame(gg);
+        if (frame == SAVE_FRAME + RUN_FRAMES) {
+            if (!gamegear_load_state(gg, state, sizeof(GGState)) ||
+                    !gamegear_save_state(gg, resaved, sizeof(GGState))) {
+                ok = false;
+                gamegear_power_off(gg);
+            } else if (memcmp(state, resaved, sizeof(GGState))) {
+                ERROR("saving right after loading gave a different state")
+                ok = false;
+                gamegear_power_off(gg);
+            }
+        }
+    } else {
+        check_frame(gg, frame - SAVE_FRAME - RUN_FRAMES - 1);
+        if (frame == SAVE_FRAME + 2 * RUN_FRAMES)
+            gamegear_power_off(gg);
+    }
+}
+
+/*
+    GameGear callback for the second run, resumed from the state file.
+*/
+static void resume_callback(GameGear *gg)
+{
+    check_frame(gg, frame++);
+    if (frame == RUN_FRAMES)
+        gamegear_power_off(gg);
+}
+
+/*
+    Run a fresh GameGear with the given callback.
+*/
+static GameGear* create_gamegear(const ROM *rom, GGFrameCallback callback)
+{
+    GameGear *gg = gamegear_create();
+    gamegear_load_rom(gg, rom);
+    gamegear_attach_display(gg, pixels, 0);
+    gamegear_attach_callback(gg, callback);
+    gamegear_set_throttle(gg, false);
+    return gg;
+}
+
+/*
+    Check that states for another ROM, of the wrong size, or with a broken
+    schedule are rejected.
+*/
+static void check_rejected(GameGear *gg, ROM *rom)
+{
+    GGEventKind kind = state->sched.events[1].kind;
+
+    if (check_state(gg, state, sizeof(GGState))) {
+        ERROR("a valid state was rejected")
+        ok = false;
+    }
+    if (!check_state(gg, state, sizeof(GGState) - 1)) {
+        ERROR("a truncated state was accepted")
+        ok = false;
+    }
+
+    rom->expected_checksum++;
+    if (!check_state(gg, state, sizeof(GGState))) {
+        ERROR("a state for another ROM was accepted")
+        ok = false;
+    }
+    rom->expected_checksum--;
+
+    state->sched.events[1].kind = state->sched.events[0].kind;
+    if (!check_state(gg, state, sizeof(GGState))) {
+        ERROR("a state with two events of the same kind was accepted")
+        ok = false;
+    }
+    state->sched.events[1].kind = kind;
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    ROM rom;
+    GameGear *gg;
+
+    build_rom(&rom);
+    state = cr_malloc(sizeof(GGState));
+    resaved = cr_malloc(sizeof(GGState));
+
+    gg = create_gamegear(&rom, first_callback);
+    gamegear_simulate(gg);
+    if (gamegear_get_exception(gg)) {
+        ERROR("caught exception: %s", gamegear_get_exception(gg))
+        ok = false;
+    } else if (ok && frame != SAVE_FRAME + 2 * RUN_FRAMES) {
+        ERROR("stopped after %u frames", frame)
+        ok = false;
+    }
+    if (ok)
+        check_rejected(gg, &rom);
+    gamegear_destroy(gg);
+
+    if (ok) {
+        frame = 0;
+        gg = create_gamegear(&rom, resume_callback);
+        gamegear_set_render_thread(gg, true);
+        if (!gamegear_load_state_file(gg, STATE_PATH))
+            ok = false;
+        else
+            gamegear_simulate(gg);
+        if (ok && frame != RUN_FRAMES) {
+            ERROR("resumed run stopped after %u frames", frame)
+            ok = false;
+        }
+        gamegear_destroy(gg);
+    }
+
+    unlink(STATE_PATH);
+    free(state);
+    free(resaved);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
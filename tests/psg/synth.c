@@ -0,0 +1,210 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for the PSG's lazy synthesis.
+
+    Random writes to the PSG and its stereo control are made at random times
+    over many frames (some right as a frame ends), and its output is compared
+    sample for sample against a plain model of the chip that ticks every
+    counter once per tick. Some stretches run several frames without ending
+    one, so samples the PSG had to throw away are skipped.
+*/
+
+#include "../../src/psg.c"
+#include "../random.h"
+
+#define FRAMES 600
+#define FRAME_CYCLES 59736
+#define MAX_PENDING (8 * PSG_BUFFER_TICKS)
+
+typedef struct {
+    uint16_t tone[3];
+    uint8_t vol[PSG_CHANNELS];
+    uint8_t noise, latch, stereo;
+    uint16_t lfsr;
+    uint16_t counter[PSG_CHANNELS];
+    bool output[3], phase;
+} Model;
+
+static int16_t pending[2 * MAX_PENDING];
+static size_t pending_count;
+
+/*
+    Power on the model.
+*/
+static void model_power(Model *model)
+{
+    memset(model, 0, sizeof(Model));
+    for (unsigned ch = 0; ch < PSG_CHANNELS; ch++) {
+        model->vol[ch] = 0x0F;
+        model->counter[ch] = 1;
+    }
+    model->output[0] = model->output[1] = model->output[2] = true;
+    model->stereo = 0xFF;
+    model->lfsr = 0x8000;
+}
+
+/*
+    Write a byte to the model, following the latch/data protocol.
+*/
+static void model_write(Model *model, uint8_t byte)
+{
+    if (byte & 0x80)
+        model->latch = (byte >> 4) & 0x07;
+
+    unsigned ch = model->latch >> 1;
+    bool volume = model->latch & 1;
+    if (volume) {
+        model->vol[ch] = byte & 0x0F;
+    } else if (ch == 3) {
+        model->noise = byte & 0x07;
+        model->lfsr = 0x8000;
+    } else if (byte & 0x80) {
+        model->tone[ch] = (model->tone[ch] & 0x3F0) | (byte & 0x0F);
+    } else {
+        model->tone[ch] = (model->tone[ch] & 0x00F) | (byte & 0x3F) << 4;
+    }
+}
+
+/*
+    Run the model for one tick, adding its output to the pending samples.
+*/
+static void model_tick(Model *model)
+{
+    static const uint16_t noise_periods[3] = {0x10, 0x20, 0x40};
+    int32_t left = 0, right = 0;
+
+    for (unsigned ch = 0; ch < 3; ch++) {
+        if (model->tone[ch] <= 1) {
+            model->output[ch] = true;
+            model->counter[ch] = 1;
+        } else if (--model->counter[ch] == 0) {
+            model->counter[ch] = model->tone[ch];
+            model->output[ch] = !model->output[ch];
+        }
+    }
+
+    if (--model->counter[3] == 0) {
+        unsigned rate = model->noise & 0x03;
+        model->counter[3] = rate < 3 ? noise_periods[rate] :
+                            model->tone[2] ? model->tone[2] : 1;
+        model->phase = !model->phase;
+        if (model->phase) {
+            unsigned taps = model->noise & 0x04 ? 0x0009 : 0x0001;
+            unsigned bit = __builtin_parity(model->lfsr & taps);
+            model->lfsr = (model->lfsr >> 1) | bit << 15;
+        }
+    }
+
+    for (unsigned ch = 0; ch < PSG_CHANNELS; ch++) {
+        bool high = ch < 3 ? model->output[ch] : model->lfsr & 1;
+        int32_t value = high ? amplitudes[model->vol[ch]] :
+                              -amplitudes[model->vol[ch]];
+        if (model->stereo & (0x10 << ch))
+            left += value;
+        if (model->stereo & (0x01 << ch))
+            right += value;
+    }
+
+    pending[2 * pending_count] = left;
+    pending[2 * pending_count + 1] = right;
+    pending_count++;
+}
+
+/*
+    Run the model up to (not including) the given tick.
+*/
+static void model_run(Model *model, uint64_t *time, uint64_t until)
+{
+    for (; *time < until; (*time)++)
+        model_tick(model);
+}
+
+/*
+    Return a random byte to write to the PSG, mostly latches.
+*/
+static uint8_t random_write()
+{
+    uint8_t byte = rand_next() >> 24;
+
+    // Keep tone periods away from the lowest values most of the time, so
+    // there's some audible (and countable) output rather than mostly DC:
+    if ((byte & 0x90) == 0x00 && rand_next() % 4)
+        byte |= 0x04;
+    return byte;
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    PSG psg;
+    Model model;
+    uint64_t clock = 0, model_time = 0;
+    size_t nonzero = 0, compared = 0;
+    bool ok = true;
+
+    psg_init(&psg, &clock);
+    psg_power(&psg);
+    model_power(&model);
+
+    for (unsigned frame = 0; frame < FRAMES && ok; frame++) {
+        uint64_t start = clock;
+        unsigned writes = rand_next() % 24;
+        unsigned length = rand_next() % 16 ? 1 : 3;
+
+        for (unsigned i = 0; i < writes; i++) {
+            clock += rand_next() % (FRAME_CYCLES * length / (writes + 1));
+            // Sometimes write right as the frame ends, to check that steps on
+            // its last tick carry over to the next:
+            if (i == writes - 1 && rand_next() % 4 == 0)
+                clock = start + FRAME_CYCLES * length;
+            model_run(&model, &model_time, clock / PSG_CLOCK_DIVIDER);
+
+            if (rand_next() % 8) {
+                uint8_t byte = random_write();
+                psg_write(&psg, byte);
+                model_write(&model, byte);
+            } else {
+                uint8_t byte = rand_next() >> 24;
+                psg_stereo(&psg, byte);
+                model.stereo = byte;
+            }
+        }
+
+        clock = start + FRAME_CYCLES * length;
+        model_run(&model, &model_time, clock / PSG_CLOCK_DIVIDER);
+        size_t count = psg_end_frame(&psg);
+
+        if (count > pending_count || (length == 1 && count != pending_count)) {
+            ERROR("frame %u: got %zu samples, expected %zu", frame, count,
+                  pending_count)
+            ok = false;
+            break;
+        }
+
+        const int16_t *expected = pending + 2 * (pending_count - count);
+        for (size_t i = 0; i < 2 * count; i++) {
+            if (psg.samples[i] != expected[i]) {
+                ERROR("frame %u: sample %zu (%s) is %d, expected %d", frame,
+                      i / 2, i % 2 ? "right" : "left", psg.samples[i],
+                      expected[i])
+                ok = false;
+                break;
+            }
+            nonzero += psg.samples[i] != 0;
+        }
+        compared += count;
+        pending_count = 0;
+    }
+
+    if (ok && nonzero < compared) {
+        ERROR("only %zu of %zu values were not silent", nonzero, 2 * compared)
+        ok = false;
+    }
+
+    psg_free(&psg);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
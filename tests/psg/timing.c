@@ -0,0 +1,72 @@
+/* Copyright (C) 2014-2016 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for the timing of PSG writes made by the CPU.
+
+    A program waits in a DJNZ loop for a varying number of cycles and then
+    writes to the PSG, all within a single call to z80_run_until(). The PSG
+    must catch up to the tick the OUT instruction started in, not to where
+    the CPU's clock stood when the call began.
+*/
+
+#include "../../src/psg.c"
+#include "../../src/io.h"
+#include "../../src/z80.h"
+
+/* Wait, then silence channel 0 */
+static const uint8_t code[] = {
+    0x06, 0x00,             // ld b, <delay>
+    0x10, 0xFE,             // djnz $
+    0x3E, 0x9F,             // ld a, $9F
+    0xD3, 0x7F,             // out ($7F), a
+    0x76                    // halt
+};
+
+static uint8_t rom_data[MMU_ROM_BANK_SIZE];
+
+/*
+    Main function.
+*/
+int main()
+{
+    MMU mmu;
+    VDP vdp;
+    PSG psg;
+    IO io;
+    Z80 z80;
+
+    memcpy(rom_data, code, sizeof(code));
+    mmu_init(&mmu);
+    mmu_load_rom(&mmu, rom_data, sizeof(rom_data));
+    vdp_init(&vdp);
+    psg_init(&psg, &z80.clock);
+    io_init(&io, &mmu, &vdp, &psg);
+    z80_init(&z80, &mmu, &io);
+
+    bool ok = true;
+    for (unsigned delay = 1; delay <= 0xFF && ok; delay++) {
+        rom_data[1] = delay;
+        mmu_power(&mmu);
+        vdp_power(&vdp);
+        io_power(&io);
+        z80_power(&z80);
+        psg_power(&psg);
+
+        // LD B, DJNZ (taken delay - 1 times, then not), LD A
+        uint64_t start = 7 + 13 * (delay - 1) + 8 + 7;
+        z80_run_until(&z80, 4096);
+        if (psg.time != start / PSG_CLOCK_DIVIDER) {
+            ERROR("write at cycle %llu landed on tick %llu, expected %llu",
+                  (unsigned long long) start, (unsigned long long) psg.time,
+                  (unsigned long long) (start / PSG_CLOCK_DIVIDER))
+            ok = false;
+        }
+    }
+
+    z80_free(&z80);
+    psg_free(&psg);
+    vdp_free(&vdp);
+    mmu_free(&mmu);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,37 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+#pragma once
+
+#include <stdint.h>
+
+/* A small, reproducible pseudorandom number generator for the tests */
+
+static uint32_t rng_state = 0x6C078965;
+
+/*
+    Seed the generator. Tests that don't call this all use the same seed.
+*/
+static inline void rand_seed(uint32_t seed)
+{
+    rng_state = seed;
+}
+
+/*
+    Return a pseudorandom number (xorshift32).
+*/
+static inline uint32_t rand_next()
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/*
+    Return a pseudorandom byte.
+*/
+static inline uint8_t rand_byte()
+{
+    return rand_next() >> 24;
+}
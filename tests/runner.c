@@ -138,6 +138,24 @@ static bool run_asm_test(const char *src_file, const char *ref_file)
     return diff;
 }
 
+/*
+    Run a group of tests that are each a separate program, built by make from
+    <name>/<test>.c. Stop at the first one that fails.
+*/
+static bool run_tests(const char *name, const char **tests, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        char cmd[64];
+        snprintf(cmd, sizeof(cmd), "./%s/%s", name, tests[i]);
+        if (system(cmd)) {
+            FAIL_TEST("test failed: %s/%s", name, tests[i])
+            return false;
+        }
+        PASS_TEST()
+    }
+    return true;
+}
+
 /* --------------------------- Main test runners --------------------------- */
 
 /*
@@ -145,8 +163,8 @@ static bool run_asm_test(const char *src_file, const char *ref_file)
 */
 static bool test_cpu()
 {
-    // TODO
-    return true;
+    const char *tests[] = {"alu", "halt", "cache"};
+    return run_tests("cpu", tests, sizeof(tests) / sizeof(tests[0]));
 }
 
 /*
@@ -154,8 +172,8 @@ static bool test_cpu()
 */
 static bool test_vdp()
 {
-    // TODO
-    return true;
+    const char *tests[] = {"compositor", "thread", "dirty"};
+    return run_tests("vdp", tests, sizeof(tests) / sizeof(tests[0]));
 }
 
 /*
@@ -163,8 +181,8 @@ static bool test_vdp()
 */
 static bool test_psg()
 {
-    // TODO
-    return true;
+    const char *tests[] = {"synth", "timing"};
+    return run_tests("psg", tests, sizeof(tests) / sizeof(tests[0]));
 }
 
 /*
@@ -231,8 +249,8 @@ static bool test_dis()
 */
 static bool test_integrate()
 {
-    // TODO
-    return true;
+    const char *tests[] = {"state"};
+    return run_tests("integrate", tests, sizeof(tests) / sizeof(tests[0]));
 }
 
 /*
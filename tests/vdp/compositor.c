@@ -0,0 +1,257 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Bit-exact test for the VDP's scanline compositor.
+
+    Random scenes (VRAM, CRAM, registers, and a sprite table crowded enough to
+    cause collisions and overflows) are drawn line by line with every
+    compositor the host can run, in both built-in pixel formats, and each
+    line is compared with a straightforward pixel-at-a-time renderer that
+    reads patterns directly from VRAM. Each line is then skipped, as in a
+    skipped frame, which must set the same flags without drawing anything.
+    Rows are padded, as in a locked texture, so anything drawn past the end
+    of a row or at the wrong pitch shows up.
+*/
+
+#include "../../src/vdp.c"
+#include "../random.h"
+
+#define SCENES 64
+#define PITCH  192  /* In 32-bit words; rows are 160 pixels wide */
+
+/*
+    Return the color index of one pixel of a pattern, straight from VRAM.
+*/
+static uint8_t ref_pattern_pixel(const VDP *vdp, uint16_t pattern, uint8_t row,
+                                 uint8_t col)
+{
+    const uint8_t *planes = vdp->vram + 32 * pattern + 4 * row;
+    uint8_t bit = 7 - col;
+
+    return ((planes[0] >> bit) & 1) | ((planes[1] >> bit) & 1) << 1 |
+           ((planes[2] >> bit) & 1) << 2 | ((planes[3] >> bit) & 1) << 3;
+}
+
+/*
+    Draw the current scanline one pixel at a time into a row of host colors.
+
+    Return the status flags the line sets.
+*/
+static uint8_t ref_draw_scanline(const VDP *vdp, uint32_t *row)
+{
+    uint8_t priority_buf[160] = {0}, sprite_buf[160] = {0}, flags = 0;
+    uint8_t src_row = (vdp->v_counter + get_bg_vscroll(vdp)) % (28 << 3);
+    uint8_t start_col = get_bg_hscroll(vdp) >> 3;
+    uint8_t fine_scroll = get_bg_hscroll(vdp) % 8;
+    bool visible = is_display_visible(vdp);
+
+    for (uint8_t col = 5; col < 26; col++) {
+        uint16_t tile = get_background_tile(vdp, src_row >> 3,
+                                            (32 - start_col + col) % 32);
+        uint8_t vshift = (tile & 0x0400) ? 7 - src_row % 8 : src_row % 8;
+
+        for (uint8_t pixel = 0; pixel < 8; pixel++) {
+            int16_t dst_col = ((col - 6) << 3) + pixel + fine_scroll;
+            if (dst_col < 0 || dst_col >= 160)
+                continue;
+
+            uint8_t index = ref_pattern_pixel(vdp, tile & 0x01FF, vshift,
+                (tile & 0x0200) ? 7 - pixel : pixel);
+            uint8_t entry = index + ((tile & 0x0800) ? 16 : 0);
+            if (visible)
+                row[dst_col] = vdp->palette[entry];
+            else
+                row[dst_col] = vdp->palette[16 + get_backdrop_color(vdp)];
+            if ((tile & 0x1000) && index)
+                priority_buf[dst_col] = 1;
+        }
+    }
+
+    const uint8_t *sat = vdp->vram + get_sat_base(vdp);
+    uint8_t height = get_sprite_height(vdp), sprites[8], count = 0;
+
+    for (uint8_t i = 0; i < 64 && sat[i] != 0xD0; i++) {
+        uint8_t y = sat[i] + 1;
+        if (vdp->v_counter >= y && vdp->v_counter < y + height * 8) {
+            if (count == 8) {
+                flags |= FLAG_SPR_OVF;
+                break;
+            }
+            sprites[count++] = i;
+        }
+    }
+
+    while (count-- > 0) {
+        uint8_t i = sprites[count], line = vdp->v_counter - (sat[i] + 1);
+        uint16_t pattern = get_sgt_offset(vdp) + sat[0x80 + 2 * i + 1];
+        if (height == 2)
+            pattern = (pattern & 0x1FE) | line >> 3;
+
+        for (uint8_t pixel = 0; pixel < 8; pixel++) {
+            int16_t dst_col = sat[0x80 + 2 * i] + pixel - 48;
+            if (dst_col < 0 || dst_col >= 160 || priority_buf[dst_col])
+                continue;
+
+            uint8_t index = ref_pattern_pixel(vdp, pattern, line % 8, pixel);
+            if (!index)
+                continue;
+            if (sprite_buf[dst_col])
+                flags |= FLAG_SPR_COL;
+            sprite_buf[dst_col] = 1;
+            if (visible)
+                row[dst_col] = vdp->palette[16 + index];
+        }
+    }
+    return flags;
+}
+
+/*
+    Fill the VDP with a random scene.
+*/
+static void randomize(VDP *vdp)
+{
+    for (size_t i = 0; i < VDP_VRAM_SIZE; i++)
+        vdp->vram[i] = rand_byte();
+    for (size_t i = 0; i < VDP_CRAM_SIZE; i++)
+        vdp->cram[i] = rand_byte();
+    memset(vdp->pattern_dirty, 0xFF, sizeof(vdp->pattern_dirty));
+    vdp->sprites_dirty = true;
+
+    vdp->regs[0x01] = (rand_byte() & 0x02) | (rand_byte() < 0xE0 ? 0x40 : 0);
+    vdp->regs[0x02] = rand_byte();
+    vdp->regs[0x05] = rand_byte();
+    vdp->regs[0x06] = rand_byte();
+    vdp->regs[0x07] = rand_byte();
+    vdp->regs[0x08] = rand_byte();
+    vdp->regs[0x09] = rand_byte();
+
+    // Crowd sprites onto the visible lines and past both horizontal edges:
+    uint8_t *sat = vdp->vram + get_sat_base(vdp);
+    for (uint8_t i = 0; i < 64; i++) {
+        sat[i] = 0x10 + rand_byte() % 0x90;
+        sat[0x80 + 2 * i] = 0x20 + rand_byte() % 0xA0;
+    }
+    if (rand_byte() < 0x40)
+        sat[rand_byte() % 64] = 0xD0;
+}
+
+/*
+    Move some sprites and maybe flip the sprite height through the VDP's
+    ports, as a game might between lines.
+*/
+static void shuffle_sprites(VDP *vdp)
+{
+    uint16_t addr = get_sat_base(vdp) + rand_byte() % 64;
+
+    vdp_write_control(vdp, addr & 0xFF);
+    vdp_write_control(vdp, 0x40 | addr >> 8);
+    for (uint8_t i = rand_byte() % 8; i > 0; i--)
+        vdp_write_data(vdp, 0x10 + rand_byte() % 0x90);
+
+    if (rand_byte() < 0x80) {
+        vdp_write_control(vdp, vdp->regs[0x01] ^ 0x02);
+        vdp_write_control(vdp, 0x81);
+    }
+}
+
+/*
+    Compare every line of the current scene against the reference renderer,
+    using the given compositor and pixel format. Return whether they agree.
+*/
+static bool check_scene(VDP *vdp, SIMDLevel simd, VDPPixelFormat format,
+                        unsigned scene)
+{
+    static uint32_t pixels[PITCH * 144], expected[160];
+    const uint32_t canary = 0xDEADBEEF;
+
+    vdp->simd = simd;
+    vdp_set_pixel_format(vdp, format, NULL);
+    vdp->pixels = pixels;
+    vdp->pitch = PITCH * sizeof(uint32_t);
+    for (size_t i = 0; i < PITCH * 144; i++)
+        pixels[i] = canary;
+
+    for (unsigned y = 0x18; y < 0x18 + 144; y++) {
+        if (y % 32 == 0)
+            shuffle_sprites(vdp);
+        vdp->v_counter = y;
+        uint8_t want = ref_draw_scanline(vdp, expected);
+        vdp->flags = 0;
+        draw_scanline(vdp);
+
+        const uint32_t *row = pixels + (y - 0x18) * PITCH;
+        unsigned width = format == VDP_PIXEL_RGB565 ? 80 : 160;
+        for (unsigned x = 0; x < 160; x++) {
+            uint32_t got = format == VDP_PIXEL_RGB565 ?
+                ((const uint16_t*) row)[x] : row[x];
+            if (got != expected[x]) {
+                ERROR("scene %u, simd %d, format %d: pixel (%u, %u) is "
+                      "0x%08X, expected 0x%08X", scene, simd, format, x,
+                      y - 0x18, got, expected[x])
+                return false;
+            }
+        }
+        for (unsigned x = width; x < PITCH; x++) {
+            if (row[x] != canary) {
+                ERROR("scene %u, simd %d, format %d: line %u was drawn past "
+                      "its end", scene, simd, format, y - 0x18)
+                return false;
+            }
+        }
+        if (vdp->flags != want) {
+            ERROR("scene %u, simd %d, format %d: line %u flags are 0x%02X, "
+                  "expected 0x%02X", scene, simd, format, y - 0x18,
+                  vdp->flags, want)
+            return false;
+        }
+
+        for (unsigned x = 0; x < width; x++)
+            pixels[(y - 0x18) * PITCH + x] = canary;
+        vdp->skip = true;
+        vdp->flags = 0;
+        draw_scanline(vdp);
+        vdp->skip = false;
+        for (unsigned x = 0; x < width; x++) {
+            if (row[x] != canary) {
+                ERROR("scene %u, simd %d, format %d: skipped line %u was "
+                      "drawn", scene, simd, format, y - 0x18)
+                return false;
+            }
+        }
+        if (vdp->flags != want) {
+            ERROR("scene %u, simd %d, format %d: skipped line %u flags are "
+                  "0x%02X, expected 0x%02X", scene, simd, format, y - 0x18,
+                  vdp->flags, want)
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    SIMDLevel levels[] = {SIMD_NONE, SIMD_SSE2, SIMD_AVX2};
+    VDPPixelFormat formats[] = {VDP_PIXEL_ARGB8888, VDP_PIXEL_RGB565};
+    VDP vdp;
+    bool ok = true;
+
+    rand_seed(0x2545F491);
+    vdp_init(&vdp);
+    vdp_power(&vdp);
+    size_t nlevels = vdp.simd + 1;
+
+    for (unsigned scene = 0; scene < SCENES && ok; scene++) {
+        randomize(&vdp);
+        for (size_t i = 0; i < nlevels && ok; i++) {
+            for (size_t j = 0; j < 2 && ok; j++)
+                ok = check_scene(&vdp, levels[i], formats[j], scene);
+        }
+    }
+
+    vdp_free(&vdp);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
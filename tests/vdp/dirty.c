@@ -0,0 +1,126 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for the VDP's detection of unchanged frames.
+
+    A random scene is run for many frames, with occasional writes through the
+    ports at random lines (some of them rewriting what's already there) and
+    some frames skipped. Whenever the VDP says a drawn frame is unchanged, it
+    must match the last drawn frame pixel for pixel; and it must say so often
+    enough for the test to mean something.
+*/
+
+#include "../../src/vdp.c"
+#include "../random.h"
+
+#define FRAMES 1200
+
+/*
+    Set a register through the control port.
+*/
+static void write_reg_port(VDP *vdp, uint8_t reg, uint8_t byte)
+{
+    vdp_write_control(vdp, byte);
+    vdp_write_control(vdp, 0x80 | reg);
+}
+
+/*
+    Fill VRAM and CRAM with random data and set up a visible scene.
+*/
+static void randomize(VDP *vdp)
+{
+    vdp_write_control(vdp, 0x00);
+    vdp_write_control(vdp, 0x40);
+    for (size_t i = 0; i < VDP_VRAM_SIZE; i++)
+        vdp_write_data(vdp, rand_byte());
+
+    vdp_write_control(vdp, 0x00);
+    vdp_write_control(vdp, 0xC0);
+    for (size_t i = 0; i < VDP_CRAM_SIZE; i++)
+        vdp_write_data(vdp, rand_byte());
+
+    write_reg_port(vdp, 0x01, 0x40 | (rand_byte() & 0x02));
+    write_reg_port(vdp, 0x02, rand_byte());
+    write_reg_port(vdp, 0x05, rand_byte());
+    write_reg_port(vdp, 0x06, rand_byte());
+    write_reg_port(vdp, 0x08, rand_byte());
+    write_reg_port(vdp, 0x09, rand_byte());
+}
+
+/*
+    Make a random write through the ports, which may or may not change
+    anything.
+*/
+static void poke(VDP *vdp)
+{
+    uint16_t addr = (rand_byte() << 6 | (rand_byte() & 0x3F)) & 0x3FFF;
+    bool same = rand_byte() < 0x80;
+
+    switch (rand_byte() % 3) {
+        case 0:
+            vdp_write_control(vdp, addr & 0xFF);
+            vdp_write_control(vdp, 0x40 | addr >> 8);
+            vdp_write_data(vdp, same ? vdp->vram[addr] : rand_byte());
+            break;
+        case 1:
+            addr &= 0x3E;
+            vdp_write_control(vdp, addr);
+            vdp_write_control(vdp, 0xC0);
+            vdp_write_data(vdp, same ? vdp->cram[addr] : rand_byte());
+            vdp_write_data(vdp, same ? vdp->cram[addr + 1] : rand_byte());
+            break;
+        case 2:
+            write_reg_port(vdp, 0x08,
+                           same ? vdp->regs[0x08] : vdp->regs[0x08] + 1);
+            break;
+    }
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    static uint32_t pixels[160 * 144], last[160 * 144];
+    unsigned unchanged = 0;
+    VDP vdp;
+    bool ok = true;
+
+    vdp_init(&vdp);
+    vdp_power(&vdp);
+    vdp.pixels = pixels;
+    randomize(&vdp);
+
+    for (unsigned frame = 0; frame < FRAMES && ok; frame++) {
+        bool poking = rand_byte() < 0x30;
+        uint16_t poke_line = rand_byte() % VDP_LINES_PER_FRAME;
+
+        vdp.skip = rand_byte() < 0x40;
+        for (uint16_t line = 0; line < VDP_LINES_PER_FRAME; line++) {
+            if (poking && line == poke_line)
+                poke(&vdp);
+            vdp_simulate_line(&vdp);
+        }
+        if (vdp.skip)
+            continue;
+
+        if (!vdp_frame_changed(&vdp)) {
+            unchanged++;
+            if (memcmp(pixels, last, sizeof(pixels))) {
+                ERROR("frame %u: reported unchanged, but differs", frame)
+                ok = false;
+            }
+        }
+        memcpy(last, pixels, sizeof(pixels));
+    }
+
+    if (ok && unchanged < FRAMES / 4) {
+        ERROR("only %u of %u frames were reported unchanged", unchanged,
+              FRAMES)
+        ok = false;
+    }
+
+    vdp_free(&vdp);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,142 @@
+/* Copyright (C) 2014-2017 Ben Kurtovic <ben.kurtovic@gmail.com>
+   Released under the terms of the MIT License. See LICENSE for details. */
+
+/*
+    Test for the VDP's render thread.
+
+    Two VDPs, one drawing on its own and one on a render thread, are given the
+    same random writes through their ports between lines, much like a game
+    would do. The status register is read from both at random points and must
+    always agree, as must their displays at the end of every frame.
+*/
+
+#include "../../src/vdp.c"
+#include "../random.h"
+
+#define FRAMES 120
+
+/*
+    Write the same byte to the control port of both VDPs.
+*/
+static void write_control(VDP *vdps, uint8_t byte)
+{
+    vdp_write_control(&vdps[0], byte);
+    vdp_write_control(&vdps[1], byte);
+}
+
+/*
+    Write the same byte to the data port of both VDPs.
+*/
+static void write_data(VDP *vdps, uint8_t byte)
+{
+    vdp_write_data(&vdps[0], byte);
+    vdp_write_data(&vdps[1], byte);
+}
+
+/*
+    Set a register in both VDPs.
+*/
+static void write_reg_both(VDP *vdps, uint8_t reg, uint8_t byte)
+{
+    write_control(vdps, byte);
+    write_control(vdps, 0x80 | reg);
+}
+
+/*
+    Fill VRAM and CRAM with random data and set up a crowded sprite table.
+*/
+static void randomize(VDP *vdps)
+{
+    write_control(vdps, 0x00);
+    write_control(vdps, 0x40);
+    for (size_t i = 0; i < VDP_VRAM_SIZE; i++)
+        write_data(vdps, rand_byte());
+
+    write_control(vdps, 0x00);
+    write_control(vdps, 0xC0);
+    for (size_t i = 0; i < VDP_CRAM_SIZE; i++)
+        write_data(vdps, rand_byte());
+
+    write_reg_both(vdps, 0x01, 0x40 | (rand_byte() & 0x02));
+    write_reg_both(vdps, 0x02, rand_byte());
+    write_reg_both(vdps, 0x05, rand_byte());
+    write_reg_both(vdps, 0x06, rand_byte());
+    write_reg_both(vdps, 0x08, rand_byte());
+    write_reg_both(vdps, 0x09, rand_byte());
+}
+
+/*
+    Make some random changes that affect drawing, as a game might mid-frame.
+*/
+static void poke(VDP *vdps)
+{
+    uint16_t sat = get_sat_base(&vdps[0]);
+    uint16_t addr = rand_byte() < 0x80 ? sat + rand_byte() % 64 :
+                    (rand_byte() << 6 | (rand_byte() & 0x3F)) & 0x3FFF;
+
+    write_control(vdps, addr & 0xFF);
+    write_control(vdps, 0x40 | addr >> 8);
+    for (uint8_t i = rand_byte() % 16; i > 0; i--)
+        write_data(vdps, addr >= sat && addr < sat + 64 ?
+                   0x10 + rand_byte() % 0x90 : rand_byte());
+
+    if (rand_byte() < 0x20) {
+        write_control(vdps, rand_byte() & 0x3E);
+        write_control(vdps, 0xC0);
+        write_data(vdps, rand_byte());
+        write_data(vdps, rand_byte());
+    }
+    if (rand_byte() < 0x20)
+        write_reg_both(vdps, 0x08, rand_byte());
+}
+
+/*
+    Main function.
+*/
+int main()
+{
+    static uint32_t pixels[2][160 * 144];
+    VDP vdps[2];
+    bool ok = true;
+
+    rand_seed(0x9E3779B9);
+    for (int i = 0; i < 2; i++) {
+        vdp_init(&vdps[i]);
+        vdp_power(&vdps[i]);
+        vdps[i].pixels = pixels[i];
+    }
+    if (!vdp_set_threaded(&vdps[1], true))
+        return EXIT_FAILURE;
+
+    randomize(vdps);
+    for (unsigned frame = 0; frame < FRAMES && ok; frame++) {
+        if (frame % 30 == 0)
+            randomize(vdps);
+
+        for (unsigned line = 0; line < VDP_LINES_PER_FRAME && ok; line++) {
+            if (rand_byte() < 0x40)
+                poke(vdps);
+            if (rand_byte() < 0x10) {
+                uint8_t want = vdp_read_control(&vdps[0]);
+                uint8_t got = vdp_read_control(&vdps[1]);
+                if (got != want) {
+                    ERROR("frame %u, line %u: status is 0x%02X, expected "
+                          "0x%02X", frame, line, got, want)
+                    ok = false;
+                }
+            }
+            vdp_simulate_line(&vdps[0]);
+            vdp_simulate_line(&vdps[1]);
+        }
+
+        vdp_sync(&vdps[1]);
+        if (ok && memcmp(pixels[0], pixels[1], sizeof(pixels[0]))) {
+            ERROR("frame %u: displays differ", frame)
+            ok = false;
+        }
+    }
+
+    vdp_free(&vdps[0]);
+    vdp_free(&vdps[1]);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}